@@ -33,9 +33,17 @@
 
 #include <iomanip>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 #include <algorithm>
 
+[[noreturn]] static void ExitOnInputError(const std::string& reason)
+{
+    if(InputFlags::ThrowOnError())
+        throw std::invalid_argument(reason);
+    exit(0); // NOLINT (concurrency-mt-unsafe)
+}
+
 int TensorParameters::SetTensordDescriptor(miopenTensorDescriptor_t result,
                                            miopenDataType_t data_type)
 {
@@ -131,7 +139,7 @@ void InputFlags::Print() const
             std::cout << std::setw(37) << " " << *help_next_line << std::endl;
         }
     }
-    exit(0); // NOLINT (concurrency-mt-unsafe)
+    ExitOnInputError("Invalid input flags or help requested");
 }
 
 char InputFlags::FindShortName(const std::string& long_name) const
@@ -145,7 +153,7 @@ char InputFlags::FindShortName(const std::string& long_name) const
     if(short_name == '\0')
     {
         std::cout << "Long Name: " << long_name << " Not Found !";
-        exit(0); // NOLINT (concurrency-mt-unsafe)
+        ExitOnInputError("Long Name: " + long_name + " Not Found");
     }
     return short_name;
 }
@@ -184,7 +192,7 @@ void InputFlags::Parse(int argc, char* argv[])
             if(MapInputs.find(short_name) == MapInputs.end())
             {
                 std::cout << "Input Flag: " << short_name << " Not Found !";
-                exit(0); // NOLINT (concurrency-mt-unsafe)
+                ExitOnInputError(std::string{"Input Flag: "} + short_name + " Not Found");
             }
             if(short_name == 'h')
                 Print();
@@ -117,6 +117,14 @@ public:
     void SetValue(const std::string& long_name, const std::string& new_value);
     void StoreOptionalFlagValue(char short_name, const std::string& input_value);
 
+    /// When set, wrong flags and help requests throw std::invalid_argument instead of exiting the
+    /// process, so that the batch mode can go on with the next command.
+    static bool& ThrowOnError()
+    {
+        static bool throw_on_error = false;
+        return throw_on_error;
+    }
+
     virtual ~InputFlags() {}
 };
 
@@ -0,0 +1,625 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_DRIVER_CONV_CPU_BLOCKED_HPP
+#define GUARD_DRIVER_CONV_CPU_BLOCKED_HPP
+
+/// Host reference convolutions used by the driver to verify GPU results.
+///
+/// They compute the same values as the ones in test/cpu_conv.hpp, but much faster for large
+/// problems. Each image is first converted to the accumulator type in a dense NC(D)HW buffer,
+/// so the inner loops run over contiguous rows no matter the layout of the source tensors.
+/// Several output channels are computed together to reuse every loaded input row, and the
+/// rows are distributed over the shared thread pool.
+
+#include <../test/cpu_conv.hpp>
+#include <../test/tensor_holder.hpp>
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace conv {
+namespace blocked {
+
+/// Number of output channels computed together by the forward and weights kernels.
+constexpr std::size_t k_block = 8;
+/// Number of input channels computed together by the backward data kernel.
+constexpr std::size_t c_block = 4;
+
+template <std::size_t ConvDim>
+struct Geometry
+{
+    std::size_t n_len;
+    std::size_t c_len; // All input channels.
+    std::size_t k_len;
+    std::size_t c_per_group;
+    std::size_t k_per_group;
+    std::size_t group_count;
+
+    std::array<std::size_t, ConvDim> in_len;
+    std::array<std::size_t, ConvDim> wei_len;
+    std::array<std::size_t, ConvDim> out_len;
+    std::array<std::ptrdiff_t, ConvDim> pads;
+    std::array<std::ptrdiff_t, ConvDim> strides;
+    std::array<std::ptrdiff_t, ConvDim> dilations;
+
+    /// A row is a line along the last spatial dimension.
+    std::size_t in_rows  = 1;
+    std::size_t wei_rows = 1;
+    std::size_t out_rows = 1;
+
+    /// Input row used by an (output row, filter row) pair, -1 if it lies in the padding.
+    std::vector<std::ptrdiff_t> row_map;
+    /// Range of the output positions of a row which read an input element for the given
+    /// position of the filter along the last dimension.
+    std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> x_range;
+
+    std::size_t InW() const { return in_len.back(); }
+    std::size_t WeiW() const { return wei_len.back(); }
+    std::size_t OutW() const { return out_len.back(); }
+    std::size_t InSize() const { return in_rows * InW(); }
+    std::size_t WeiSize() const { return wei_rows * WeiW(); }
+    std::size_t OutSize() const { return out_rows * OutW(); }
+
+    /// Offset of the last spatial element read for the given output and filter positions.
+    std::ptrdiff_t InX(std::ptrdiff_t out_x, std::size_t wei_x) const
+    {
+        return out_x * strides.back() + static_cast<std::ptrdiff_t>(wei_x) * dilations.back() -
+               pads.back();
+    }
+
+    template <class Range>
+    Geometry(const miopen::TensorDescriptor& in,
+             const miopen::TensorDescriptor& wei,
+             const miopen::TensorDescriptor& out,
+             const Range& pads_,
+             const Range& strides_,
+             const Range& dilations_,
+             std::size_t group_count_)
+        : n_len(in.GetLengths()[0]),
+          c_len(in.GetLengths()[1]),
+          k_len(wei.GetLengths()[0]),
+          c_per_group(wei.GetLengths()[1]),
+          k_per_group(k_len / group_count_),
+          group_count(group_count_)
+    {
+        for(std::size_t i = 0; i < ConvDim; ++i)
+        {
+            in_len[i]    = in.GetLengths()[i + 2];
+            wei_len[i]   = wei.GetLengths()[i + 2];
+            out_len[i]   = out.GetLengths()[i + 2];
+            pads[i]      = pads_[i];
+            strides[i]   = strides_[i];
+            dilations[i] = dilations_[i];
+        }
+        for(std::size_t i = 0; i + 1 < ConvDim; ++i)
+        {
+            in_rows *= in_len[i];
+            wei_rows *= wei_len[i];
+            out_rows *= out_len[i];
+        }
+
+        row_map.resize(out_rows * wei_rows);
+        for(std::size_t out_row = 0; out_row < out_rows; ++out_row)
+        {
+            const auto out_id = DecodeRow(out_row, out_len);
+            for(std::size_t wei_row = 0; wei_row < wei_rows; ++wei_row)
+            {
+                const auto wei_id  = DecodeRow(wei_row, wei_len);
+                std::ptrdiff_t row = 0;
+                for(std::size_t i = 0; i + 1 < ConvDim && row >= 0; ++i)
+                {
+                    const auto in_id = static_cast<std::ptrdiff_t>(out_id[i]) * strides[i] +
+                                       static_cast<std::ptrdiff_t>(wei_id[i]) * dilations[i] -
+                                       pads[i];
+                    const auto len = static_cast<std::ptrdiff_t>(in_len[i]);
+                    row            = (in_id < 0 || in_id >= len) ? -1 : row * len + in_id;
+                }
+                row_map[out_row * wei_rows + wei_row] = row;
+            }
+        }
+
+        x_range.resize(WeiW());
+        for(std::size_t wei_x = 0; wei_x < WeiW(); ++wei_x)
+        {
+            const auto out_w     = static_cast<std::ptrdiff_t>(OutW());
+            std::ptrdiff_t begin = 0;
+            while(begin < out_w && InX(begin, wei_x) < 0)
+                ++begin;
+            auto end = begin;
+            while(end < out_w && InX(end, wei_x) < static_cast<std::ptrdiff_t>(InW()))
+                ++end;
+            x_range[wei_x] = {begin, end};
+        }
+    }
+
+    static std::array<std::size_t, ConvDim>
+    DecodeRow(std::size_t row, const std::array<std::size_t, ConvDim>& len)
+    {
+        std::array<std::size_t, ConvDim> id{};
+        for(std::size_t i = ConvDim - 1; i-- > 0;)
+        {
+            id[i] = row % len[i];
+            row /= len[i];
+        }
+        return id;
+    }
+};
+
+/// Offset in a tensor of the beginning of row of the given channel of the given image.
+template <std::size_t ConvDim>
+std::size_t RowOffset(const miopen::TensorDescriptor& desc,
+                      std::size_t i0,
+                      std::size_t i1,
+                      std::size_t row,
+                      const std::array<std::size_t, ConvDim>& len)
+{
+    const auto& strides = desc.GetStrides();
+    const auto id       = Geometry<ConvDim>::DecodeRow(row, len);
+    std::size_t offset  = i0 * strides[0] + i1 * strides[1];
+    for(std::size_t i = 0; i + 1 < ConvDim; ++i)
+        offset += id[i] * strides[i + 2];
+    return offset;
+}
+
+/// Converts all the channels of one image (or filter) to a dense buffer of the accumulator type.
+template <std::size_t ConvDim, class Tacc, class T, class F>
+void Pack(const tensor<T>& t,
+          std::size_t i0,
+          const std::array<std::size_t, ConvDim>& len,
+          F f,
+          Tacc* dst)
+{
+    const auto channels = t.desc.GetLengths()[1];
+    const auto w_stride = t.desc.GetStrides().back();
+    std::size_t rows    = 1;
+    for(std::size_t i = 0; i + 1 < ConvDim; ++i)
+        rows *= len[i];
+    const auto w_len = len.back();
+
+    miopen::par_for(channels * rows, [&](std::size_t i) {
+        const auto src = RowOffset<ConvDim>(t.desc, i0, i / rows, i % rows, len);
+        auto row       = dst + i * w_len;
+        for(std::size_t x = 0; x < w_len; ++x)
+            row[x] = static_cast<Tacc>(f(t.data[src + x * w_stride]));
+    });
+}
+
+/// Stores one row of results of the given channel of the given image.
+template <std::size_t ConvDim, class Tacc, class T>
+void StoreRow(tensor<T>& t,
+              std::size_t i0,
+              std::size_t i1,
+              std::size_t row,
+              const std::array<std::size_t, ConvDim>& len,
+              const Tacc* src)
+{
+    const auto dst      = RowOffset<ConvDim>(t.desc, i0, i1, row, len);
+    const auto w_stride = t.desc.GetStrides().back();
+    for(std::size_t x = 0; x < len.back(); ++x)
+        t.data[dst + x * w_stride] = static_cast<T>(src[x]);
+}
+
+template <std::size_t ConvDim,
+          class Tacc,
+          class FI,
+          class FW,
+          class Tin,
+          class Twei,
+          class Tout,
+          class Range>
+void Forward(const tensor<Tin>& in,
+             const tensor<Twei>& wei,
+             tensor<Tout>& out,
+             const Range& pads,
+             const Range& strides,
+             const Range& dilations,
+             std::size_t group_count,
+             FI fi,
+             FW fw)
+{
+    const Geometry<ConvDim> g{in.desc, wei.desc, out.desc, pads, strides, dilations, group_count};
+
+    const auto wei_size = g.c_per_group * g.WeiSize();
+    std::vector<Tacc> wei_buf(g.k_len * wei_size);
+    for(std::size_t k = 0; k < g.k_len; ++k)
+        Pack<ConvDim>(wei, k, g.wei_len, fw, wei_buf.data() + k * wei_size);
+
+    const auto blocks_per_group = (g.k_per_group + k_block - 1) / k_block;
+    std::vector<Tacc> in_buf(g.c_len * g.InSize());
+
+    for(std::size_t n = 0; n < g.n_len; ++n)
+    {
+        Pack<ConvDim>(in, n, g.in_len, fi, in_buf.data());
+
+        const auto tasks = g.group_count * blocks_per_group * g.out_rows;
+        miopen::par_for_ranges(tasks, [&](std::size_t first, std::size_t last) {
+            // Reused by the tasks of the range
+            std::vector<Tacc> acc(k_block * g.OutW());
+            for(auto task = first; task < last; ++task)
+            {
+                const auto out_row = task % g.out_rows;
+                const auto block   = task / g.out_rows;
+                const auto group   = block / blocks_per_group;
+                const auto k_begin = group * g.k_per_group + (block % blocks_per_group) * k_block;
+                const auto k_count = std::min(k_block, (group + 1) * g.k_per_group - k_begin);
+
+                std::fill_n(acc.begin(), k_count * g.OutW(), Tacc{0});
+                for(std::size_t c = 0; c < g.c_per_group; ++c)
+                {
+                    const auto in_c = in_buf.data() + (group * g.c_per_group + c) * g.InSize();
+                    for(std::size_t wei_row = 0; wei_row < g.wei_rows; ++wei_row)
+                    {
+                        const auto in_row = g.row_map[out_row * g.wei_rows + wei_row];
+                        if(in_row < 0)
+                            continue;
+                        const auto in_data = in_c + in_row * g.InW();
+                        const auto wei_data = wei_buf.data() + k_begin * wei_size +
+                                              c * g.WeiSize() + wei_row * g.WeiW();
+
+                        for(std::size_t wei_x = 0; wei_x < g.WeiW(); ++wei_x)
+                        {
+                            const auto [begin, end] = g.x_range[wei_x];
+                            const auto in_x         = g.InX(0, wei_x);
+                            const auto stride       = g.strides.back();
+                            for(std::size_t k = 0; k < k_count; ++k)
+                            {
+                                const auto w = wei_data[k * wei_size + wei_x];
+                                auto a       = acc.data() + k * g.OutW();
+                                for(auto x = begin; x < end; ++x)
+                                    a[x] += w * in_data[in_x + x * stride];
+                            }
+                        }
+                    }
+                }
+                for(std::size_t k = 0; k < k_count; ++k)
+                {
+                    const auto row = acc.data() + k * g.OutW();
+                    StoreRow<ConvDim>(out, n, k_begin + k, out_row, g.out_len, row);
+                }
+            }
+        });
+    }
+}
+
+template <std::size_t ConvDim,
+          class Tacc,
+          class FW,
+          class FO,
+          class Tin,
+          class Twei,
+          class Tout,
+          class Range>
+void BackwardData(tensor<Tin>& in,
+                  const tensor<Twei>& wei,
+                  const tensor<Tout>& out,
+                  const Range& pads,
+                  const Range& strides,
+                  const Range& dilations,
+                  std::size_t group_count,
+                  FW fw,
+                  FO fo)
+{
+    const Geometry<ConvDim> g{in.desc, wei.desc, out.desc, pads, strides, dilations, group_count};
+
+    const auto wei_size = g.c_per_group * g.WeiSize();
+    std::vector<Tacc> wei_buf(g.k_len * wei_size);
+    for(std::size_t k = 0; k < g.k_len; ++k)
+        Pack<ConvDim>(wei, k, g.wei_len, fw, wei_buf.data() + k * wei_size);
+
+    // (output row, filter row) pairs contributing to each input row.
+    std::vector<std::vector<std::pair<std::size_t, std::size_t>>> sources(g.in_rows);
+    for(std::size_t out_row = 0; out_row < g.out_rows; ++out_row)
+    {
+        for(std::size_t wei_row = 0; wei_row < g.wei_rows; ++wei_row)
+        {
+            const auto in_row = g.row_map[out_row * g.wei_rows + wei_row];
+            if(in_row >= 0)
+                sources[in_row].emplace_back(out_row, wei_row);
+        }
+    }
+
+    const auto blocks_per_group = (g.c_per_group + c_block - 1) / c_block;
+    std::vector<Tacc> out_buf(g.k_len * g.OutSize());
+
+    for(std::size_t n = 0; n < g.n_len; ++n)
+    {
+        Pack<ConvDim>(out, n, g.out_len, fo, out_buf.data());
+
+        const auto tasks = g.group_count * blocks_per_group * g.in_rows;
+        miopen::par_for_ranges(tasks, [&](std::size_t first, std::size_t last) {
+            // Reused by the tasks of the range
+            std::vector<Tacc> acc(c_block * g.InW());
+            for(auto task = first; task < last; ++task)
+            {
+                const auto in_row  = task % g.in_rows;
+                const auto block   = task / g.in_rows;
+                const auto group   = block / blocks_per_group;
+                const auto c_first = (block % blocks_per_group) * c_block;
+                const auto c_count = std::min(c_block, g.c_per_group - c_first);
+
+                std::fill_n(acc.begin(), c_count * g.InW(), Tacc{0});
+                for(const auto& [out_row, wei_row] : sources[in_row])
+                {
+                    for(std::size_t k = group * g.k_per_group; k < (group + 1) * g.k_per_group; ++k)
+                    {
+                        const auto out_data = out_buf.data() + k * g.OutSize() + out_row * g.OutW();
+                        const auto wei_data = wei_buf.data() + k * wei_size +
+                                              c_first * g.WeiSize() + wei_row * g.WeiW();
+
+                        for(std::size_t wei_x = 0; wei_x < g.WeiW(); ++wei_x)
+                        {
+                            const auto [begin, end] = g.x_range[wei_x];
+                            const auto in_x         = g.InX(0, wei_x);
+                            const auto stride       = g.strides.back();
+                            for(std::size_t c = 0; c < c_count; ++c)
+                            {
+                                const auto w = wei_data[c * g.WeiSize() + wei_x];
+                                auto a       = acc.data() + c * g.InW();
+                                for(auto x = begin; x < end; ++x)
+                                    a[in_x + x * stride] += w * out_data[x];
+                            }
+                        }
+                    }
+                }
+                for(std::size_t c = 0; c < c_count; ++c)
+                {
+                    const auto in_c = group * g.c_per_group + c_first + c;
+                    StoreRow<ConvDim>(in, n, in_c, in_row, g.in_len, acc.data() + c * g.InW());
+                }
+            }
+        });
+    }
+}
+
+template <std::size_t ConvDim,
+          class Tacc,
+          class FI,
+          class FO,
+          class Tin,
+          class Twei,
+          class Tout,
+          class Range>
+void BackwardWeights(const tensor<Tin>& in,
+                     tensor<Twei>& wei,
+                     const tensor<Tout>& out,
+                     const Range& pads,
+                     const Range& strides,
+                     const Range& dilations,
+                     std::size_t group_count,
+                     FI fi,
+                     FO fo)
+{
+    const Geometry<ConvDim> g{in.desc, wei.desc, out.desc, pads, strides, dilations, group_count};
+
+    const auto wei_size         = g.c_per_group * g.WeiSize();
+    const auto blocks_per_group = (g.k_per_group + k_block - 1) / k_block;
+    std::vector<Tacc> wei_acc(g.k_len * wei_size, Tacc{0});
+    std::vector<Tacc> in_buf(g.c_len * g.InSize());
+    std::vector<Tacc> out_buf(g.k_len * g.OutSize());
+
+    for(std::size_t n = 0; n < g.n_len; ++n)
+    {
+        Pack<ConvDim>(in, n, g.in_len, fi, in_buf.data());
+        Pack<ConvDim>(out, n, g.out_len, fo, out_buf.data());
+
+        miopen::par_for(g.group_count * blocks_per_group * g.c_per_group, [&](std::size_t task) {
+            const auto c       = task % g.c_per_group;
+            const auto block   = task / g.c_per_group;
+            const auto group   = block / blocks_per_group;
+            const auto k_begin = group * g.k_per_group + (block % blocks_per_group) * k_block;
+            const auto k_count = std::min(k_block, (group + 1) * g.k_per_group - k_begin);
+            const auto in_c    = in_buf.data() + (group * g.c_per_group + c) * g.InSize();
+
+            for(std::size_t out_row = 0; out_row < g.out_rows; ++out_row)
+            {
+                for(std::size_t wei_row = 0; wei_row < g.wei_rows; ++wei_row)
+                {
+                    const auto in_row = g.row_map[out_row * g.wei_rows + wei_row];
+                    if(in_row < 0)
+                        continue;
+                    const auto in_data = in_c + in_row * g.InW();
+
+                    for(std::size_t k = 0; k < k_count; ++k)
+                    {
+                        const auto out_data =
+                            out_buf.data() + (k_begin + k) * g.OutSize() + out_row * g.OutW();
+                        auto w = wei_acc.data() + (k_begin + k) * wei_size + c * g.WeiSize() +
+                                 wei_row * g.WeiW();
+
+                        for(std::size_t wei_x = 0; wei_x < g.WeiW(); ++wei_x)
+                        {
+                            const auto [begin, end] = g.x_range[wei_x];
+                            const auto in_x         = g.InX(0, wei_x);
+                            const auto stride       = g.strides.back();
+                            Tacc sum                = 0;
+                            for(auto x = begin; x < end; ++x)
+                                sum += in_data[in_x + x * stride] * out_data[x];
+                            w[wei_x] += sum;
+                        }
+                    }
+                }
+            }
+        });
+    }
+
+    miopen::par_for(g.k_len * g.c_per_group * g.wei_rows, [&](std::size_t i) {
+        const auto row = i % g.wei_rows;
+        const auto kc  = i / g.wei_rows;
+        StoreRow<ConvDim>(wei,
+                          kc / g.c_per_group,
+                          kc % g.c_per_group,
+                          row,
+                          g.wei_len,
+                          wei_acc.data() + i * g.WeiW());
+    });
+}
+
+/// Vectorized layouts and the CHWNc filter layout are left to the generic implementation.
+template <class Tin, class Twei, class Tout>
+bool IsApplicable(std::size_t spatial_dim,
+                  const tensor<Tin>& in,
+                  const tensor<Twei>& wei,
+                  const tensor<Tout>& out)
+{
+    return spatial_dim >= 1 && spatial_dim <= 3 && in.desc.GetVectorLength() == 1 &&
+           wei.desc.GetVectorLength() == 1 && out.desc.GetVectorLength() == 1 &&
+           wei.desc.GetLayout_str() != "CHWNc" && in.desc.GetNumDims() == spatial_dim + 2 &&
+           wei.desc.GetNumDims() == spatial_dim + 2 && out.desc.GetNumDims() == spatial_dim + 2;
+}
+
+} // namespace blocked
+} // namespace conv
+
+template <typename Tin,
+          typename Twei,
+          typename Tout,
+          typename Range,
+          typename Tacc = double,
+          typename FI   = PassThru<Tin>,
+          typename FW   = PassThru<Twei>>
+void cpu_convolution_forward_blocked(std::size_t spatial_dim,
+                                     const tensor<Tin>& in,
+                                     const tensor<Twei>& wei,
+                                     tensor<Tout>& out,
+                                     const Range& pads,
+                                     const Range& strides,
+                                     const Range& dilations,
+                                     std::size_t group_count,
+                                     FI fi = {},
+                                     FW fw = {})
+{
+    if(!conv::blocked::IsApplicable(spatial_dim, in, wei, out))
+    {
+        cpu_convolution_forward<Tin, Twei, Tout, Range, Tacc>(
+            spatial_dim, in, wei, out, pads, strides, dilations, group_count, fi, fw);
+        return;
+    }
+
+    switch(spatial_dim)
+    {
+    case 1:
+        conv::blocked::Forward<1, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fi, fw);
+        break;
+    case 2:
+        conv::blocked::Forward<2, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fi, fw);
+        break;
+    default:
+        conv::blocked::Forward<3, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fi, fw);
+        break;
+    }
+}
+
+template <typename Tin,
+          typename Twei,
+          typename Tout,
+          typename Range,
+          typename Tacc = double,
+          typename FW   = PassThru<Twei>,
+          typename FO   = PassThru<Tout>>
+void cpu_convolution_backward_data_blocked(std::size_t spatial_dim,
+                                           tensor<Tin>& in,
+                                           const tensor<Twei>& wei,
+                                           const tensor<Tout>& out,
+                                           const Range& pads,
+                                           const Range& strides,
+                                           const Range& dilations,
+                                           std::size_t group_count,
+                                           FW fw = {},
+                                           FO fo = {})
+{
+    if(!conv::blocked::IsApplicable(spatial_dim, in, wei, out))
+    {
+        cpu_convolution_backward_data<Tin, Twei, Tout, Range, Tacc>(
+            spatial_dim, in, wei, out, pads, strides, dilations, group_count, fw, fo);
+        return;
+    }
+
+    switch(spatial_dim)
+    {
+    case 1:
+        conv::blocked::BackwardData<1, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fw, fo);
+        break;
+    case 2:
+        conv::blocked::BackwardData<2, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fw, fo);
+        break;
+    default:
+        conv::blocked::BackwardData<3, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fw, fo);
+        break;
+    }
+}
+
+template <typename Tin,
+          typename Twei,
+          typename Tout,
+          typename Range,
+          typename Tacc = double,
+          typename FI   = PassThru<Tin>,
+          typename FO   = PassThru<Tout>>
+void cpu_convolution_backward_weight_blocked(std::size_t spatial_dim,
+                                             const tensor<Tin>& in,
+                                             tensor<Twei>& wei,
+                                             const tensor<Tout>& out,
+                                             const Range& pads,
+                                             const Range& strides,
+                                             const Range& dilations,
+                                             std::size_t group_count,
+                                             FI fi = {},
+                                             FO fo = {})
+{
+    if(!conv::blocked::IsApplicable(spatial_dim, in, wei, out))
+    {
+        cpu_convolution_backward_weight<Tin, Twei, Tout, Range, Tacc>(
+            spatial_dim, in, wei, out, pads, strides, dilations, group_count, fi, fo);
+        return;
+    }
+
+    switch(spatial_dim)
+    {
+    case 1:
+        conv::blocked::BackwardWeights<1, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fi, fo);
+        break;
+    case 2:
+        conv::blocked::BackwardWeights<2, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fi, fo);
+        break;
+    default:
+        conv::blocked::BackwardWeights<3, Tacc>(
+            in, wei, out, pads, strides, dilations, group_count, fi, fo);
+        break;
+    }
+}
+
+#endif // GUARD_DRIVER_CONV_CPU_BLOCKED_HPP
@@ -29,6 +29,7 @@
 #include "InputFlags.hpp"
 #include "conv_verify.hpp"
 #include "conv_common.hpp"
+#include "conv_cpu_blocked.hpp"
 #include "driver.hpp"
 #include "mloConvHost.hpp"
 #include "random.hpp"
@@ -237,6 +238,15 @@ public:
     auto GetDevicePtr() -> auto { return dev->GetMem(); }
 };
 
+/// Shows where a result which failed verification differs from the reference. Elements count
+/// as mismatches when they differ by more than tolerance relative to the largest magnitude,
+/// like the rms error. The magnitude comes from the comparison which computed that error.
+template <typename R1, typename R2>
+void PrintVerificationMismatches(const R1& ref, const R2& out, double tolerance, double magnitude)
+{
+    std::cout << "    " << miopen::compare_ranges(ref, out, tolerance * magnitude) << std::endl;
+}
+
 // Tgpu and Tref are the data-type in GPU memory and CPU memory respectively.
 // They are not necessarily the same as the computation type on GPU or CPU
 template <typename Tgpu, typename Tref>
@@ -459,7 +469,9 @@ private:
         BwdBias
     };
 
-    std::string GetVerificationCacheFileName(const Direction& direction) const;
+    std::string GetVerificationCacheProblem(const Direction& direction) const;
+    miopen::VerificationCacheKey GetVerificationCacheKey(const Direction& direction) const;
+    miopen::VerificationCache GetVerificationCache() const override;
     bool IsInputTensorTransform() const;
 
     bool TryReadVerificationCache(const Direction& direction,
@@ -932,7 +944,8 @@ int ConvDriver<Tgpu, Tref>::AddCmdLineArgs()
     inflags.AddInputFlag("verification_cache",
                          'C',
                          "",
-                         "Use specified directory to cache verification data. Off by default.",
+                         "Use specified directory to cache verification data. Falls back to "
+                         "MIOPEN_VERIFICATION_CACHE_DIR, off by default.",
                          "string");
     inflags.AddInputFlag("time", 't', "0", "Time Each Layer (Default=0)", "int");
     inflags.AddInputFlag("wall",
@@ -2259,14 +2272,14 @@ int ConvDriver<Tgpu, Tref>::RunForwardCPU()
 {
     if(mode == miopenTranspose)
     {
-        cpu_convolution_backward_data(miopen::deref(convDesc).GetSpatialDimension(),
-                                      outhost,
-                                      wei.GetTensor(),
-                                      in.GetTensor(),
-                                      miopen::deref(convDesc).GetConvPads(),
-                                      miopen::deref(convDesc).GetConvStrides(),
-                                      miopen::deref(convDesc).GetConvDilations(),
-                                      miopen::deref(convDesc).GetGroupCount());
+        cpu_convolution_backward_data_blocked(miopen::deref(convDesc).GetSpatialDimension(),
+                                              outhost,
+                                              wei.GetTensor(),
+                                              in.GetTensor(),
+                                              miopen::deref(convDesc).GetConvPads(),
+                                              miopen::deref(convDesc).GetConvStrides(),
+                                              miopen::deref(convDesc).GetConvDilations(),
+                                              miopen::deref(convDesc).GetGroupCount());
 
         if(inflags.GetValueInt("bias") != 0)
         {
@@ -2275,14 +2288,14 @@ int ConvDriver<Tgpu, Tref>::RunForwardCPU()
     }
     else
     {
-        cpu_convolution_forward(miopen::deref(convDesc).GetSpatialDimension(),
-                                in.GetTensor(),
-                                wei.GetTensor(),
-                                outhost,
-                                miopen::deref(convDesc).GetConvPads(),
-                                miopen::deref(convDesc).GetConvStrides(),
-                                miopen::deref(convDesc).GetConvDilations(),
-                                miopen::deref(convDesc).GetGroupCount());
+        cpu_convolution_forward_blocked(miopen::deref(convDesc).GetSpatialDimension(),
+                                        in.GetTensor(),
+                                        wei.GetTensor(),
+                                        outhost,
+                                        miopen::deref(convDesc).GetConvPads(),
+                                        miopen::deref(convDesc).GetConvStrides(),
+                                        miopen::deref(convDesc).GetConvDilations(),
+                                        miopen::deref(convDesc).GetGroupCount());
 
         if(inflags.GetValueInt("bias") != 0)
         {
@@ -3152,25 +3165,25 @@ int ConvDriver<Tgpu, Tref>::RunBackwardWeightsCPU()
 {
     if(mode == miopenTranspose)
     {
-        cpu_convolution_backward_weight(miopen::deref(convDesc).GetSpatialDimension(),
-                                        dout.GetTensor(),
-                                        dwei_host,
-                                        in.GetTensor(),
-                                        miopen::deref(convDesc).GetConvPads(),
-                                        miopen::deref(convDesc).GetConvStrides(),
-                                        miopen::deref(convDesc).GetConvDilations(),
-                                        miopen::deref(convDesc).GetGroupCount());
+        cpu_convolution_backward_weight_blocked(miopen::deref(convDesc).GetSpatialDimension(),
+                                                dout.GetTensor(),
+                                                dwei_host,
+                                                in.GetTensor(),
+                                                miopen::deref(convDesc).GetConvPads(),
+                                                miopen::deref(convDesc).GetConvStrides(),
+                                                miopen::deref(convDesc).GetConvDilations(),
+                                                miopen::deref(convDesc).GetGroupCount());
     }
     else
     {
-        cpu_convolution_backward_weight(miopen::deref(convDesc).GetSpatialDimension(),
-                                        in.GetTensor(),
-                                        dwei_host,
-                                        dout.GetTensor(),
-                                        miopen::deref(convDesc).GetConvPads(),
-                                        miopen::deref(convDesc).GetConvStrides(),
-                                        miopen::deref(convDesc).GetConvDilations(),
-                                        miopen::deref(convDesc).GetGroupCount());
+        cpu_convolution_backward_weight_blocked(miopen::deref(convDesc).GetSpatialDimension(),
+                                                in.GetTensor(),
+                                                dwei_host,
+                                                dout.GetTensor(),
+                                                miopen::deref(convDesc).GetConvPads(),
+                                                miopen::deref(convDesc).GetConvStrides(),
+                                                miopen::deref(convDesc).GetConvDilations(),
+                                                miopen::deref(convDesc).GetGroupCount());
     }
 
     if(inflags.GetValueInt("dump_output"))
@@ -3188,25 +3201,25 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataCPU()
 {
     if(mode == miopenTranspose)
     {
-        cpu_convolution_forward(miopen::deref(convDesc).GetSpatialDimension(),
-                                dout.GetTensor(),
-                                wei.GetTensor(),
-                                din_host,
-                                miopen::deref(convDesc).GetConvPads(),
-                                miopen::deref(convDesc).GetConvStrides(),
-                                miopen::deref(convDesc).GetConvDilations(),
-                                miopen::deref(convDesc).GetGroupCount());
+        cpu_convolution_forward_blocked(miopen::deref(convDesc).GetSpatialDimension(),
+                                        dout.GetTensor(),
+                                        wei.GetTensor(),
+                                        din_host,
+                                        miopen::deref(convDesc).GetConvPads(),
+                                        miopen::deref(convDesc).GetConvStrides(),
+                                        miopen::deref(convDesc).GetConvDilations(),
+                                        miopen::deref(convDesc).GetGroupCount());
     }
     else
     {
-        cpu_convolution_backward_data(miopen::deref(convDesc).GetSpatialDimension(),
-                                      din_host,
-                                      wei.GetTensor(),
-                                      dout.GetTensor(),
-                                      miopen::deref(convDesc).GetConvPads(),
-                                      miopen::deref(convDesc).GetConvStrides(),
-                                      miopen::deref(convDesc).GetConvDilations(),
-                                      miopen::deref(convDesc).GetGroupCount());
+        cpu_convolution_backward_data_blocked(miopen::deref(convDesc).GetSpatialDimension(),
+                                              din_host,
+                                              wei.GetTensor(),
+                                              dout.GetTensor(),
+                                              miopen::deref(convDesc).GetConvPads(),
+                                              miopen::deref(convDesc).GetConvStrides(),
+                                              miopen::deref(convDesc).GetConvDilations(),
+                                              miopen::deref(convDesc).GetGroupCount());
     }
 
     if(inflags.GetValueInt("dump_output"))
@@ -3333,7 +3346,7 @@ int ConvDriver<Tgpu, Tref>::RunBackwardDataGPUReference()
 }
 
 template <typename Tgpu, typename Tref>
-std::string ConvDriver<Tgpu, Tref>::GetVerificationCacheFileName(
+std::string ConvDriver<Tgpu, Tref>::GetVerificationCacheProblem(
     const ConvDriver<Tgpu, Tref>::Direction& direction) const
 {
     std::ostringstream ss;
@@ -3418,42 +3431,43 @@ std::string ConvDriver<Tgpu, Tref>::GetVerificationCacheFileName(
     return ss.str();
 }
 
+template <typename Tgpu, typename Tref>
+miopen::VerificationCacheKey ConvDriver<Tgpu, Tref>::GetVerificationCacheKey(
+    const ConvDriver<Tgpu, Tref>::Direction& direction) const
+{
+    // Data types are part of the problem string.
+    return {"conv", GetVerificationCacheProblem(direction), prng::details::get_default_seed(), ""};
+}
+
+template <typename Tgpu, typename Tref>
+miopen::VerificationCache ConvDriver<Tgpu, Tref>::GetVerificationCache() const
+{
+    // Keys only cover inputs generated from the seed.
+    for(const auto& flag : {"in_data", "weights", "in_bias", "dout_data"})
+        if(!inflags.GetValueStr(flag).empty())
+            return {};
+
+    const auto verification_cache_path = inflags.GetValueStr("verification_cache");
+    if(verification_cache_path.empty())
+        return Driver::GetVerificationCache();
+    return miopen::VerificationCache{verification_cache_path};
+}
+
 template <typename Tgpu, typename Tref>
 bool ConvDriver<Tgpu, Tref>::TryReadVerificationCache(
     const ConvDriver<Tgpu, Tref>::Direction& direction,
     miopenTensorDescriptor_t& tensorDesc,
     Tref* data) const
 {
-    const auto verification_cache_path = inflags.GetValueStr("verification_cache");
-
-    if(!verification_cache_path.empty())
-    {
-        const auto file_path =
-            verification_cache_path + "/" + GetVerificationCacheFileName(direction);
-
-        if(std::ifstream(file_path).good())
-        {
-            if(readBufferFromFile<Tref>(data, GetTensorSize(tensorDesc), file_path.c_str()))
-            {
-                return true;
-            }
-        }
-    }
-
-    return false;
+    return GetVerificationCache().Load(
+        GetVerificationCacheKey(direction), data, GetTensorSize(tensorDesc));
 }
 
 template <typename Tgpu, typename Tref>
 void ConvDriver<Tgpu, Tref>::TrySaveVerificationCache(
     const ConvDriver<Tgpu, Tref>::Direction& direction, std::vector<Tref>& data) const
 {
-    const auto verification_cache_path = inflags.GetValueStr("verification_cache");
-    if(!verification_cache_path.empty())
-    {
-        const auto file_path =
-            verification_cache_path + "/" + GetVerificationCacheFileName(direction);
-        dumpBufferToFile<Tref>(file_path.c_str(), data.data(), data.size());
-    }
+    GetVerificationCache().Store(GetVerificationCacheKey(direction), data);
 }
 
 template <typename Tgpu, typename Tref>
@@ -3474,9 +3488,10 @@ int ConvDriver<Tgpu, Tref>::VerifyForward()
         }
 
     const auto isInt8 = (data_type == miopenInt8 || data_type == miopenInt8x4);
-    auto error        = is_fwd_run_failed ? std::numeric_limits<double>::max()
-                                          : (isInt8 ? miopen::rms_range(outhost.data, out_int8)
-                                                    : miopen::rms_range(outhost.data, out.GetVector()));
+    const auto stats  = is_fwd_run_failed ? miopen::error_stats{}
+                        : isInt8          ? miopen::compare_ranges(outhost.data, out_int8)
+                                          : miopen::compare_ranges(outhost.data, out.GetVector());
+    auto error        = is_fwd_run_failed ? std::numeric_limits<double>::max() : stats.rms;
 
     auto tolerance = GetDefaultTolerance();
     // iGemm's deviation is higher than other algorithms.
@@ -3487,6 +3502,14 @@ int ConvDriver<Tgpu, Tref>::VerifyForward()
     if(!std::isfinite(error) || error > tolerance)
     {
         std::cout << "Forward Convolution FAILED: " << error << " > " << tolerance << std::endl;
+        if(!is_fwd_run_failed)
+        {
+            if(isInt8)
+                PrintVerificationMismatches(outhost.data, out_int8, tolerance, stats.magnitude);
+            else
+                PrintVerificationMismatches(
+                    outhost.data, out.GetVector(), tolerance, stats.magnitude);
+        }
         return EC_VerifyFwd;
     }
 
@@ -3522,8 +3545,10 @@ int ConvDriver<Tgpu, Tref>::VerifyBackward()
                     RunBackwardDataCPU();
             }
 
-        auto error_data = is_bwd_run_failed ? std::numeric_limits<double>::max()
-                                            : miopen::rms_range(din_host.data, din.GetVector());
+        const auto stats = is_bwd_run_failed
+                               ? miopen::error_stats{}
+                               : miopen::compare_ranges(din_host.data, din.GetVector());
+        auto error_data  = is_bwd_run_failed ? std::numeric_limits<double>::max() : stats.rms;
 
         auto tolerance = GetDefaultTolerance();
         // iGemm's deviation is higher than other algorithms.
@@ -3535,6 +3560,9 @@ int ConvDriver<Tgpu, Tref>::VerifyBackward()
         {
             std::cout << "Backward Convolution Data FAILED: " << error_data << " > " << tolerance
                       << std::endl;
+            if(!is_bwd_run_failed)
+                PrintVerificationMismatches(
+                    din_host.data, din.GetVector(), tolerance, stats.magnitude);
             cumulative_rc |= EC_VerifyBwd;
         }
         else
@@ -3584,14 +3612,18 @@ int ConvDriver<Tgpu, Tref>::VerifyBackward()
         if(std::is_same<Tgpu, bfloat8>::value)
             tolerance = tolerance * 2;
 
-        auto error_weights = is_wrw_run_failed
-                                 ? std::numeric_limits<double>::max()
-                                 : miopen::rms_range(dwei_host.data, dwei.GetVector());
+        const auto stats   = is_wrw_run_failed
+                                 ? miopen::error_stats{}
+                                 : miopen::compare_ranges(dwei_host.data, dwei.GetVector());
+        auto error_weights = is_wrw_run_failed ? std::numeric_limits<double>::max() : stats.rms;
 
         if(!std::isfinite(error_weights) || error_weights > tolerance)
         {
             std::cout << "Backward Convolution Weights FAILED: " << error_weights << " > "
                       << tolerance << std::endl;
+            if(!is_wrw_run_failed)
+                PrintVerificationMismatches(
+                    dwei_host.data, dwei.GetVector(), tolerance, stats.magnitude);
             cumulative_rc |= EC_VerifyWrw;
         }
         else
@@ -3609,12 +3641,14 @@ int ConvDriver<Tgpu, Tref>::VerifyBackward()
             RunBackwardBiasCPU();
         }
 
-        auto error_bias      = miopen::rms_range(db_host.data, db.GetVector());
+        const auto stats     = miopen::compare_ranges(db_host.data, db.GetVector());
+        auto error_bias      = stats.rms;
         const auto tolerance = GetDefaultTolerance();
         if(!std::isfinite(error_bias) || error_bias > tolerance)
         {
             std::cout << "Backward Convolution Bias FAILED: " << error_bias << " > " << tolerance
                       << std::endl;
+            PrintVerificationMismatches(db_host.data, db.GetVector(), tolerance, stats.magnitude);
             cumulative_rc |= EC_VerifyBwdBias;
         }
         else
@@ -37,8 +37,10 @@
 #include <memory>
 #include <miopen/logger.hpp>
 #include <miopen/miopen.h>
+#include <miopen/problem_description_base.hpp>
 #include <miopen/bfloat16.hpp>
 #include <../test/tensor_holder.hpp>
+#include <../test/verification_cache.hpp>
 #include "util_driver.hpp"
 #include "rocrand_wrapper.hpp"
 using half         = half_float::half;
@@ -303,9 +305,10 @@ inline void PadBufferSize(size_t& sz, int datatype_sz)
     }
 }
 
-[[noreturn]] inline void Usage()
+inline void PrintUsage()
 {
     printf("Usage: ./driver *base_arg* *other_args*\n");
+    printf("       ./driver --batch *commands_file* [--format csv|json] [--output *file*]\n");
     printf("Supported Base Arguments: conv[fp16|int8|bfp16], pool[fp16], lrn[fp16], "
            "activ[fp16], softmax[fp16], bnorm[fp16], rnn[fp16], gemm[fp16], ctc, dropout[fp16], "
            "tensorop, reduce[fp16|fp64], layernorm[bfp16|fp16], sum[bfp16|fp16], "
@@ -315,6 +318,11 @@ inline void PadBufferSize(size_t& sz, int datatype_sz)
            "getitem[bfp16|fp16], reducecalculation[bfp16|fp16], rope[bfp16|fp16], "
            "prelu[bfp16|fp16], kthvalue[bfp16|fp16], glu[bfp16|fp16], softmarginloss[bfp16|fp16], "
            "multimarginloss[bfp16|fp16]\n");
+}
+
+[[noreturn]] inline void Usage()
+{
+    PrintUsage();
     exit(0); // NOLINT (concurrency-mt-unsafe)
 }
 
@@ -351,7 +359,7 @@ inline std::string ParseBaseArg(int argc, char* argv[])
        arg != "kthvaluebfp16" && arg != "glu" && arg != "glufp16" && arg != "glubfp16" &&
        arg != "softmarginloss" && arg != "softmarginlossfp16" && arg != "softmarginlossbfp16" &&
        arg != "multimarginloss" && arg != "multimarginlossfp16" && arg != "multimarginlossbfp16" &&
-       arg != "--version")
+       arg != "--version" && arg != "--batch")
     {
         printf("FAILED: Invalid Base Input Argument\n");
         Usage();
@@ -368,15 +376,35 @@ public:
     Driver()
     {
         data_type = miopenFloat;
+        handle    = SharedHandle();
+        if(handle == nullptr)
+        {
+            handle      = CreateHandle();
+            owns_handle = true;
+        }
+
+        miopenGetStream(handle, &q);
+    }
+
+    static miopenHandle_t CreateHandle()
+    {
+        miopenHandle_t h = nullptr;
 #if MIOPEN_BACKEND_OPENCL
-        miopenCreate(&handle);
+        miopenCreate(&h);
 #elif MIOPEN_BACKEND_HIP
         hipStream_t s;
         hipStreamCreate(&s);
-        miopenCreateWithStream(&handle, s);
+        miopenCreateWithStream(&h, s);
 #endif
+        return h;
+    }
 
-        miopenGetStream(handle, &q);
+    /// When set, drivers use this handle instead of creating their own one and do not destroy
+    /// it. The batch mode uses it to run many commands with the same handle and its caches.
+    static miopenHandle_t& SharedHandle()
+    {
+        static miopenHandle_t shared = nullptr;
+        return shared;
     }
 
     miopenHandle_t GetHandle() { return handle; }
@@ -387,7 +415,11 @@ public:
 #elif MIOPEN_BACKEND_HIP
     hipStream_t& GetStream() { return q; }
 #endif
-    virtual ~Driver() { miopenDestroy(handle); }
+    virtual ~Driver()
+    {
+        if(owns_handle)
+            miopenDestroy(handle);
+    }
 
     // TODO: add timing APIs
     virtual int AddCmdLineArgs()                         = 0;
@@ -401,10 +433,35 @@ public:
     virtual int VerifyBackward()                         = 0;
 
 protected:
+    /// Cache of host reference results. It is off unless MIOPEN_VERIFICATION_CACHE_DIR is set;
+    /// drivers with a --verification_cache flag use that directory instead.
+    virtual miopen::VerificationCache GetVerificationCache() const
+    {
+        return miopen::VerificationCache::FromEnv();
+    }
+
+    /// Loads the reference result of the problem from the cache, or computes it with
+    /// compute() and stores it. The inputs must be generated from the driver PRNG seed.
+    template <typename Tref, typename F>
+    void LoadOrComputeReference(const std::string& op,
+                                const std::string& problem,
+                                std::vector<Tref>& ref,
+                                F compute) const
+    {
+        const auto key = miopen::VerificationCacheKey{
+            op,
+            problem,
+            prng::details::get_default_seed(),
+            miopen::GetDataTypeName(data_type) + "_" + std::to_string(sizeof(Tref))};
+        if(GetVerificationCache().LoadOrCompute(key, ref, compute))
+            std::cout << "Loaded " << op << " reference from the verification cache" << std::endl;
+    }
+
     template <typename Tgpu>
     void InitDataType();
     miopenHandle_t handle;
     miopenDataType_t data_type;
+    bool owns_handle = false;
 
 #if MIOPEN_BACKEND_OPENCL
     cl_command_queue q;
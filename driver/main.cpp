@@ -29,28 +29,38 @@
 #include <miopen/config.h>
 #include <miopen/stringutils.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 
-int main(int argc, char* argv[])
-{
+namespace {
 
-    std::string base_arg = ParseBaseArg(argc, argv);
+using Clock = std::chrono::steady_clock;
 
-    if(base_arg == "--version")
-    {
-        size_t major, minor, patch;
-        miopenGetVersion(&major, &minor, &patch);
-        std::cout << "MIOpen (version: " << major << "." << minor << "." << patch << ")"
-                  << std::endl;
-        exit(0); // NOLINT (concurrency-mt-unsafe)
-    }
+double MsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
 
-    // show command
-    std::cout << "MIOpenDriver";
-    for(int i = 1; i < argc; i++)
-        std::cout << " " << argv[i];
-    std::cout << std::endl;
+struct RunTimes
+{
+    double setup_ms  = 0.0;
+    double run_ms    = 0.0;
+    double verify_ms = 0.0;
+};
+
+/// Returns nothing for an unknown base argument.
+std::shared_ptr<Driver> MakeDriver(const std::string& base_arg)
+{
+    // Every command of a batch generates the same data as when run on its own, which also
+    // keeps the keys of the verification cache valid.
+    prng::reset_seed();
 
     std::shared_ptr<Driver> drv;
     for(auto f : rdm::GetRegistry())
@@ -59,11 +69,16 @@ int main(int argc, char* argv[])
         if(drv != nullptr)
             break;
     }
-    if(drv == nullptr)
-    {
-        printf("Incorrect BaseArg\n");
-        exit(0); // NOLINT (concurrency-mt-unsafe)
-    }
+    return drv;
+}
+
+int RunDriver(const std::shared_ptr<Driver>& drv,
+              int argc,
+              char* argv[],
+              const std::string& base_arg,
+              RunTimes& times)
+{
+    auto start = Clock::now();
 
     drv->AddCmdLineArgs();
     int rc = drv->ParseCmdLineArgs(argc, argv);
@@ -79,6 +94,7 @@ int main(int argc, char* argv[])
         std::cout << "AllocateBuffersAndCopy() FAILED, rc = " << rc << std::endl;
         return rc;
     }
+    times.setup_ms = MsSince(start);
 
     int fargval =
         !miopen::StartsWith(base_arg, "CBAInfer") ? drv->GetInputFlags().GetValueInt("forw") : 1;
@@ -86,27 +102,325 @@ int main(int argc, char* argv[])
     bool verifyarg    = (drv->GetInputFlags().GetValueInt("verify") == 1);
     int cumulative_rc = 0; // Do not stop running tests in case of errors.
 
+    const auto verify = [&](auto&& f) {
+        auto verify_start = Clock::now();
+        cumulative_rc |= f();
+        times.verify_ms += MsSince(verify_start);
+    };
+
     if(fargval & 1 || fargval == 0 || bnFwdInVer)
     {
-        rc = drv->RunForwardGPU();
+        auto run_start = Clock::now();
+        rc             = drv->RunForwardGPU();
+        times.run_ms += MsSince(run_start);
         cumulative_rc |= rc;
         if(rc != 0)
             std::cout << "RunForwardGPU() FAILED, rc = "
                       << "0x" << std::hex << rc << std::dec << std::endl;
         if(verifyarg) // Verify even if Run() failed.
-            cumulative_rc |= drv->VerifyForward();
+            verify([&]() { return drv->VerifyForward(); });
     }
 
     if(fargval != 1)
     {
-        rc = drv->RunBackwardGPU();
+        auto run_start = Clock::now();
+        rc             = drv->RunBackwardGPU();
+        times.run_ms += MsSince(run_start);
         cumulative_rc |= rc;
         if(rc != 0)
             std::cout << "RunBackwardGPU() FAILED, rc = "
                       << "0x" << std::hex << rc << std::dec << std::endl;
         if(verifyarg) // Verify even if Run() failed.
-            cumulative_rc |= drv->VerifyBackward();
+            verify([&]() { return drv->VerifyBackward(); });
+    }
+
+    return cumulative_rc;
+}
+
+/// Splits a command line into arguments. Quotes group arguments containing spaces.
+std::vector<std::string> SplitCommand(const std::string& line)
+{
+    std::vector<std::string> args;
+    std::string current;
+    bool in_arg = false;
+    char quote  = 0;
+    for(const char c : line)
+    {
+        if(quote != 0)
+        {
+            if(c == quote)
+                quote = 0;
+            else
+                current += c;
+        }
+        else if(c == '"' || c == '\'')
+        {
+            quote  = c;
+            in_arg = true;
+        }
+        else if(std::isspace(static_cast<unsigned char>(c)) != 0)
+        {
+            if(in_arg)
+                args.push_back(std::move(current));
+            current.clear();
+            in_arg = false;
+        }
+        else
+        {
+            current += c;
+            in_arg = true;
+        }
+    }
+    if(in_arg)
+        args.push_back(std::move(current));
+    return args;
+}
+
+/// Accepts plain driver command lines ("conv -n 1 ...", "./bin/MIOpenDriver conv ...") as well as
+/// lines logged with MIOPEN_ENABLE_LOGGING_CMD, which carry a prefix before the driver name.
+/// Returns the arguments starting from the base argument, or nothing for lines to be skipped.
+std::vector<std::string> ParseBatchLine(const std::string& line)
+{
+    auto args = SplitCommand(line);
+    if(args.empty() || miopen::StartsWith(args.front(), "#"))
+        return {};
+
+    const auto is_driver = [](const std::string& arg) {
+        return miopen::EndsWith(arg, "MIOpenDriver") || miopen::EndsWith(arg, "MIOpenDriver.exe");
+    };
+    const auto driver = std::find_if(args.begin(), args.end(), is_driver);
+    if(driver != args.end())
+        args.erase(args.begin(), driver + 1);
+    else if(line.find("Command [") != std::string::npos)
+        return {}; // Logged command for another tool.
+    return args;
+}
+
+struct BatchResult
+{
+    std::size_t line = 0;
+    std::string command;
+    int rc = 0;
+    std::string error;
+    RunTimes times;
+    double total_ms = 0.0;
+};
+
+std::string CsvQuote(const std::string& str)
+{
+    std::string out = "\"";
+    for(const char c : str)
+    {
+        if(c == '"')
+            out += '"';
+        out += c;
+    }
+    return out + "\"";
+}
+
+std::string JsonQuote(const std::string& str)
+{
+    std::string out = "\"";
+    for(const char c : str)
+    {
+        if(c == '"' || c == '\\')
+            out += '\\';
+        if(static_cast<unsigned char>(c) < 0x20)
+            out += ' ';
+        else
+            out += c;
+    }
+    return out + "\"";
+}
+
+void WriteBatchReport(std::ostream& os,
+                      const std::string& format,
+                      const std::vector<BatchResult>& results,
+                      double handle_ms,
+                      double total_ms)
+{
+    std::size_t failed = 0;
+    double run_ms      = 0.0;
+    for(const auto& r : results)
+    {
+        failed += r.rc != 0 ? 1 : 0;
+        run_ms += r.times.run_ms;
+    }
+    const auto passed   = results.size() - failed;
+    const auto per_sec  = total_ms > 0.0 ? results.size() * 1000.0 / total_ms : 0.0;
+    const auto avg_line = results.empty() ? 0.0 : (total_ms - handle_ms) / results.size();
+
+    os << std::fixed << std::setprecision(3);
+    if(format == "json")
+    {
+        os << "{\n  \"results\": [";
+        for(std::size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& r = results[i];
+            os << (i == 0 ? "\n" : ",\n") << "    {\"line\": " << r.line
+               << ", \"command\": " << JsonQuote(r.command) << ", \"rc\": " << r.rc
+               << ", \"error\": " << JsonQuote(r.error) << ", \"setup_ms\": " << r.times.setup_ms
+               << ", \"run_ms\": " << r.times.run_ms << ", \"verify_ms\": " << r.times.verify_ms
+               << ", \"total_ms\": " << r.total_ms << "}";
+        }
+        os << "\n  ],\n  \"summary\": {\"commands\": " << results.size()
+           << ", \"passed\": " << passed << ", \"failed\": " << failed
+           << ", \"handle_ms\": " << handle_ms << ", \"run_ms\": " << run_ms
+           << ", \"total_ms\": " << total_ms << ", \"avg_command_ms\": " << avg_line
+           << ", \"commands_per_sec\": " << per_sec << "}\n}" << std::endl;
+        return;
+    }
+
+    os << "line,command,rc,error,setup_ms,run_ms,verify_ms,total_ms\n";
+    for(const auto& r : results)
+    {
+        os << r.line << "," << CsvQuote(r.command) << "," << r.rc << "," << CsvQuote(r.error)
+           << "," << r.times.setup_ms << "," << r.times.run_ms << "," << r.times.verify_ms << ","
+           << r.total_ms << "\n";
+    }
+    os << "# commands=" << results.size() << " passed=" << passed << " failed=" << failed
+       << " handle_ms=" << handle_ms << " run_ms=" << run_ms << " total_ms=" << total_ms
+       << " avg_command_ms=" << avg_line << " commands_per_sec=" << per_sec << std::endl;
+}
+
+/// Runs every command listed in a file within this process using one shared handle, so that
+/// handle creation, database loading and kernel compilation are paid only once. The report
+/// lists each command and the aggregate throughput.
+int RunBatch(int argc, char* argv[])
+{
+    if(argc < 3)
+    {
+        printf("FAILED: Missing batch commands file\n");
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    const std::string path = argv[2];
+    std::string format     = "csv";
+    std::string output;
+    for(int i = 3; i < argc; i += 2)
+    {
+        const std::string opt = argv[i];
+        if(i + 1 >= argc || (opt != "--format" && opt != "--output"))
+        {
+            printf("FAILED: Invalid batch argument: %s\n", opt.c_str());
+            PrintUsage();
+            return EXIT_FAILURE;
+        }
+        (opt == "--format" ? format : output) = argv[i + 1];
+    }
+    if(format != "csv" && format != "json")
+    {
+        printf("FAILED: Invalid batch report format: %s\n", format.c_str());
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream file(path);
+    if(!file)
+    {
+        std::cout << "Cannot open batch commands file: " << path << std::endl;
+        return 1;
     }
 
+    // A wrong command fails its own line only
+    InputFlags::ThrowOnError() = true;
+
+    const auto start       = Clock::now();
+    Driver::SharedHandle() = Driver::CreateHandle();
+    const auto handle_ms   = MsSince(start);
+    std::vector<BatchResult> results;
+    int cumulative_rc = 0;
+
+    std::string line;
+    for(std::size_t line_num = 1; std::getline(file, line); ++line_num)
+    {
+        auto args = ParseBatchLine(line);
+        if(args.empty())
+            continue;
+
+        BatchResult result;
+        result.line    = line_num;
+        result.command = args.front();
+        for(auto it = args.begin() + 1; it != args.end(); ++it)
+            result.command += " " + *it;
+        std::cout << "MIOpenDriver " << result.command << std::endl;
+
+        args.insert(args.begin(), "MIOpenDriver");
+        std::vector<char*> line_argv;
+        for(auto& arg : args)
+            line_argv.push_back(&arg[0]);
+        line_argv.push_back(nullptr);
+
+        const auto line_start = Clock::now();
+        try
+        {
+            const auto drv = MakeDriver(args[1]);
+            if(drv == nullptr)
+                throw std::invalid_argument("Incorrect BaseArg: " + args[1]);
+            const auto line_argc = static_cast<int>(args.size());
+            result.rc = RunDriver(drv, line_argc, line_argv.data(), args[1], result.times);
+        }
+        catch(const std::exception& ex)
+        {
+            result.rc    = 1;
+            result.error = ex.what();
+            std::cout << "Command on line " << line_num << " FAILED: " << ex.what() << std::endl;
+        }
+        result.total_ms = MsSince(line_start);
+        cumulative_rc |= result.rc;
+        results.push_back(std::move(result));
+    }
+
+    miopenDestroy(Driver::SharedHandle());
+    Driver::SharedHandle() = nullptr;
+
+    const auto total_ms = MsSince(start);
+    if(output.empty())
+    {
+        WriteBatchReport(std::cout, format, results, handle_ms, total_ms);
+    }
+    else
+    {
+        std::ofstream report(output);
+        WriteBatchReport(report, format, results, handle_ms, total_ms);
+        std::cout << "Batch report written to " << output << std::endl;
+    }
     return cumulative_rc;
 }
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+
+    std::string base_arg = ParseBaseArg(argc, argv);
+
+    if(base_arg == "--version")
+    {
+        size_t major, minor, patch;
+        miopenGetVersion(&major, &minor, &patch);
+        std::cout << "MIOpen (version: " << major << "." << minor << "." << patch << ")"
+                  << std::endl;
+        exit(0); // NOLINT (concurrency-mt-unsafe)
+    }
+
+    if(base_arg == "--batch")
+        return RunBatch(argc, argv);
+
+    // show command
+    std::cout << "MIOpenDriver";
+    for(int i = 1; i < argc; i++)
+        std::cout << " " << argv[i];
+    std::cout << std::endl;
+
+    const auto drv = MakeDriver(base_arg);
+    if(drv == nullptr)
+    {
+        printf("Incorrect BaseArg\n");
+        exit(0); // NOLINT (concurrency-mt-unsafe)
+    }
+
+    RunTimes times;
+    return RunDriver(drv, argc, argv, base_arg, times);
+}
@@ -44,6 +44,7 @@
 #include <cstdlib>
 #include <memory>
 #include <numeric>
+#include <sstream>
 #include <vector>
 
 template <typename Tgpu, typename Tref>
@@ -370,8 +371,13 @@ int SoftmaxDriver<Tgpu, Tref>::RunBackwardGPU()
 template <typename Tgpu, typename Tref>
 int SoftmaxDriver<Tgpu, Tref>::VerifyForward()
 {
-    mloSoftmaxForwardRunHost<Tgpu, Tref>(
-        inputTensor, outputTensor, in.data(), outhost.data(), alpha, beta, algo, mode);
+    std::ostringstream problem;
+    miopen::LogRange(problem, GetInputTensorLengthsFromCmdLine(), "x");
+    problem << "_" << alpha << "_" << beta << "_" << algo << "_" << mode;
+    LoadOrComputeReference("softmax_fwd", problem.str(), outhost, [&] {
+        mloSoftmaxForwardRunHost<Tgpu, Tref>(
+            inputTensor, outputTensor, in.data(), outhost.data(), alpha, beta, algo, mode);
+    });
 
     auto error           = miopen::rms_range(outhost, out);
     const Tref tolerance = data_type == miopenHalf ? 5e-2 : 1e-3; // 1e-6;
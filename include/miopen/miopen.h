@@ -6007,6 +6007,75 @@ MIOPEN_EXPORT miopenStatus_t miopenGetSolverIdConvAlgorithm(uint64_t solverId,
 
 #ifdef MIOPEN_BETA_API
 
+/*! @brief Statistics of the background compilation started by miopenPrecompileProblems.
+ *
+ * Hits, waits and misses are only counted while some of the problems are still being compiled.
+ */
+typedef struct
+{
+    size_t queued;    /*!< Problems submitted for compilation */
+    size_t completed; /*!< Problems compiled */
+    size_t failed;    /*!< Problems which compilation has failed */
+    size_t hits;   /*!< Calls that needed a precompiled problem which was ready at that moment */
+    size_t waits;  /*!< Calls that needed a precompiled problem and waited for its compilation */
+    size_t misses; /*!< Calls that needed a problem which was not submitted for compilation */
+} miopenPrecompileStats_t;
+
+/*! @brief Starts compiling the best known solutions of the problems on background threads.
+ *
+ * Solutions are looked up the same way as by miopenConvolutionForwardGetSolution and similar
+ * functions. The first immediate mode call for a problem waits for its compilation to complete,
+ * calls for other problems don't wait. Only convolution problems are supported, others are skipped.
+ *
+ * The same can be done at handle creation by setting the MIOPEN_PRECOMPILE_MANIFEST environment
+ * variable to a JSON file with an array of problems.
+ *
+ * @param handle      Handle to compile the kernels for
+ * @param numProblems Amount of problems
+ * @param problems    Problems to compile
+ * @return            miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenPrecompileProblems(miopenHandle_t handle,
+                                                      size_t numProblems,
+                                                      const miopenProblem_t* problems);
+
+/*! @brief Reads the statistics of the background compilation of the handle.
+ *
+ * @param handle Handle to get the statistics of
+ * @param stats  Pointer to a location where to write the statistics
+ * @return       miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetPrecompileStats(miopenHandle_t handle,
+                                                      miopenPrecompileStats_t* stats);
+
+/*! @brief Finds solutions to several problems at once, e.g. to all the layers of a network.
+ *
+ * Works as miopenFindSolutions called for each of the problems, but identical problems are
+ * searched once, and the kernels of the convolution problems are compiled on background threads
+ * while the preceding problems are being evaluated on the device.
+ *
+ * @param handle                 Handle to execute the kernels
+ * @param numProblems            Amount of problems
+ * @param problems               Problems to solve
+ * @param options                Find options. When null default values would be used
+ * @param solutions              Pointer to the first result. Results of the i-th problem start at
+ *                               solutions + i * maxSolutionsPerProblem. Must not be null
+ * @param numSolutions           Amounts of results of each problem. Ignored if null
+ * @param maxSolutionsPerProblem Limits the amount of results of each problem
+ * @return                       miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenFindSolutionsBatch(miopenHandle_t handle,
+                                                      size_t numProblems,
+                                                      const miopenProblem_t* problems,
+                                                      miopenFindOptions_t options,
+                                                      miopenSolution_t* solutions,
+                                                      size_t* numSolutions,
+                                                      size_t maxSolutionsPerProblem);
+
+#endif // MIOPEN_BETA_API
+
+#ifdef MIOPEN_BETA_API
+
 /*! @brief Initializes a problem object describing an activation operation.
  * @note As of now there is no way to actually get any solution for this kind of problems.
  *
@@ -0,0 +1,163 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/applicability_index.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Measures the host time of enumerating the applicable convolution solvers for a set of typical
+// problems, as GetSolutions and Find do for problems without a find-db record, with the direct
+// IsApplicable() checks and through the applicability index. The first pass over the index
+// pays for the checks the constraints can not answer, the next ones are served from memory.
+// Runs on the nogpu backend as well. MLIR solvers are skipped, since their checks may run the
+// compiler.
+
+namespace miopen {
+namespace applicability_index {
+
+struct Shape
+{
+    std::size_t c, h, w, k, y, x, stride;
+};
+
+constexpr Shape shapes[] = {
+    {64, 56, 56, 64, 3, 3, 1},
+    {64, 56, 56, 256, 1, 1, 1},
+    {128, 28, 28, 128, 3, 3, 1},
+    {256, 56, 56, 512, 1, 1, 2},
+    {256, 14, 14, 256, 3, 3, 1},
+    {512, 7, 7, 2048, 1, 1, 1},
+    {3, 224, 224, 64, 7, 7, 2},
+};
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(batch_size, "batch-size");
+        add(iterations, "iterations");
+    }
+
+    void run()
+    {
+        auto& handle   = get_handle();
+        const auto ctx = ExecutionContext{&handle};
+
+        problems.clear();
+        for(const auto& shape : shapes)
+            for(const auto direction : {conv::Direction::Forward,
+                                        conv::Direction::BackwardData,
+                                        conv::Direction::BackwardWeights})
+                for(const auto type : {miopenFloat, miopenHalf})
+                    for(const auto layout : {miopenTensorNCHW, miopenTensorNHWC})
+                        problems.push_back(MakeProblem(shape, direction, type, layout));
+
+        solvers.clear();
+        for(const auto& id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
+            if(id.ToString().find("Mlir") == std::string::npos)
+                solvers.push_back(id);
+
+        const auto expected = Measure("direct", [&](const auto& problem) {
+            auto applicable = std::vector<bool>{};
+            for(const auto& id : solvers)
+                applicable.push_back(id.GetSolver().IsApplicable(ctx, problem));
+            return applicable;
+        });
+
+        conv::ApplicabilityIndex::Get().Clear();
+        const auto stats_before = conv::ApplicabilityIndex::Get().GetStats();
+        for(const auto* name : {"index, first", "index"})
+        {
+            const auto actual = Measure(name, [&](const auto& problem) {
+                const auto query = conv::ApplicabilityQuery{ctx, problem};
+                auto applicable  = std::vector<bool>{};
+                for(const auto& id : solvers)
+                    applicable.push_back(query.IsApplicable(id));
+                return applicable;
+            });
+            if(actual != expected)
+            {
+                std::cerr << "Results of the index differ from the direct checks." << std::endl;
+                std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+            }
+        }
+
+        const auto stats = conv::ApplicabilityIndex::Get().GetStats();
+        std::cout << "Checks pruned: " << stats.pruned - stats_before.pruned
+                  << ", memoized: " << stats.memoized - stats_before.memoized
+                  << ", evaluated: " << stats.evaluated - stats_before.evaluated << std::endl;
+    }
+
+private:
+    int batch_size = 16;
+    int iterations = 10;
+    std::vector<conv::ProblemDescription> problems;
+    std::vector<solver::Id> solvers;
+
+    conv::ProblemDescription MakeProblem(const Shape& shape,
+                                         conv::Direction direction,
+                                         miopenDataType_t type,
+                                         miopenTensorLayout_t layout) const
+    {
+        const auto n     = static_cast<std::size_t>(batch_size);
+        const auto pad   = static_cast<int>(shape.y / 2);
+        const auto out_h = (shape.h + 2 * pad - shape.y) / shape.stride + 1;
+        const auto out_w = (shape.w + 2 * pad - shape.x) / shape.stride + 1;
+        const auto u     = static_cast<int>(shape.stride);
+        // Lengths are in the NCHW order whatever the layout is
+        return {TensorDescriptor{type, layout, {n, shape.c, shape.h, shape.w}},
+                TensorDescriptor{type, layout, {shape.k, shape.c, shape.y, shape.x}},
+                TensorDescriptor{type, layout, {n, shape.k, out_h, out_w}},
+                ConvolutionDescriptor{{pad, pad}, {u, u}, {1, 1}},
+                direction};
+    }
+
+    /// Returns the results of the first pass, which is timed on its own.
+    template <class F>
+    std::vector<std::vector<bool>> Measure(const char* name, F enumerate) const
+    {
+        auto first = std::vector<std::vector<bool>>{};
+        first.reserve(problems.size());
+        auto start = std::chrono::steady_clock::now();
+        for(const auto& problem : problems)
+            first.push_back(enumerate(problem));
+        const auto first_us = Elapsed(start, 1);
+
+        start = std::chrono::steady_clock::now();
+        for(auto i = 1; i < iterations; ++i)
+            for(const auto& problem : problems)
+                enumerate(problem);
+        const auto repeat_us = iterations > 1 ? Elapsed(start, iterations - 1) : 0.0;
+
+        std::cout << std::setw(14) << name << ": " << std::fixed << std::setprecision(1)
+                  << first_us << " us per problem on the first pass, " << repeat_us
+                  << " us on the next ones" << std::endl;
+        return first;
+    }
+
+    double Elapsed(std::chrono::steady_clock::time_point start, int passes) const
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() /
+               (static_cast<double>(passes) * problems.size());
+    }
+};
+
+} // namespace applicability_index
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::applicability_index::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <../driver/conv_cpu_blocked.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace miopen {
+namespace conv_cpu_ref {
+
+// Compares the driver's blocked host convolutions with the generic ones from test/cpu_conv.hpp.
+// The default problem is a 3x3 layer from the middle of ResNet-50.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(n, "n");
+        add(c, "c");
+        add(k, "k");
+        add(hw, "hw");
+        add(filter, "filter");
+        add(group_count, "group-count");
+        add(nhwc, "nhwc");
+    }
+
+    void run()
+    {
+        const auto pad = filter / 2;
+        const std::vector<int> pads{pad, pad};
+        const std::vector<int> strides{1, 1};
+        const std::vector<int> dilations{1, 1};
+        const auto layout = nhwc ? miopenTensorNHWC : miopenTensorNCHW;
+
+        const auto in  = Make(layout, {n, c, hw, hw});
+        const auto wei = Make(layout, {k, c / group_count, filter, filter});
+        const auto out = Make(layout, {n, k, hw, hw});
+
+        std::cout << std::setw(8) << "dir" << std::setw(14) << "generic ms" << std::setw(14)
+                  << "blocked ms" << std::setw(10) << "speedup" << std::setw(14) << "max diff"
+                  << std::endl;
+
+        auto fwd_ref = out;
+        auto fwd     = out;
+        Report("fwd",
+               Measure([&]() {
+                   cpu_convolution_forward(
+                       2, in, wei, fwd_ref, pads, strides, dilations, group_count);
+               }),
+               Measure([&]() {
+                   cpu_convolution_forward_blocked(
+                       2, in, wei, fwd, pads, strides, dilations, group_count);
+               }),
+               MaxDiff(fwd, fwd_ref));
+
+        auto bwd_ref = in;
+        auto bwd     = in;
+        Report("bwd",
+               Measure([&]() {
+                   cpu_convolution_backward_data(
+                       2, bwd_ref, wei, out, pads, strides, dilations, group_count);
+               }),
+               Measure([&]() {
+                   cpu_convolution_backward_data_blocked(
+                       2, bwd, wei, out, pads, strides, dilations, group_count);
+               }),
+               MaxDiff(bwd, bwd_ref));
+
+        auto wrw_ref = wei;
+        auto wrw     = wei;
+        Report("wrw",
+               Measure([&]() {
+                   cpu_convolution_backward_weight(
+                       2, in, wrw_ref, out, pads, strides, dilations, group_count);
+               }),
+               Measure([&]() {
+                   cpu_convolution_backward_weight_blocked(
+                       2, in, wrw, out, pads, strides, dilations, group_count);
+               }),
+               MaxDiff(wrw, wrw_ref));
+    }
+
+private:
+    int n           = 4;
+    int c           = 128;
+    int k           = 128;
+    int hw          = 28;
+    int filter      = 3;
+    int group_count = 1;
+    bool nhwc       = false;
+
+    static tensor<float> Make(miopenTensorLayout_t layout, const std::vector<int>& lens)
+    {
+        auto t = tensor<float>{layout, lens};
+        for(std::size_t i = 0; i < t.data.size(); ++i)
+            t.data[i] = static_cast<float>((i * 7919) % 1000) / 1000.0f - 0.5f;
+        return t;
+    }
+
+    static double MaxDiff(const tensor<float>& a, const tensor<float>& b)
+    {
+        double diff = 0.0;
+        for(std::size_t i = 0; i < a.data.size(); ++i)
+            diff = std::max(diff, std::abs(double(a.data[i]) - double(b.data[i])));
+        return diff;
+    }
+
+    static void Report(const char* dir, double generic_ms, double blocked_ms, double diff)
+    {
+        std::cout << std::setw(8) << dir << std::setw(14) << generic_ms << std::setw(14)
+                  << blocked_ms << std::setw(10) << generic_ms / blocked_ms << std::setw(14)
+                  << diff << std::endl;
+    }
+
+    template <class F>
+    static double Measure(F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+};
+
+} // namespace conv_cpu_ref
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::conv_cpu_ref::SpeedTestDriver>(argc, argv);
+    return 0;
+}
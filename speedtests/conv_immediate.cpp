@@ -0,0 +1,152 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/miopen.h>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Measures the host side overhead of miopenConvolutionForwardImmediate(). Intended to be built
+// with the HIPNOGPU backend, where launching a kernel costs nothing, so the measured time is spent
+// in descriptor validation, network config generation and the invoker lookup.
+
+namespace miopen {
+namespace conv_immediate {
+
+inline void Check(miopenStatus_t status, const char* what)
+{
+    if(status == miopenStatusSuccess)
+        return;
+    std::cerr << what << " has failed: " << miopenGetErrorString(status) << std::endl;
+    std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+}
+
+struct Problem
+{
+    miopenTensorDescriptor_t x = nullptr;
+    miopenTensorDescriptor_t w = nullptr;
+    miopenTensorDescriptor_t y = nullptr;
+    miopenConvSolution_t solution{};
+    std::vector<char> workspace;
+};
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(problems, "problems");
+        add(iterations, "iterations");
+    }
+
+    void run()
+    {
+        miopenHandle_t handle = nullptr;
+        Check(miopenCreate(&handle), "miopenCreate");
+
+        miopenConvolutionDescriptor_t conv = nullptr;
+        Check(miopenCreateConvolutionDescriptor(&conv), "miopenCreateConvolutionDescriptor");
+        Check(miopenInitConvolutionDescriptor(conv, miopenConvolution, 1, 1, 1, 1, 1, 1),
+              "miopenInitConvolutionDescriptor");
+
+        // Every problem gets its own invoker cache entry
+        auto registered = std::vector<Problem>(problems);
+        for(auto i = 0; i < problems; ++i)
+            Prepare(handle, conv, i + 1, registered[i]);
+
+        // Buffers are never touched by the nogpu backend, they only have to be non-null
+        auto data = std::vector<float>(1);
+
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; ++i)
+        {
+            auto& problem = registered[i % problems];
+            Check(miopenConvolutionForwardImmediate(handle,
+                                                    problem.w,
+                                                    data.data(),
+                                                    problem.x,
+                                                    data.data(),
+                                                    conv,
+                                                    problem.y,
+                                                    data.data(),
+                                                    problem.workspace.data(),
+                                                    problem.workspace.size(),
+                                                    problem.solution.solution_id),
+                  "miopenConvolutionForwardImmediate");
+        }
+        const auto time =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << problems << " problems, " << iterations
+                  << " calls: " << time / iterations * 1e6
+                  << " us per miopenConvolutionForwardImmediate call" << std::endl;
+
+        for(auto& problem : registered)
+        {
+            miopenDestroyTensorDescriptor(problem.x);
+            miopenDestroyTensorDescriptor(problem.w);
+            miopenDestroyTensorDescriptor(problem.y);
+        }
+        miopenDestroyConvolutionDescriptor(conv);
+        miopenDestroy(handle);
+    }
+
+private:
+    int problems   = 16;
+    int iterations = 100000;
+
+    static void
+    Prepare(miopenHandle_t handle, miopenConvolutionDescriptor_t conv, int n, Problem& problem)
+    {
+        Check(miopenCreateTensorDescriptor(&problem.x), "miopenCreateTensorDescriptor");
+        Check(miopenCreateTensorDescriptor(&problem.w), "miopenCreateTensorDescriptor");
+        Check(miopenCreateTensorDescriptor(&problem.y), "miopenCreateTensorDescriptor");
+        Check(miopenSet4dTensorDescriptor(problem.x, miopenFloat, n, 64, 28, 28),
+              "miopenSet4dTensorDescriptor");
+        Check(miopenSet4dTensorDescriptor(problem.w, miopenFloat, 64, 64, 3, 3),
+              "miopenSet4dTensorDescriptor");
+
+        auto out = std::vector<int>(4);
+        Check(miopenGetConvolutionForwardOutputDim(
+                  conv, problem.x, problem.w, &out[0], &out[1], &out[2], &out[3]),
+              "miopenGetConvolutionForwardOutputDim");
+        Check(miopenSet4dTensorDescriptor(problem.y, miopenFloat, out[0], out[1], out[2], out[3]),
+              "miopenSet4dTensorDescriptor");
+
+        auto count = std::size_t{0};
+        Check(miopenConvolutionForwardGetSolutionCount(
+                  handle, problem.w, problem.x, conv, problem.y, &count),
+              "miopenConvolutionForwardGetSolutionCount");
+        auto solutions = std::vector<miopenConvSolution_t>(count);
+        Check(miopenConvolutionForwardGetSolution(handle,
+                                                  problem.w,
+                                                  problem.x,
+                                                  conv,
+                                                  problem.y,
+                                                  solutions.size(),
+                                                  &count,
+                                                  solutions.data()),
+              "miopenConvolutionForwardGetSolution");
+        if(count == 0)
+        {
+            std::cerr << "No solutions." << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+
+        problem.solution = solutions[0];
+        problem.workspace.resize(problem.solution.workspace_size + 1);
+        Check(miopenConvolutionForwardCompileSolution(
+                  handle, problem.w, problem.x, conv, problem.y, problem.solution.solution_id),
+              "miopenConvolutionForwardCompileSolution");
+    }
+};
+
+} // namespace conv_immediate
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::conv_immediate::SpeedTestDriver>(argc, argv);
+    return 0;
+}
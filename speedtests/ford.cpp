@@ -0,0 +1,153 @@
+#include <ford.hpp>
+#include <tensor_holder.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+namespace ford {
+
+// What par_ford did before: new threads on every call, each taking a fixed range of indices
+// and decoding every index from scratch.
+struct legacy_par_ford_impl
+{
+    template <class F, class... Ts>
+    void operator()(F f, Ts... xs) const
+    {
+        using array_type = std::array<std::size_t, sizeof...(Ts)>;
+        array_type lens  = {{static_cast<std::size_t>(xs)...}};
+        std::size_t size = 1;
+        for(const auto len : lens)
+            size *= len;
+
+        const auto threads = std::max<std::size_t>(
+            1, std::min<std::size_t>(std::thread::hardware_concurrency(), size / 8));
+        const auto grain = (size + threads - 1) / threads;
+        std::vector<joinable_thread> workers;
+        for(std::size_t start = 0; start < size; start += grain)
+        {
+            workers.emplace_back([&, start]() {
+                for(auto i = start; i < std::min(size, start + grain); ++i)
+                    miopen::unpack(f, ford_decode(lens, i));
+            });
+        }
+    }
+};
+
+static constexpr ford_wrapper<legacy_par_ford_impl> legacy_par_ford{};
+
+// Typical uses of par_ford by the CPU references of the gtests: initialization of many small
+// tensors, an element-wise operation on a large tensor and the matrix product of the attention
+// reference (tensor::par_for_each of mha_helper.hpp).
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(small_tensors, "small-tensors");
+        add(seq_len, "seq-len");
+        add(iters, "iters");
+    }
+
+    void run()
+    {
+        std::cout << std::setw(16) << "workload" << std::setw(14) << "legacy ms" << std::setw(14)
+                  << "pool ms" << std::setw(14) << "tiled ms" << std::endl;
+
+        Report("small tensors",
+               Measure([&]() { SmallTensors(legacy_par_ford); }),
+               Measure([&]() { SmallTensors(par_ford); }),
+               Measure([&]() { SmallTensors(par_ford_tiled); }));
+
+        auto large = tensor<float>{16, 64, 56, 56};
+        Report("element-wise",
+               Measure([&]() { Scale(legacy_par_ford, large); }),
+               Measure([&]() { Scale(par_ford, large); }),
+               Measure([&]() { Scale(par_ford_tiled, large); }));
+
+        const std::size_t heads = 8;
+        const std::size_t dim   = 64;
+        const auto seq          = static_cast<std::size_t>(seq_len);
+        auto a                  = tensor<float>{2, heads, seq, dim};
+        auto b                  = tensor<float>{2, heads, seq, dim};
+        auto c                  = tensor<float>{2, heads, seq, seq};
+        for(std::size_t i = 0; i < a.data.size(); ++i)
+        {
+            a.data[i] = static_cast<float>(i % 7) - 3.0f;
+            b.data[i] = static_cast<float>(i % 5) - 2.0f;
+        }
+        Report("matrix product",
+               Measure([&]() { DotT(legacy_par_ford, a, b, c); }),
+               Measure([&]() { DotT(par_ford, a, b, c); }),
+               Measure([&]() { DotT(par_ford_tiled, a, b, c); }));
+    }
+
+private:
+    int small_tensors = 2000;
+    int seq_len       = 512;
+    int iters         = 3;
+
+    template <class Loop>
+    void SmallTensors(Loop loop) const
+    {
+        for(auto i = 0; i < small_tensors; ++i)
+        {
+            auto t = tensor<float>{2, 3, 4, 5};
+            loop(2, 3, 4, 5)(
+                [&](auto n, auto c, auto h, auto w) { t(n, c, h, w) = n + c + h + w; });
+        }
+    }
+
+    template <class Loop>
+    static void Scale(Loop loop, tensor<float>& t)
+    {
+        const auto& lens = t.desc.GetLengths();
+        loop(lens[0], lens[1], lens[2], lens[3])(
+            [&](auto n, auto c, auto h, auto w) { t(n, c, h, w) = t(n, c, h, w) * 0.5f + 1.0f; });
+    }
+
+    // C = A * B^T for every batch and head, like Dot_4D_4D_T
+    template <class Loop>
+    static void DotT(Loop loop, const tensor<float>& a, const tensor<float>& b, tensor<float>& c)
+    {
+        const auto& lens = c.desc.GetLengths();
+        const auto k_len = a.desc.GetLengths()[3];
+        loop(lens[0], lens[1], lens[2], lens[3])([&](auto n, auto h, auto i, auto j) {
+            double sum = 0;
+            for(std::size_t k = 0; k < k_len; ++k)
+                sum += double(a(n, h, i, k)) * double(b(n, h, j, k));
+            c(n, h, i, j) = static_cast<float>(sum);
+        });
+    }
+
+    template <class F>
+    double Measure(F f) const
+    {
+        f(); // warm up
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iters; ++i)
+            f();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                   .count() /
+               iters;
+    }
+
+    static void Report(const char* workload, double legacy_ms, double pool_ms, double tiled_ms)
+    {
+        std::cout << std::setw(16) << workload << std::setw(14) << legacy_ms << std::setw(14)
+                  << pool_ms << std::setw(14) << tiled_ms << std::endl;
+    }
+};
+
+} // namespace ford
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::ford::SpeedTestDriver>(argc, argv);
+    return 0;
+}
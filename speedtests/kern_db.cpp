@@ -0,0 +1,97 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/kern_db.hpp>
+#include <miopen/temp_file.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace kern_db {
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(kernels, "kernels");
+        add(size, "size");
+    }
+
+    void run()
+    {
+        const TempFile file{"kern_db_speedtest"};
+        auto configs = std::vector<KernelConfig>{};
+
+        {
+            auto db  = KernDb{DbKinds::KernelDb, file, false};
+            auto gen = std::mt19937{};
+            for(auto i = 0; i < kernels; ++i)
+            {
+                auto blob = std::vector<char>(size);
+                // Somewhat compressible, like real code objects
+                for(auto& c : blob)
+                    c = static_cast<char>(gen() % 16);
+                configs.push_back({"kernel" + std::to_string(i % 8) + ".s",
+                                   "-DINDEX=" + std::to_string(i) + " -mcpu=gfx900",
+                                   std::move(blob)});
+                db.StoreRecordUnsafe(configs.back());
+            }
+        }
+
+        for(auto& config : configs)
+            config.kernel_blob.clear();
+
+        const auto serial = Measure([&]() {
+            for(const auto& config : configs)
+            {
+                // Every LoadBinary() call opens the db
+                auto db = KernDb{DbKinds::KernelDb, file, false};
+                if(!db.FindRecordUnsafe(config))
+                    Fail();
+            }
+        });
+
+        const auto batched = Measure([&]() {
+            auto db = KernDb{DbKinds::KernelDb, file, false};
+            for(const auto& record : db.FindRecordsUnsafe(configs))
+            {
+                if(!record)
+                    Fail();
+            }
+        });
+
+        std::cout << kernels << " kernels of " << size << " bytes: one by one " << serial * 1000
+                  << " ms, in bulk " << batched * 1000 << " ms" << std::endl;
+    }
+
+private:
+    int kernels = 512;
+    int size    = 64 * 1024;
+
+    template <class TFunc>
+    static double Measure(TFunc&& func)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static void Fail()
+    {
+        std::cerr << "Record not found." << std::endl;
+        std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+    }
+};
+
+} // namespace kern_db
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::kern_db::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/compression.hpp>
+#include <miopen/sqlite_db.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the kernel database codecs on the blobs of an existing database (--db, e.g. one of
+// the installed .kdb files) or on generated ones. Reports the compressed size and the single
+// threaded compression and load (decompression) throughput.
+
+namespace miopen {
+namespace kern_db_codec {
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(db, "db");
+        add(kernels, "kernels");
+        add(size, "size");
+    }
+
+    void run()
+    {
+        const auto blobs = db.empty() ? Generate() : Load();
+        auto total       = std::size_t{0};
+        for(const auto& blob : blobs)
+            total += blob.size();
+        std::cout << blobs.size() << " blobs, " << total / 1024 << " KiB" << std::endl;
+
+        for(const auto codec : {CompressionCodec::Bzip2, CompressionCodec::Zstd})
+        {
+            if(!IsAvailable(codec))
+            {
+                std::cout << ToString(codec) << ": not available" << std::endl;
+                continue;
+            }
+
+            auto packed              = std::vector<std::vector<char>>(blobs.size());
+            auto compressed          = std::vector<bool>(blobs.size());
+            const auto compress_time = Measure([&]() {
+                for(std::size_t i = 0; i < blobs.size(); ++i)
+                {
+                    auto success  = false;
+                    packed[i]     = Compress(codec, blobs[i], &success);
+                    compressed[i] = success;
+                }
+            });
+
+            auto packed_total = std::size_t{0};
+            for(const auto& blob : packed)
+                packed_total += blob.size();
+
+            const auto load_time = Measure([&]() {
+                for(std::size_t i = 0; i < blobs.size(); ++i)
+                {
+                    if(compressed[i] && Decompress(codec, packed[i], blobs[i].size()) != blobs[i])
+                        Fail("Decompressed data differs.");
+                }
+            });
+
+            std::cout << ToString(codec) << ": " << packed_total / 1024 << " KiB ("
+                      << 100.0 * packed_total / total << "%), compress "
+                      << total / compress_time / 1e6 << " MB/s, load "
+                      << total / load_time / 1e6 << " MB/s" << std::endl;
+        }
+    }
+
+private:
+    std::string db;
+    int kernels = 256;
+    int size    = 256 * 1024;
+
+    std::vector<std::vector<char>> Load() const
+    {
+        auto sql       = SQLite{db, true};
+        auto has_codec = false;
+        for(const auto& column : sql.Exec("PRAGMA table_info(kern_db);"))
+            has_codec = has_codec || column.at("name") == "kernel_codec";
+        auto stmt = SQLite::Statement{sql,
+                                      has_codec ? "SELECT kernel_blob, uncompressed_size, "
+                                                  "kernel_codec FROM kern_db;"
+                                                : "SELECT kernel_blob, uncompressed_size "
+                                                  "FROM kern_db;"};
+
+        auto blobs = std::vector<std::vector<char>>{};
+        for(;;)
+        {
+            const auto rc = stmt.Step(sql);
+            if(rc == SQLITE_DONE)
+                break;
+            if(rc != SQLITE_ROW)
+                Fail(sql.ErrorMessage());
+
+            auto blob         = stmt.ColumnBlob(0);
+            const auto length = stmt.ColumnInt64(1);
+            const auto codec  = has_codec ? static_cast<CompressionCodec>(stmt.ColumnInt64(2))
+                                          : CompressionCodec::Bzip2;
+            blobs.push_back(length == 0 ? std::move(blob) : Decompress(codec, blob, length));
+        }
+        return blobs;
+    }
+
+    std::vector<std::vector<char>> Generate() const
+    {
+        auto gen   = std::mt19937{};
+        auto blobs = std::vector<std::vector<char>>(kernels);
+        for(auto& blob : blobs)
+        {
+            blob.resize(size);
+            // Somewhat compressible, like real code objects
+            for(auto& c : blob)
+                c = static_cast<char>(gen() % 16);
+        }
+        return blobs;
+    }
+
+    template <class TFunc>
+    static double Measure(TFunc&& func)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static void Fail(const std::string& what)
+    {
+        std::cerr << what << std::endl;
+        std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+    }
+};
+
+} // namespace kern_db_codec
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::kern_db_codec::SpeedTestDriver>(argc, argv);
+    return 0;
+}
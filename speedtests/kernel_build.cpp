@@ -0,0 +1,137 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/miopen.h>
+#include <miopen/kernel_build_service.hpp>
+
+#include <driver.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+// Measures the cumulative cold build time of all applicable solutions for a set of typical
+// forward convolutions. To get cold numbers run it with MIOPEN_DISABLE_CACHE=1 or with an empty
+// MIOPEN_CUSTOM_CACHE_DIR. The first problem also pays for the per process setup of the
+// compiler, e.g. materializing the kernel includes.
+
+namespace miopen {
+namespace kernel_build {
+
+inline void Check(miopenStatus_t status, const char* what)
+{
+    if(status == miopenStatusSuccess)
+        return;
+    std::cerr << what << " has failed: " << miopenGetErrorString(status) << std::endl;
+    std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+}
+
+struct Shape
+{
+    int n, c, h, w, k, y, x, pad, stride;
+};
+
+// 1x1, 3x3, 5x5, 7x7 and strided layers as found in ResNet and Inception.
+constexpr std::array<Shape, 6> shapes = {{{16, 64, 56, 56, 64, 1, 1, 0, 1},
+                                          {16, 64, 56, 56, 64, 3, 3, 1, 1},
+                                          {16, 128, 28, 28, 256, 3, 3, 1, 2},
+                                          {16, 3, 224, 224, 64, 7, 7, 3, 2},
+                                          {16, 32, 28, 28, 64, 5, 5, 2, 1},
+                                          {16, 512, 7, 7, 2048, 1, 1, 0, 1}}};
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver() { add(max_solutions, "max-solutions"); }
+
+    void run()
+    {
+        miopenHandle_t handle = nullptr;
+        Check(miopenCreate(&handle), "miopenCreate");
+
+        auto total_solutions = std::size_t{0};
+        auto total_time      = 0.0;
+        for(const auto& shape : shapes)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            const auto built = Build(handle, shape);
+            const auto time =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << shape.n << 'x' << shape.c << 'x' << shape.h << 'x' << shape.w << " * "
+                      << shape.k << 'x' << shape.c << 'x' << shape.y << 'x' << shape.x << ": "
+                      << built << " solutions built in " << time << " s" << std::endl;
+            total_solutions += built;
+            total_time += time;
+        }
+
+        const auto stats = KernelBuildService::Get().GetStats();
+        std::cout << "Total: " << total_solutions << " solutions built in " << total_time << " s"
+                  << std::endl;
+        std::cout << "Kernel builds: " << stats.builds << " (" << stats.deduplicated
+                  << " deduplicated, " << stats.failed << " failed), " << stats.total_ms
+                  << " ms cumulative, " << stats.max_ms << " ms longest" << std::endl;
+
+        miopenDestroy(handle);
+    }
+
+private:
+    int max_solutions = 100;
+
+    std::size_t Build(miopenHandle_t handle, const Shape& shape) const
+    {
+        miopenTensorDescriptor_t x         = nullptr;
+        miopenTensorDescriptor_t w         = nullptr;
+        miopenTensorDescriptor_t y         = nullptr;
+        miopenConvolutionDescriptor_t conv = nullptr;
+        Check(miopenCreateTensorDescriptor(&x), "miopenCreateTensorDescriptor");
+        Check(miopenCreateTensorDescriptor(&w), "miopenCreateTensorDescriptor");
+        Check(miopenCreateTensorDescriptor(&y), "miopenCreateTensorDescriptor");
+        Check(miopenCreateConvolutionDescriptor(&conv), "miopenCreateConvolutionDescriptor");
+
+        Check(miopenInitConvolutionDescriptor(conv,
+                                              miopenConvolution,
+                                              shape.pad,
+                                              shape.pad,
+                                              shape.stride,
+                                              shape.stride,
+                                              1,
+                                              1),
+              "miopenInitConvolutionDescriptor");
+        Check(miopenSet4dTensorDescriptor(x, miopenFloat, shape.n, shape.c, shape.h, shape.w),
+              "miopenSet4dTensorDescriptor");
+        Check(miopenSet4dTensorDescriptor(w, miopenFloat, shape.k, shape.c, shape.y, shape.x),
+              "miopenSet4dTensorDescriptor");
+
+        auto out = std::vector<int>(4);
+        Check(miopenGetConvolutionForwardOutputDim(conv, x, w, &out[0], &out[1], &out[2], &out[3]),
+              "miopenGetConvolutionForwardOutputDim");
+        Check(miopenSet4dTensorDescriptor(y, miopenFloat, out[0], out[1], out[2], out[3]),
+              "miopenSet4dTensorDescriptor");
+
+        auto solutions = std::vector<miopenConvSolution_t>(max_solutions);
+        auto count     = std::size_t{0};
+        Check(miopenConvolutionForwardGetSolution(
+                  handle, w, x, conv, y, solutions.size(), &count, solutions.data()),
+              "miopenConvolutionForwardGetSolution");
+
+        for(auto i = std::size_t{0}; i < count; ++i)
+            Check(miopenConvolutionForwardCompileSolution(
+                      handle, w, x, conv, y, solutions[i].solution_id),
+                  "miopenConvolutionForwardCompileSolution");
+
+        miopenDestroyConvolutionDescriptor(conv);
+        miopenDestroyTensorDescriptor(x);
+        miopenDestroyTensorDescriptor(w);
+        miopenDestroyTensorDescriptor(y);
+        return count;
+    }
+};
+
+} // namespace kernel_build
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::kernel_build::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/names.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Measures the host time per call of building the in-process key of a convolution problem and
+// looking it up in a hash set, as the invoker cache does, with the binary key and with the
+// string form.
+
+namespace miopen {
+namespace network_config {
+
+struct ConfigHash
+{
+    std::size_t operator()(const NetworkConfig& config) const { return config.Hash(); }
+};
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(problems, "problems");
+        add(iterations, "iterations");
+    }
+
+    void run()
+    {
+        descs.clear();
+        for(auto i = 0; i < problems; ++i)
+        {
+            const auto n = static_cast<std::size_t>(i + 1);
+            descs.emplace_back(TensorDescriptor{miopenFloat, miopenTensorNCHW, {n, 64, 28, 28}},
+                               TensorDescriptor{miopenFloat, miopenTensorNCHW, {64, 64, 3, 3}},
+                               TensorDescriptor{miopenFloat, miopenTensorNCHW, {n, 64, 28, 28}},
+                               ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}},
+                               conv::Direction::Forward);
+        }
+
+        std::cout << std::setw(10) << "key" << std::setw(12) << "make, ns" << std::setw(14)
+                  << "lookup, ns" << std::endl;
+
+        Measure("binary", [](const conv::ProblemDescription& desc) {
+            return desc.MakeNetworkConfig();
+        });
+        Measure("string", [](const conv::ProblemDescription& desc) {
+            auto str = std::string{};
+            desc.MakeNetworkConfig(str);
+            return NetworkConfig{str};
+        });
+    }
+
+private:
+    int problems   = 16;
+    int iterations = 1000000;
+    std::vector<conv::ProblemDescription> descs;
+
+    template <class F>
+    void Measure(const char* name, F make) const
+    {
+        auto configs = std::unordered_set<NetworkConfig, ConfigHash>{};
+        for(const auto& desc : descs)
+            configs.insert(make(desc));
+        if(configs.size() != descs.size())
+        {
+            std::cerr << "Keys of different problems collide." << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; ++i)
+            make(descs[i % problems]);
+        const auto make_ns = Elapsed(start);
+
+        const auto config = make(descs.front());
+        auto found        = 0;
+        start             = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; ++i)
+            found += static_cast<int>(configs.count(config));
+        const auto lookup_ns = Elapsed(start);
+
+        if(found != iterations)
+        {
+            std::cerr << "Lookups have failed." << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+
+        std::cout << std::setw(10) << name << std::setw(12) << make_ns << std::setw(14)
+                  << lookup_ns << std::endl;
+    }
+
+    double Elapsed(std::chrono::steady_clock::time_point start) const
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    }
+};
+
+} // namespace network_config
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::network_config::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/ramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace miopen {
+namespace ramdb_write {
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(records, "records");
+        add(batch, "batch");
+    }
+
+    void run()
+    {
+        const TmpDir dir{"ramdb_write_speedtest"};
+
+        std::cout << std::setw(12) << "batch" << std::setw(20) << "records/s" << std::endl;
+
+        const auto write_through = Run(dir.path / "write_through.db.txt", 0);
+        std::cout << std::setw(12) << "none" << std::setw(20) << write_through << std::endl;
+
+        for(auto size = 16; size <= batch; size *= 4)
+        {
+            const auto batched = Run(dir.path / ("batch" + std::to_string(size) + ".db.txt"), size);
+            std::cout << std::setw(12) << size << std::setw(20) << batched << std::endl;
+        }
+    }
+
+private:
+    int records = 2000;
+    int batch   = 1024;
+
+    struct Values
+    {
+        int value = 0;
+
+        void Serialize(std::ostream& stream) const { stream << value << ",1,2,3"; }
+        bool Deserialize(const std::string&) { return true; }
+    };
+
+    double Run(const fs::path& path, int batch_size) const
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        {
+            auto db = RamDb{DbKinds::PerfDb, path};
+            db.SetWriteBatch(batch_size, std::chrono::hours{1});
+
+            for(auto i = 0; i < records; ++i)
+            {
+                auto record = DbRecord{DbKinds::PerfDb, "key" + std::to_string(i)};
+                record.SetValues("solver", Values{i});
+                db.UpdateRecord(record);
+            }
+
+            // Destruction writes the remaining batch, so it is included in the measurement.
+        }
+
+        const auto time =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return records / time;
+    }
+};
+
+} // namespace ramdb_write
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::ramdb_write::SpeedTestDriver>(argc, argv);
+    return 0;
+}
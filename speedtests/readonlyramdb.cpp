@@ -0,0 +1,152 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <driver.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+namespace rordb {
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(files, "files");
+        add(records, "records");
+        add(lookups, "lookups");
+        add(max_threads, "threads");
+    }
+
+    void run()
+    {
+        const TmpDir dir{"rordb_speedtest"};
+
+        auto paths = std::vector<fs::path>{};
+        for(auto i = 0; i < files; ++i)
+            paths.push_back(WriteDb(dir.path, "db" + std::to_string(i), records));
+
+        for(const auto& path : paths)
+        {
+            const auto time = Measure([&]() { ReadonlyRamDb::GetCached(kind, path, true); });
+            std::cout << "Loaded " << path << " in " << time * 1000 << " ms" << std::endl;
+        }
+
+        if(max_threads <= 0)
+            max_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+        std::cout << std::setw(8) << "threads" << std::setw(20) << "GetCached, Mops/s"
+                  << std::setw(20) << "FindRecord, Mops/s" << std::endl;
+
+        for(auto threads = 1; threads <= max_threads; threads *= 2)
+        {
+            const auto get_cached = RunLookups(paths, threads, false);
+            const auto find       = RunLookups(paths, threads, true);
+            std::cout << std::setw(8) << threads << std::setw(20) << get_cached << std::setw(20)
+                      << find << std::endl;
+        }
+
+        // A slow first-time load of another db must not stall lookups against the loaded ones.
+        const auto big_path = WriteDb(dir.path, "big", records * 16);
+        auto loading        = std::atomic<bool>{true};
+        auto load_time      = 0.;
+        auto loader         = std::thread{[&]() {
+            load_time = Measure([&]() { ReadonlyRamDb::GetCached(kind, big_path, true); });
+            loading   = false;
+        }};
+
+        auto lookups_during_load = 0ll;
+        while(loading)
+        {
+            ReadonlyRamDb::GetCached(kind, paths[lookups_during_load % paths.size()], true);
+            ++lookups_during_load;
+        }
+        loader.join();
+
+        std::cout << "Loaded " << big_path << " in " << load_time * 1000 << " ms, "
+                  << lookups_during_load << " lookups of other dbs completed meanwhile"
+                  << std::endl;
+    }
+
+private:
+    static constexpr DbKinds kind = DbKinds::PerfDb;
+
+    int files       = 4;
+    int records     = 10000;
+    int lookups     = 1 << 20;
+    int max_threads = 0;
+
+    static std::string Key(int idx) { return "key" + std::to_string(idx); }
+
+    static fs::path WriteDb(const fs::path& dir, const std::string& name, int count)
+    {
+        const auto path = dir / (name + ".db.txt");
+        auto out        = std::ofstream{path};
+        for(auto i = 0; i < count; ++i)
+            out << Key(i) << "=solver_0:" << i << ",1,2,3;solver_1:" << i << ",4,5,6\n";
+        return path;
+    }
+
+    template <class TFunc>
+    static double Measure(TFunc&& func)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    double RunLookups(const std::vector<fs::path>& paths, int threads, bool find) const
+    {
+        auto hits    = std::atomic<long long>{0};
+        auto workers = std::vector<std::thread>{};
+
+        const auto time = Measure([&]() {
+            for(auto t = 0; t < threads; ++t)
+            {
+                workers.emplace_back([&, t]() {
+                    auto gen  = std::mt19937{static_cast<unsigned>(t)};
+                    auto dist = std::uniform_int_distribution<int>{0, records - 1};
+                    auto hit  = 0ll;
+
+                    for(auto i = 0; i < lookups; ++i)
+                    {
+                        const auto& path = paths[i % paths.size()];
+                        const auto& db   = ReadonlyRamDb::GetCached(kind, path, true);
+                        if(!find || db.FindRecord(Key(dist(gen))))
+                            ++hit;
+                    }
+
+                    hits += hit;
+                });
+            }
+
+            for(auto& worker : workers)
+                worker.join();
+        });
+
+        if(hits != static_cast<long long>(threads) * lookups)
+        {
+            std::cerr << "Unexpected lookup misses." << std::endl;
+            std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+        }
+
+        return static_cast<double>(hits) / time * .001 * .001;
+    }
+};
+
+} // namespace rordb
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::rordb::SpeedTestDriver>(argc, argv);
+    return 0;
+}
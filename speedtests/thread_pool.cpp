@@ -0,0 +1,122 @@
+#include <miopen/thread_pool.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+namespace thread_pool {
+
+// Models a tuning run: most configs build fast and one in eight takes `skew` times longer. The slow
+// ones are either next to each other in the list or repeat with a period, which are the worst cases
+// for a split into ranges and a split into strides respectively.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(items, "items");
+        add(threads, "threads");
+        add(skew, "skew");
+        add(item_us, "item-us");
+    }
+
+    void run()
+    {
+        std::cout << std::setw(12) << "workload" << std::setw(14) << "schedule" << std::setw(12)
+                  << "ms" << std::setw(12) << "efficiency" << std::endl;
+
+        costs.clear();
+        for(auto i = 0; i < items; ++i)
+            costs.push_back(i < items / 8 ? skew * item_us : item_us);
+        Compare("clustered");
+
+        costs.clear();
+        for(auto i = 0; i < items; ++i)
+            costs.push_back(i % 8 == 0 ? skew * item_us : item_us);
+        Compare("periodic");
+    }
+
+private:
+    int items   = 256;
+    int threads = 8;
+    int skew    = 10;
+    int item_us = 1000;
+    std::vector<int> costs;
+
+    void Compare(const char* workload) const
+    {
+        auto total = 0.0;
+        for(const auto cost : costs)
+            total += cost;
+        const auto ideal = total / threads / 1000.0;
+
+        const auto report = [&](const char* schedule, double ms) {
+            std::cout << std::setw(12) << workload << std::setw(14) << schedule << std::setw(12)
+                      << ms << std::setw(12) << ideal / ms << std::endl;
+        };
+
+        report("contiguous", Measure([&]() { Contiguous(); }));
+        report("strided", Measure([&]() { Strided(); }));
+        report("pool", Measure([&]() {
+                   ThreadPool::Get().ParallelFor(costs.size(), threads, [&](auto i) { Item(i); });
+               }));
+    }
+
+    void Item(std::size_t i) const
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds{costs[i]});
+    }
+
+    template <class F>
+    static double Measure(F f)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+    }
+
+    // What par_for did before: one thread per contiguous range.
+    void Contiguous() const
+    {
+        const auto grain = (costs.size() + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        for(std::size_t start = 0; start < costs.size(); start += grain)
+        {
+            workers.emplace_back([=]() {
+                for(auto i = start; i < std::min(costs.size(), start + grain); ++i)
+                    Item(i);
+            });
+        }
+        for(auto& worker : workers)
+            worker.join();
+    }
+
+    // What GenericSearch and PrecompileKernels did before: one thread per stride.
+    void Strided() const
+    {
+        std::vector<std::thread> workers;
+        for(auto start = 0; start < threads; ++start)
+        {
+            workers.emplace_back([=]() {
+                for(std::size_t i = start; i < costs.size(); i += threads)
+                    Item(i);
+            });
+        }
+        for(auto& worker : workers)
+            worker.join();
+    }
+};
+
+} // namespace thread_pool
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::thread_pool::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,144 @@
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/conv/heuristics/dense_net.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <driver.hpp>
+
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+#include <fdeep/fdeep.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Compares the host time of TunaNet inference through frugally-deep, one problem per call as
+// PredictSolver used to, with the DenseNet path, one problem per call and in batches. The models
+// are the installed ones (see --arch). Also reports the largest difference of the outputs.
+
+namespace miopen {
+namespace tuna_net {
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(arch, "arch");
+        add(problems, "problems");
+        add(iterations, "iterations");
+    }
+
+    void run()
+    {
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+        const auto path = GetSystemDbPath() / (arch + ".tn.model");
+        if(!fs::exists(path))
+            Fail("No model at " + path.string());
+
+        auto start           = std::chrono::steady_clock::now();
+        const auto reference = fdeep::load_model(path.string(), true, fdeep::dev_null_logger);
+        Report("fdeep, load", Elapsed(start, 1));
+
+        start          = std::chrono::steady_clock::now();
+        const auto net = ai::DenseNet{nlohmann::json::parse(std::ifstream{path})};
+        Report("DenseNet, load", Elapsed(start, 1));
+
+        const auto num_inputs  = net.GetNumInputs();
+        const auto num_outputs = net.GetNumOutputs();
+        const auto count       = static_cast<std::size_t>(problems);
+
+        // Normalized features are roughly standard normal
+        auto gen    = std::mt19937{};
+        auto dist   = std::normal_distribution<float>{};
+        auto inputs = std::vector<float>(count * num_inputs);
+        for(auto& value : inputs)
+            value = dist(gen);
+
+        auto expected = std::vector<float>(count * num_outputs);
+        start         = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; ++i)
+        {
+            for(std::size_t row = 0; row < count; ++row)
+            {
+                const auto* features = inputs.data() + row * num_inputs;
+                const auto values    = std::vector<float>(features, features + num_inputs);
+                const auto input     = fdeep::tensor(fdeep::tensor_shape(num_inputs), values);
+                const auto output    = reference.predict({input}).front().to_vector();
+                std::copy(output.begin(), output.end(), expected.begin() + row * num_outputs);
+            }
+        }
+        Report("fdeep", Elapsed(start, iterations * count));
+
+        auto workspace = ai::DenseNet::Workspace{};
+        auto single    = std::vector<float>(count * num_outputs);
+        start          = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; ++i)
+        {
+            for(std::size_t row = 0; row < count; ++row)
+            {
+                net.Forward(inputs.data() + row * num_inputs,
+                            1,
+                            single.data() + row * num_outputs,
+                            workspace);
+            }
+        }
+        Report("DenseNet, single", Elapsed(start, iterations * count));
+
+        auto batched = std::vector<float>(count * num_outputs);
+        start        = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iterations; ++i)
+            net.Forward(inputs.data(), count, batched.data(), workspace);
+        Report("DenseNet, batch", Elapsed(start, iterations * count));
+
+        auto max_diff = 0.0f;
+        for(std::size_t i = 0; i < expected.size(); ++i)
+        {
+            max_diff = std::max(max_diff, std::abs(single[i] - expected[i]));
+            max_diff = std::max(max_diff, std::abs(batched[i] - expected[i]));
+        }
+        std::cout << "Largest difference from fdeep: " << max_diff << std::endl;
+#else
+        Fail("MIOpen is built without MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK");
+#endif
+    }
+
+private:
+    std::string arch = "gfx942";
+    int problems     = 256;
+    int iterations   = 10;
+
+    static double Elapsed(std::chrono::steady_clock::time_point start, std::size_t calls)
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() /
+               static_cast<double>(calls);
+    }
+
+    static void Report(const char* name, double us)
+    {
+        std::cout << std::setw(18) << name << ": " << std::fixed << std::setprecision(2) << us
+                  << " us" << std::endl;
+    }
+
+    static void Fail(const std::string& what)
+    {
+        std::cerr << what << std::endl;
+        std::exit(-1); // NOLINT (concurrency-mt-unsafe)
+    }
+};
+
+} // namespace tuna_net
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::tuna_net::SpeedTestDriver>(argc, argv);
+    return 0;
+}
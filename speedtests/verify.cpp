@@ -0,0 +1,102 @@
+#include <tensor_holder.hpp>
+#include <verify.hpp>
+
+#include <driver.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace miopen {
+namespace verify {
+
+// What rms_range and max_diff did before: separate scalar passes with the generic conversions
+// of the element type.
+template <class R1, class R2>
+double legacy_rms_range(R1&& r1, R2&& r2)
+{
+    const std::size_t n      = range_distance(r1);
+    double square_difference = range_product(r1, r2, 0.0, sum_fn{}, square_diff);
+    double mag1 = static_cast<double>(*std::max_element(r1.begin(), r1.end(), compare_mag));
+    double mag2 = static_cast<double>(*std::max_element(r2.begin(), r2.end(), compare_mag));
+    double mag  = std::max({std::fabs(mag1), std::fabs(mag2), std::numeric_limits<double>::min()});
+    return std::sqrt(square_difference) / (std::sqrt(n) * mag);
+}
+
+template <class R1, class R2>
+double legacy_max_diff(R1&& r1, R2&& r2)
+{
+    return range_product(r1, r2, 0.0, max, abs_diff);
+}
+
+// Comparison of a large result with its reference, as done by the driver after every run with
+// verification (-V 1).
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(size, "size");
+        add(iters, "iters");
+    }
+
+    void run()
+    {
+        std::cout << std::setw(10) << "type" << std::setw(14) << "legacy ms" << std::setw(14)
+                  << "fused ms" << std::setw(10) << "speedup" << std::setw(14) << "rms diff"
+                  << std::endl;
+        Run<float>("float");
+        Run<half_float::half>("half");
+        Run<bfloat16>("bfloat16");
+    }
+
+private:
+    int size  = 1 << 24;
+    int iters = 3;
+
+    template <class T>
+    void Run(const char* name) const
+    {
+        auto ref = std::vector<T>(size);
+        auto out = std::vector<T>(size);
+        for(std::size_t i = 0; i < ref.size(); ++i)
+        {
+            ref[i] = static_cast<T>(static_cast<float>(i % 1013) / 1013.0f - 0.5f);
+            out[i] = static_cast<T>(static_cast<float>(ref[i]) * (i % 3 == 0 ? 1.001f : 1.0f));
+        }
+
+        double legacy = 0.0;
+        double fused  = 0.0;
+        const auto legacy_ms =
+            Measure([&]() { legacy = legacy_rms_range(ref, out) + legacy_max_diff(ref, out); });
+        const auto fused_ms = Measure([&]() {
+            const auto stats = compare_ranges(ref, out);
+            fused            = stats.rms + stats.max_abs;
+        });
+
+        std::cout << std::setw(10) << name << std::setw(14) << legacy_ms << std::setw(14)
+                  << fused_ms << std::setw(10) << legacy_ms / fused_ms << std::setw(14)
+                  << std::fabs(legacy - fused) << std::endl;
+    }
+
+    template <class F>
+    double Measure(F f) const
+    {
+        f(); // warm up
+        const auto start = std::chrono::steady_clock::now();
+        for(auto i = 0; i < iters; ++i)
+            f();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                   .count() /
+               iters;
+    }
+};
+
+} // namespace verify
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::verify::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -26,8 +26,7 @@
 
 #include <miopen/activ/problem_description.hpp>
 #include <miopen/names.hpp>
-
-#include <sstream>
+#include <miopen/problem_key.hpp>
 
 namespace miopen {
 
@@ -57,25 +56,16 @@ NetworkConfig ProblemDescription::MakeNetworkConfig() const
     const auto read_unit = (read_len % 4 == 0) ? 4 : (read_len % 2 == 0) ? 2 : 1;
     const auto MAP_RD    = read_len / read_unit;
 
-    std::ostringstream ss;
-
-    ss << "activ-";
-
-    if(direction == Direction::Backward)
-        ss << "bwd-";
-    else
-        ss << "fwd-";
-
-    ss << ((packed) ? "11" : "10"); // + lite bit
-    ss << xDesc.GetType();
-    if(const auto ct = xDesc.GetCastType())
-        ss << GetDataTypeName(*ct);
-    ss << activDesc.GetMode();
-    ss << read_unit;
-    ss << MAP_RD;
-    ss << height;
+    auto key = ProblemKey{direction == Direction::Backward ? "activ-bwd" : "activ-fwd"};
+    key.Add(packed);
+    key.Add(xDesc.GetType());
+    key.AddOptional(xDesc.GetCastType());
+    key.Add(activDesc.GetMode());
+    key.Add(read_unit);
+    key.Add(MAP_RD);
+    key.Add(height);
 
-    return NetworkConfig{ss.str()};
+    return NetworkConfig{key};
 }
 
 } // namespace activ
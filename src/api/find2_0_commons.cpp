@@ -30,6 +30,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/precompile.hpp>
 #include <miopen/problem.hpp>
 #include <miopen/search_options.hpp>
 #include <miopen/solution.hpp>
@@ -529,4 +530,87 @@ miopenStatus_t miopenGetSolverIdConvAlgorithm(uint64_t solverId, miopenConvAlgor
         *result = id_deref.GetAlgo();
     });
 }
+
+miopenStatus_t miopenPrecompileProblems(miopenHandle_t handle,
+                                        size_t numProblems,
+                                        const miopenProblem_t* problems)
+{
+    MIOPEN_LOG_FUNCTION(handle, numProblems, problems);
+
+    return miopen::try_([&] {
+        auto& handle_deref  = miopen::deref(handle);
+        auto problems_deref = std::vector<miopen::Problem>{};
+
+        for(std::size_t i = 0; i < numProblems; ++i)
+        {
+            const auto& problem_deref = miopen::deref(problems[i]).item;
+            if(!std::holds_alternative<miopen::Problem>(problem_deref))
+                MIOPEN_THROW(miopenStatusNotImplemented, "Fused problems can't be precompiled");
+            problems_deref.push_back(std::get<miopen::Problem>(problem_deref));
+        }
+
+        miopen::PrecompileAsync(handle_deref, problems_deref);
+    });
+}
+
+miopenStatus_t miopenFindSolutionsBatch(miopenHandle_t handle,
+                                        size_t numProblems,
+                                        const miopenProblem_t* problems,
+                                        miopenFindOptions_t options,
+                                        miopenSolution_t* solutions,
+                                        size_t* numSolutions,
+                                        size_t maxSolutionsPerProblem)
+{
+    MIOPEN_LOG_FUNCTION(
+        handle, numProblems, problems, options, solutions, numSolutions, maxSolutionsPerProblem);
+
+    return miopen::try_([&] {
+        auto& handle_deref  = miopen::deref(handle);
+        auto problems_deref = std::vector<miopen::ProblemContainer::Item>{};
+        problems_deref.reserve(numProblems);
+
+        for(std::size_t i = 0; i < numProblems; ++i)
+        {
+            const auto& problem_deref = miopen::deref(problems[i]).item;
+            std::visit([](auto&& problem) { problem.LogDriverCommand(); }, problem_deref);
+            problems_deref.push_back(problem_deref);
+        }
+
+        const auto& options_deref =
+            options == nullptr ? miopen::FindOptions{} : miopen::deref(options);
+
+        auto solutions_deref = miopen::FindSolutionsBatch(
+            handle_deref, problems_deref, options_deref, maxSolutionsPerProblem);
+
+        for(std::size_t i = 0; i < solutions_deref.size(); ++i)
+        {
+            auto* first = solutions + i * maxSolutionsPerProblem;
+            for(std::size_t j = 0; j < solutions_deref[i].size(); ++j)
+            {
+                auto& theSolution = miopen::deref(first + j);
+                theSolution       = new miopen::Solution{std::move(solutions_deref[i][j])};
+            }
+
+            if(numSolutions != nullptr)
+                numSolutions[i] = solutions_deref[i].size();
+        }
+    });
+}
+
+miopenStatus_t miopenGetPrecompileStats(miopenHandle_t handle, miopenPrecompileStats_t* stats)
+{
+    MIOPEN_LOG_FUNCTION(handle);
+
+    return miopen::try_([&] {
+        const auto stats_deref = miopen::deref(handle).GetPrecompiler().GetStats();
+        auto& out              = miopen::deref(stats);
+
+        out.queued    = stats_deref.queued;
+        out.completed = stats_deref.completed;
+        out.failed    = stats_deref.failed;
+        out.hits      = stats_deref.hits;
+        out.waits     = stats_deref.waits;
+        out.misses    = stats_deref.misses;
+    });
+}
 }
@@ -0,0 +1,221 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/background_find.hpp>
+
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+
+#include <exception>
+
+namespace miopen {
+
+BackgroundFinder::BackgroundFinder() = default;
+
+BackgroundFinder::BackgroundFinder(Handle& owner_) : owner(&owner_) {}
+
+BackgroundFinder::~BackgroundFinder()
+{
+    Stop();
+
+    if(stats.queued > 0)
+    {
+        MIOPEN_LOG_I("Background searches: " << stats.completed << '/' << stats.queued
+                                             << ", failed: " << stats.failed
+                                             << ", cancelled: " << stats.cancelled);
+    }
+}
+
+bool BackgroundFinder::Submit(const NetworkConfig& problem, std::function<void()> task)
+{
+    // Created here, as the owner must not be used by the worker
+    if(owner != nullptr && !search_handle)
+    {
+        try
+        {
+            search_handle = owner->CreateBackgroundHandle();
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Unable to create the handle for background searches: " << ex.what());
+            return false;
+        }
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        if(stopped || !submitted.insert(problem).second)
+            return false;
+
+        queue.emplace_back(problem, std::move(task));
+        ++stats.queued;
+
+        if(!worker.joinable())
+            worker = std::thread{[this]() { Run(); }};
+    }
+
+    MIOPEN_LOG_I2("Queued background search of " << problem.ToString());
+    changed.notify_all();
+    return true;
+}
+
+void BackgroundFinder::Run()
+{
+    while(true)
+    {
+        auto problem = NetworkConfig{};
+        auto task    = std::function<void()>{};
+
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            changed.wait(lock, [&]() { return stopped || !queue.empty(); });
+            if(stopped)
+                return;
+
+            problem = std::move(queue.front().first);
+            task    = std::move(queue.front().second);
+            queue.pop_front();
+            busy = true;
+        }
+
+        auto failed = false;
+
+        try
+        {
+            task();
+        }
+        catch(const std::exception& ex)
+        {
+            if(!stopping)
+            {
+                MIOPEN_LOG_W("Background search of " << problem.ToString()
+                                                     << " has failed: " << ex.what());
+            }
+            failed = true;
+        }
+        catch(...)
+        {
+            if(!stopping)
+                MIOPEN_LOG_W("Background search of " << problem.ToString() << " has failed");
+            failed = true;
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+            busy = false;
+            if(!failed)
+                ++stats.completed;
+            else if(stopping)
+                ++stats.cancelled;
+            else
+                ++stats.failed;
+        }
+
+        changed.notify_all();
+    }
+}
+
+Handle& BackgroundFinder::GetOwner() const
+{
+    if(owner == nullptr)
+        MIOPEN_THROW("The background finder doesn't belong to a handle");
+    return *owner;
+}
+
+Handle& BackgroundFinder::GetSearchHandle()
+{
+    // Set before the first task is queued, so there is no need to lock
+    if(!search_handle)
+        MIOPEN_THROW("The background finder has no handle to search on");
+    return *search_handle;
+}
+
+void BackgroundFinder::Publish(std::function<void()> apply)
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    if(stopped)
+        return;
+    published.push_back(std::move(apply));
+    has_published = true;
+}
+
+void BackgroundFinder::ApplyPublished()
+{
+    if(!has_published)
+        return;
+
+    auto applies = std::vector<std::function<void()>>{};
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        applies.swap(published);
+        has_published = false;
+    }
+
+    for(const auto& apply : applies)
+    {
+        try
+        {
+            apply();
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Unable to apply the results of a background search: " << ex.what());
+        }
+    }
+}
+
+void BackgroundFinder::WaitAll()
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    changed.wait(lock, [&]() { return queue.empty() && !busy; });
+}
+
+void BackgroundFinder::Stop()
+{
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        stopped  = true;
+        stopping = true;
+        stats.cancelled += queue.size();
+        queue.clear();
+        published.clear();
+        has_published = false;
+    }
+
+    changed.notify_all();
+
+    if(worker.joinable())
+        worker.join();
+}
+
+BackgroundFinder::Stats BackgroundFinder::GetStats() const
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    return stats;
+}
+
+} // namespace miopen
@@ -0,0 +1,268 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/benchmark.hpp>
+
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_FIND_BENCHMARK_WARMUP, 1)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_FIND_BENCHMARK_MIN_SAMPLES, 3)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_FIND_BENCHMARK_MAX_SAMPLES, 20)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_FIND_BENCHMARK_TIME_LIMIT_MS, 5000)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_FIND_BENCHMARK_TARGET_CI_PERCENT, 2)
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_FIND_BENCHMARK_ESTIMATOR)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_FIND_BENCHMARK_HALVING, true)
+
+namespace miopen {
+
+namespace {
+
+/// Two-sided 95% quantiles of the Student's t-distribution by degrees of freedom
+constexpr std::array<float, 30> t_quantiles = {
+    12.706f, 4.303f, 3.182f, 2.776f, 2.571f, 2.447f, 2.365f, 2.306f, 2.262f, 2.228f,
+    2.201f,  2.179f, 2.160f, 2.145f, 2.131f, 2.120f, 2.110f, 2.101f, 2.093f, 2.086f,
+    2.080f,  2.074f, 2.069f, 2.064f, 2.060f, 2.056f, 2.052f, 2.048f, 2.045f, 2.042f,
+};
+
+float TQuantile(std::size_t samples)
+{
+    if(samples < 2)
+        return 0.0f;
+    return samples - 1 <= t_quantiles.size() ? t_quantiles[samples - 2] : 1.960f;
+}
+
+} // namespace
+
+TimingEstimator ParseTimingEstimator(std::string_view name)
+{
+    if(name == "median")
+        return TimingEstimator::Median;
+    if(name == "trimmed_mean")
+        return TimingEstimator::TrimmedMean;
+    if(name == "mean")
+        return TimingEstimator::Mean;
+    if(name == "min")
+        return TimingEstimator::Min;
+    MIOPEN_THROW(miopenStatusBadParm, "Unknown timing estimator: " + std::string{name});
+}
+
+BenchmarkOptions BenchmarkOptions::FromEnv()
+{
+    auto options        = BenchmarkOptions{};
+    options.warmup      = env::value(MIOPEN_FIND_BENCHMARK_WARMUP);
+    options.min_samples = std::max<std::size_t>(env::value(MIOPEN_FIND_BENCHMARK_MIN_SAMPLES), 1);
+    options.max_samples =
+        std::max<std::size_t>(env::value(MIOPEN_FIND_BENCHMARK_MAX_SAMPLES), options.min_samples);
+    options.time_limit_ms = static_cast<float>(env::value(MIOPEN_FIND_BENCHMARK_TIME_LIMIT_MS));
+    options.target_ci =
+        static_cast<float>(env::value(MIOPEN_FIND_BENCHMARK_TARGET_CI_PERCENT)) / 100.0f;
+    options.successive_halving = !env::disabled(MIOPEN_FIND_BENCHMARK_HALVING);
+
+    const auto estimator = env::value(MIOPEN_FIND_BENCHMARK_ESTIMATOR);
+    if(!estimator.empty())
+        options.estimator = ParseTimingEstimator(estimator);
+    return options;
+}
+
+bool TimingStats::Converged(const BenchmarkOptions& options) const
+{
+    if(samples < options.min_samples)
+        return false;
+    return ci_high - ci_low <= 2.0f * options.target_ci * estimate;
+}
+
+TimingStats ComputeTimingStats(std::vector<float> samples, const BenchmarkOptions& options)
+{
+    auto stats    = TimingStats{};
+    stats.samples = samples.size();
+    if(samples.empty())
+        return stats;
+
+    std::sort(samples.begin(), samples.end());
+    const auto n   = samples.size();
+    const auto mid = n / 2;
+
+    stats.min    = samples.front();
+    stats.median = n % 2 != 0 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2.0f;
+    stats.mean   = std::accumulate(samples.begin(), samples.end(), 0.0f) / static_cast<float>(n);
+
+    auto squares = 0.0f;
+    for(const auto sample : samples)
+        squares += (sample - stats.mean) * (sample - stats.mean);
+    stats.stddev = n > 1 ? std::sqrt(squares / static_cast<float>(n - 1)) : 0.0f;
+
+    // The standard error of the median is about sqrt(pi / 2) times the one of the mean for
+    // normally distributed samples.
+    auto error = stats.stddev / std::sqrt(static_cast<float>(n));
+    switch(options.estimator)
+    {
+    case TimingEstimator::Median:
+        stats.estimate = stats.median;
+        error *= 1.2533f;
+        break;
+    case TimingEstimator::TrimmedMean: {
+        const auto cut = std::min(static_cast<std::size_t>(options.trim * n), (n - 1) / 2);
+        stats.estimate =
+            std::accumulate(samples.begin() + cut, samples.end() - cut, 0.0f) /
+            static_cast<float>(n - 2 * cut);
+        break;
+    }
+    case TimingEstimator::Mean: stats.estimate = stats.mean; break;
+    case TimingEstimator::Min: stats.estimate = stats.min; break;
+    }
+
+    const auto half_width = TQuantile(n) * error;
+    stats.ci_low          = std::max(stats.estimate - half_width, 0.0f);
+    stats.ci_high         = stats.estimate + half_width;
+    return stats;
+}
+
+std::size_t Benchmark::Add(Sampler sampler)
+{
+    candidates.push_back({std::move(sampler), {}, 0.0f, {}});
+    return candidates.size() - 1;
+}
+
+bool Benchmark::Sample(Candidate& candidate, bool timed)
+{
+    try
+    {
+        const auto time = candidate.sampler();
+        candidate.spent_ms += time;
+        if(timed)
+            candidate.samples.push_back(time);
+        return true;
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_E(ex.what());
+        candidate.stats.failed = true;
+        return false;
+    }
+}
+
+std::vector<TimingStats> Benchmark::Run()
+{
+    auto alive = std::vector<Candidate*>{};
+    for(auto& candidate : candidates)
+    {
+        auto ok = true;
+        for(std::size_t i = 0; ok && i < options.warmup; ++i)
+            ok = Sample(candidate, false);
+        if(ok)
+            alive.push_back(&candidate);
+    }
+
+    const auto can_sample = [&](const Candidate& candidate) {
+        return !candidate.stats.failed && candidate.samples.size() < options.max_samples &&
+               candidate.spent_ms < options.time_limit_ms;
+    };
+
+    for(auto target = std::max<std::size_t>(options.min_samples, 1); !alive.empty();
+        target      = std::min(target * 2, options.max_samples))
+    {
+        auto sampled = false;
+        for(auto* candidate : alive)
+        {
+            if(candidate->stats.Converged(options))
+                continue;
+            // Even slow candidates get one sample
+            while(candidate->samples.size() < target &&
+                  (can_sample(*candidate) ||
+                   (candidate->samples.empty() && !candidate->stats.failed)))
+            {
+                sampled = true;
+                Sample(*candidate, true);
+            }
+            const auto failed       = candidate->stats.failed;
+            candidate->stats        = ComputeTimingStats(candidate->samples, options);
+            candidate->stats.failed = failed;
+        }
+
+        alive.erase(std::remove_if(alive.begin(),
+                                   alive.end(),
+                                   [](const auto* candidate) { return candidate->stats.failed; }),
+                    alive.end());
+        if(alive.empty())
+            break;
+
+        // Slowest last
+        std::sort(alive.begin(), alive.end(), [](const auto* l, const auto* r) {
+            return l->stats.estimate < r->stats.estimate;
+        });
+        const auto& best = alive.front()->stats;
+
+        // Candidates that are clearly slower than the best one stop here. Successive halving
+        // also drops the slower half of the ones that are likely slower.
+        auto kept = std::size_t{1};
+        for(std::size_t i = 1; i < alive.size(); ++i)
+        {
+            const auto& stats  = alive[i]->stats;
+            const auto halving = options.successive_halving && i >= (alive.size() + 1) / 2 &&
+                                 stats.estimate > best.ci_high;
+            if(stats.ci_low > best.ci_high || halving)
+                alive[i]->stats.eliminated = true;
+            else
+                alive[kept++] = alive[i];
+        }
+        alive.resize(kept);
+
+        const auto done = std::none_of(alive.begin(), alive.end(), [&](const auto* candidate) {
+            return !candidate->stats.Converged(options) && can_sample(*candidate);
+        });
+        if(done || (!sampled && target == options.max_samples))
+            break;
+    }
+
+    auto ret = std::vector<TimingStats>{};
+    ret.reserve(candidates.size());
+    for(const auto& candidate : candidates)
+        ret.push_back(candidate.stats);
+    return ret;
+}
+
+int Benchmark::GetBest(const std::vector<TimingStats>& stats)
+{
+    auto best = -1;
+    for(std::size_t i = 0; i < stats.size(); ++i)
+    {
+        if(stats[i].failed || stats[i].eliminated || stats[i].samples == 0)
+            continue;
+        if(best < 0 || stats[i].estimate < stats[best].estimate)
+            best = static_cast<int>(i);
+    }
+    return best;
+}
+
+} // namespace miopen
@@ -41,8 +41,13 @@
 #include <miopen/db_path.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/filesystem.hpp>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <utility>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DISABLE_CACHE)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_CUSTOM_CACHE_DIR)
@@ -125,7 +130,8 @@ bool IsCacheDisabled()
 
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
 using KDb = DbTimer<MultiFileDb<KernDb, KernDb, false>>;
-KDb GetDb(const TargetProperties& target, size_t num_cu)
+
+static std::pair<fs::path, fs::path> GetDbPaths(const TargetProperties& target, size_t num_cu)
 {
     static const auto user_dir = ComputeUserCachePath();
     static const auto sys_dir  = ComputeSysCachePath();
@@ -139,9 +145,91 @@ KDb GetDb(const TargetProperties& target, size_t num_cu)
     if(!fs::exists(sys_path))
         sys_path = fs::path{};
 #endif
-    return {DbKinds::KernelDb, sys_path, user_path};
+    return {sys_path, user_path};
+}
+
+KDb GetDb(const std::pair<fs::path, fs::path>& paths)
+{
+    return {DbKinds::KernelDb, paths.first, paths.second};
 }
+
+namespace {
+
+/// Binaries loaded ahead of time by WarmBinaries(). Each one is handed out by LoadBinary() once,
+/// or dropped when its BinaryPrefetch is destroyed or a new binary is saved under its key.
+struct WarmedBinaries
+{
+    /// The dbs a binary is looked up in, in the order LoadBinary() uses, and its record key.
+    using Key = std::tuple<fs::path, fs::path, std::string, std::string>;
+
+    struct Entry
+    {
+        std::uint64_t prefetch;
+        std::vector<char> binary;
+    };
+
+    /// Limits the memory held by the binaries nobody has taken yet.
+    static constexpr std::size_t max_size = std::size_t{256} << 20;
+
+    std::mutex mutex;
+    std::map<Key, Entry> binaries;
+    std::size_t size            = 0;
+    std::uint64_t last_prefetch = 0;
+
+    static WarmedBinaries& Get()
+    {
+        static WarmedBinaries instance;
+        return instance;
+    }
+
+    static Key MakeKey(const std::pair<fs::path, fs::path>& db_paths,
+                       const fs::path& filename,
+                       const std::string& args)
+    {
+        return {db_paths.second, db_paths.first, filename.string(), args};
+    }
+
+    boost::optional<std::vector<char>> TakeUnsafe(const Key& key)
+    {
+        const auto it = binaries.find(key);
+        if(it == binaries.end())
+            return boost::none;
+        auto binary = std::move(it->second.binary);
+        size -= binary.size();
+        binaries.erase(it);
+        return binary;
+    }
+};
+
+} // namespace
+#endif
+
+BinaryPrefetch::~BinaryPrefetch()
+{
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    if(id == 0)
+        return;
+
+    auto& warmed    = WarmedBinaries::Get();
+    const auto lock = std::lock_guard<std::mutex>{warmed.mutex};
+    auto dropped    = 0;
+
+    for(auto it = warmed.binaries.begin(); it != warmed.binaries.end();)
+    {
+        if(it->second.prefetch != id)
+        {
+            ++it;
+            continue;
+        }
+        warmed.size -= it->second.binary.size();
+        it = warmed.binaries.erase(it);
+        ++dropped;
+    }
+
+    if(dropped > 0)
+        MIOPEN_LOG_I2("Dropped " << dropped << " unused prefetched binaries");
 #endif
+}
 
 fs::path GetCacheFile(const std::string& device, const fs::path& name, const std::string& args)
 {
@@ -158,9 +246,25 @@ std::vector<char> LoadBinary(const TargetProperties& target,
     if(miopen::IsCacheDisabled())
         return {};
 
-    auto db = GetDb(target, num_cu);
-
+    const auto paths    = GetDbPaths(target, num_cu);
+    auto db             = GetDb(paths);
     const auto filename = make_object_file_name(name);
+
+    {
+        auto& warmed    = WarmedBinaries::Get();
+        const auto lock = std::lock_guard<std::mutex>{warmed.mutex};
+        if(!warmed.binaries.empty())
+        {
+            auto binary =
+                warmed.TakeUnsafe(WarmedBinaries::MakeKey(paths, filename, args));
+            if(binary)
+            {
+                MIOPEN_LOG_I2("Using prefetched binary for: " << filename << "; args: " << args);
+                return std::move(*binary);
+            }
+        }
+    }
+
     const KernelConfig cfg{filename, args, {}};
 
     MIOPEN_LOG_I2("Loading binary for: " << filename << "; args: " << args);
@@ -177,6 +281,69 @@ std::vector<char> LoadBinary(const TargetProperties& target,
     }
 }
 
+BinaryPrefetch WarmBinaries(const TargetProperties& target,
+                            const std::size_t num_cu,
+                            const std::vector<std::pair<fs::path, std::string>>& programs)
+{
+    if(miopen::IsCacheDisabled() || programs.empty())
+        return {};
+
+    auto configs = std::vector<KernelConfig>{};
+    configs.reserve(programs.size());
+    for(const auto& program : programs)
+        configs.push_back({make_object_file_name(program.first), program.second, {}});
+
+    const auto paths = GetDbPaths(target, num_cu);
+    auto found       = std::vector<boost::optional<std::vector<char>>>(configs.size());
+
+    // Same precedence as in LoadBinary(): the user db first, then the installed one.
+#if !MIOPEN_DISABLE_USERDB
+    found = KernDb{DbKinds::KernelDb, paths.second, false}.FindRecords(configs);
+#endif
+
+    auto missing = std::vector<KernelConfig>{};
+    auto indices = std::vector<std::size_t>{};
+    for(std::size_t i = 0; i < configs.size(); ++i)
+    {
+        if(found[i])
+            continue;
+        missing.push_back(configs[i]);
+        indices.push_back(i);
+    }
+
+    if(!missing.empty())
+    {
+        auto installed = KernDb{DbKinds::KernelDb, paths.first, true}.FindRecords(missing);
+        for(std::size_t i = 0; i < missing.size(); ++i)
+            found[indices[i]] = std::move(installed[i]);
+    }
+
+    auto& warmed    = WarmedBinaries::Get();
+    const auto lock = std::lock_guard<std::mutex>{warmed.mutex};
+    const auto id   = ++warmed.last_prefetch;
+    auto count      = 0;
+
+    for(std::size_t i = 0; i < configs.size(); ++i)
+    {
+        if(!found[i])
+            continue;
+        if(warmed.size + found[i]->size() > WarmedBinaries::max_size)
+        {
+            MIOPEN_LOG_I2("Prefetched binaries have reached the size limit");
+            break;
+        }
+        const auto key =
+            WarmedBinaries::MakeKey(paths, configs[i].kernel_name, configs[i].kernel_args);
+        warmed.TakeUnsafe(key);
+        warmed.size += found[i]->size();
+        warmed.binaries.emplace(key, WarmedBinaries::Entry{id, std::move(*found[i])});
+        ++count;
+    }
+
+    MIOPEN_LOG_I2("Prefetched " << count << " of " << configs.size() << " binaries");
+    return BinaryPrefetch{id};
+}
+
 void SaveBinary(const std::vector<char>& hsaco,
                 const TargetProperties& target,
                 const std::size_t num_cu,
@@ -186,11 +353,19 @@ void SaveBinary(const std::vector<char>& hsaco,
     if(miopen::IsCacheDisabled())
         return;
 
-    auto db = GetDb(target, num_cu);
-
+    const auto paths    = GetDbPaths(target, num_cu);
+    auto db             = GetDb(paths);
     const auto filename = make_object_file_name(name);
     KernelConfig cfg{filename, args, hsaco};
 
+    {
+        // A prefetched copy of the record would be stale now.
+        auto& warmed    = WarmedBinaries::Get();
+        const auto lock = std::lock_guard<std::mutex>{warmed.mutex};
+        if(!warmed.binaries.empty())
+            warmed.TakeUnsafe(WarmedBinaries::MakeKey(paths, filename, args));
+    }
+
     MIOPEN_LOG_I2("Saving binary for: " << filename << "; args: " << args);
     db.StoreRecord(cfg);
 }
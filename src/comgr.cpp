@@ -33,6 +33,7 @@
 #include <miopen/hip_build_utils.hpp>
 #include <miopen/gcn_asm_utils.hpp>
 #include <miopen/kernel.hpp>
+#include <miopen/kernel_include_cache.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/solver/implicitgemm_util.hpp>
 #include <miopen/stringutils.hpp>
@@ -814,37 +815,7 @@ static hiprtc_program_ptr CreateProgram(std::string_view src,
 
 class HiprtcProgram
 {
-    struct string_ptr_array
-    {
-        std::vector<const char*> c_strs{};
-        string_ptr_array() {}
-        string_ptr_array(const string_ptr_array&) = delete;
-        std::size_t size() const { return c_strs.size(); }
-        const char** data() { return c_strs.data(); }
-        void push_back(std::string_view s) { c_strs.emplace_back(s.data()); }
-    };
-
-    struct string_array
-    {
-        std::vector<std::string> strings{};
-        std::vector<const char*> c_strs{};
-        string_array() {}
-        string_array(const string_array&) = delete;
-        std::size_t size() const { return strings.size(); }
-        const char** data() { return c_strs.data(); }
-        void push_back(std::string s)
-        {
-            strings.push_back(std::move(s));
-            c_strs.push_back(strings.back().c_str());
-        }
-        // Use to avoid invalidation of pointers to existing strings
-        // stored in 'c_strs' when new items added to 'strings'.
-        void reserve(size_t new_cap) { strings.reserve(new_cap); }
-    };
-
     hiprtc_program_ptr prog = nullptr;
-    string_ptr_array include_texts{}; // Copying of text is not necessary.
-    string_array include_names{};
 
     std::string_view src_name;
     std::string_view src_text;
@@ -859,15 +830,13 @@ public:
         // of the addkernels tool. We don't do that for HIP sources, and, therefore
         // have to export include files prior compilation.
         // Note that we do not need any "subdirs" in the include "pathnames" so far.
-        const auto inc_names = miopen::GetKernelIncList();
-        include_names.reserve(inc_names.size());
-        for(const auto& inc_name : inc_names)
-        {
-            const auto inc_text = GetKernelInc(inc_name);
-            LogInputFile(inc_name, inc_text);
-            include_names.push_back(inc_name.get().string());
-            include_texts.push_back(inc_text);
-        }
+        // The table is assembled once per process, only the pointer arrays are copied
+        // because HIPRTC wants them non-const.
+        const auto& includes = miopen::GetKernelIncludeTable();
+        for(std::size_t i = 0; i < includes.names.size(); ++i)
+            LogInputFile(includes.names[i], includes.contents[i]);
+        auto include_texts = includes.texts;
+        auto include_names = includes.name_ptrs;
         prog = CreateProgram(
             src_text, src_name, include_texts.size(), include_texts.data(), include_names.data());
     }
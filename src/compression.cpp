@@ -0,0 +1,184 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/compression.hpp>
+#include <miopen/bz2.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+#if MIOPEN_USE_ZSTD
+#include <zstd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_KERN_DB_CODEC)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_KERN_DB_ZSTD_LEVEL, 12)
+
+namespace miopen {
+
+namespace {
+
+#if MIOPEN_USE_ZSTD
+void CheckZstdError(std::size_t ret, const std::string& name)
+{
+    if(ZSTD_isError(ret) != 0u)
+        throw std::runtime_error(name + " failed: " + ZSTD_getErrorName(ret));
+}
+
+std::vector<char> ZstdCompress(const std::vector<char>& v, bool* compressed)
+{
+    using CCtxPtr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
+    thread_local auto ctx = CCtxPtr{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    if(ctx == nullptr)
+        throw std::runtime_error("ZSTD_createCCtx failed: out of memory!");
+
+    const auto level = static_cast<int>(
+        std::min<uint64_t>(env::value(MIOPEN_KERN_DB_ZSTD_LEVEL), ZSTD_maxCLevel()));
+    ZSTD_CCtx_reset(ctx.get(), ZSTD_reset_session_and_parameters);
+    CheckZstdError(ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_compressionLevel, level),
+                   "ZSTD_CCtx_setParameter");
+    // Lets the decompression detect corrupted data the same way bzip2 does
+    CheckZstdError(ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_checksumFlag, 1),
+                   "ZSTD_CCtx_setParameter");
+
+    auto result    = std::vector<char>(ZSTD_compressBound(v.size()));
+    const auto len = ZSTD_compress2(ctx.get(), result.data(), result.size(), v.data(), v.size());
+    CheckZstdError(len, "ZSTD_compress2");
+    if(compressed != nullptr && len >= v.size())
+    {
+        *compressed = false;
+        return v;
+    }
+    result.resize(len);
+    if(compressed != nullptr)
+        *compressed = true;
+    return result;
+}
+
+std::vector<char> ZstdDecompress(const std::vector<char>& v, std::size_t size)
+{
+    using DCtxPtr = std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)>;
+    thread_local auto ctx = DCtxPtr{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    if(ctx == nullptr)
+        throw std::runtime_error("ZSTD_createDCtx failed: out of memory!");
+
+    // The size is known from the database, so the frame is decoded straight into the result.
+    auto result    = std::vector<char>(size);
+    const auto len = ZSTD_decompressDCtx(ctx.get(), result.data(), size, v.data(), v.size());
+    CheckZstdError(len, "ZSTD_decompressDCtx");
+    if(len != size)
+        throw std::runtime_error("ZSTD_decompressDCtx failed: unexpected size of the data");
+    return result;
+}
+#endif
+
+} // namespace
+
+bool IsAvailable(CompressionCodec codec)
+{
+    switch(codec)
+    {
+    case CompressionCodec::Bzip2: return true;
+    case CompressionCodec::Zstd: return MIOPEN_USE_ZSTD != 0;
+    }
+    return false;
+}
+
+std::string ToString(CompressionCodec codec)
+{
+    switch(codec)
+    {
+    case CompressionCodec::Bzip2: return "bzip2";
+    case CompressionCodec::Zstd: return "zstd";
+    }
+    return "unknown(" + std::to_string(static_cast<int>(codec)) + ")";
+}
+
+CompressionCodec GetDefaultCodec()
+{
+    static const auto codec = [] {
+        const auto fastest = MIOPEN_USE_ZSTD ? CompressionCodec::Zstd : CompressionCodec::Bzip2;
+        const auto& name   = env::value(MIOPEN_KERN_DB_CODEC);
+        if(name.empty())
+            return fastest;
+        for(const auto c : {CompressionCodec::Bzip2, CompressionCodec::Zstd})
+        {
+            if(name != ToString(c))
+                continue;
+            if(IsAvailable(c))
+                return c;
+            MIOPEN_LOG_W("MIOPEN_KERN_DB_CODEC: " << name << " is not available in this build");
+            return fastest;
+        }
+        MIOPEN_LOG_W("MIOPEN_KERN_DB_CODEC: unknown codec " << name);
+        return fastest;
+    }();
+    return codec;
+}
+
+std::vector<char> Compress(CompressionCodec codec, const std::vector<char>& v, bool* compressed)
+{
+    switch(codec)
+    {
+    case CompressionCodec::Bzip2: return compress(v, compressed);
+#if MIOPEN_USE_ZSTD
+    case CompressionCodec::Zstd: return ZstdCompress(v, compressed);
+#else
+    case CompressionCodec::Zstd: break;
+#endif
+    }
+    throw std::runtime_error("Compress failed: " + ToString(codec) + " is not available");
+}
+
+std::vector<char> Decompress(CompressionCodec codec, const std::vector<char>& v, std::size_t size)
+{
+    switch(codec)
+    {
+    case CompressionCodec::Bzip2: {
+        // bzip2 sizes are 32 bit
+        if(size > std::numeric_limits<unsigned int>::max())
+            throw std::runtime_error("BZ2_bzBuffToBuffDecompress failed: the data is too large");
+        auto result = decompress(v, static_cast<unsigned int>(size));
+        if(result.size() != size)
+            throw std::runtime_error(
+                "BZ2_bzBuffToBuffDecompress failed: unexpected size of the data");
+        return result;
+    }
+#if MIOPEN_USE_ZSTD
+    case CompressionCodec::Zstd: return ZstdDecompress(v, size);
+#else
+    case CompressionCodec::Zstd: break;
+#endif
+    }
+    throw std::runtime_error("Decompress failed: " + ToString(codec) + " is not available");
+}
+
+} // namespace miopen
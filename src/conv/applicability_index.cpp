@@ -0,0 +1,257 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/applicability_index.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/solvers.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+
+#include <functional>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_APPLICABILITY_INDEX)
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+enum State : std::uint8_t
+{
+    Unknown       = 0,
+    Applicable    = 1,
+    NotApplicable = 2,
+};
+
+ProblemFeature Pick(bool condition, ProblemFeature yes, ProblemFeature no)
+{
+    return condition ? yes : no;
+}
+
+} // namespace
+
+ProblemFeatures GetProblemFeatures(const ExecutionContext& ctx, const ProblemDescription& problem)
+{
+    auto features = ProblemFeatures{0};
+    const auto add = [&](ProblemFeature feature) { features |= ToMask(feature); };
+
+    switch(problem.GetDirection())
+    {
+    case Direction::Forward: add(ProblemFeature::Forward); break;
+    case Direction::BackwardData: add(ProblemFeature::BackwardData); break;
+    case Direction::BackwardWeights: add(ProblemFeature::BackwardWeights); break;
+    }
+
+    if(problem.Is2d())
+        add(ProblemFeature::Spatial2d);
+    else if(problem.Is3d())
+        add(ProblemFeature::Spatial3d);
+
+    if(problem.IsFp8() || problem.IsBfp8())
+        add(ProblemFeature::Fp8);
+    else if(problem.IsFp32())
+        add(ProblemFeature::Fp32);
+    else if(problem.IsFp16())
+        add(ProblemFeature::Fp16);
+    else if(problem.IsBfp16())
+        add(ProblemFeature::Bfp16);
+    else if(problem.IsInt8())
+        add(ProblemFeature::Int8);
+
+    if(problem.IsLayoutDefault())
+        add(ProblemFeature::LayoutDefault);
+    else if(problem.IsLayoutNHWC())
+        add(ProblemFeature::LayoutNHWC);
+    else if(problem.IsLayoutNCHWc())
+        add(ProblemFeature::LayoutNCHWc);
+
+    add(Pick(problem.IsTensorsCasted(), ProblemFeature::Casted, ProblemFeature::NotCasted));
+    add(Pick(problem.HasNonPackedTensors(), ProblemFeature::NonPacked, ProblemFeature::Packed));
+    add(Pick(problem.GetGroupCount() == 1, ProblemFeature::SingleGroup, ProblemFeature::Grouped));
+    add(Pick(ctx.use_asm_kernels, ProblemFeature::AsmKernels, ProblemFeature::NoAsmKernels));
+    add(Pick(ctx.use_hip_kernels, ProblemFeature::HipKernels, ProblemFeature::NoHipKernels));
+    add(Pick(ctx.use_opencl_convolutions,
+             ProblemFeature::OpenCLKernels,
+             ProblemFeature::NoOpenCLKernels));
+    return features;
+}
+
+ApplicabilityIndex& ApplicabilityIndex::Get()
+{
+    static ApplicabilityIndex index{4096};
+    return index;
+}
+
+ApplicabilityIndex::ApplicabilityIndex(std::size_t max_problems_) : max_problems(max_problems_)
+{
+    for(const auto& id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
+    {
+        if(id.Value() >= constraints.size())
+            constraints.resize(id.Value() + 1);
+        const auto solver = id.GetSolver();
+        if(!solver.IsEmpty())
+            constraints[id.Value()] = solver.GetApplicabilityConstraints();
+    }
+}
+
+ProblemKey ApplicabilityIndex::MakeKey(const ExecutionContext& ctx,
+                                       const ProblemDescription& problem)
+{
+    auto key = problem.MakeProblemKey();
+
+    // Fields the network config leaves out
+    key.AddRange(problem.GetIn().GetStrides());
+    key.AddRange(problem.GetWeights().GetStrides());
+    key.AddRange(problem.GetOut().GetStrides());
+    key.Add(problem.GetVectorLength());
+    key.Add(problem.GetBias());
+    const auto& conv = problem.GetConv();
+    key.Add(conv.mode).Add(conv.paddingMode);
+    key.Add(conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_FP16_ALT_IMPL));
+    key.Add(conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_DETERMINISTIC));
+    key.Add(conv.attribute.Get(MIOPEN_CONVOLUTION_ATTRIB_FP8_ROUNDING_MODE));
+
+    // The device and the context
+    auto& handle = ctx.GetStream();
+    key.AddString(handle.GetTargetProperties().DbId());
+    key.Add(std::hash<std::string>{}(handle.GetDeviceName()));
+    key.Add(handle.GetMaxComputeUnits()).Add(handle.GetWavefrontWidth());
+    key.Add(handle.GetMaxMemoryAllocSize()).Add(handle.CooperativeLaunchSupported());
+    key.Add(ctx.use_asm_kernels).Add(ctx.use_hip_kernels).Add(ctx.use_opencl_convolutions);
+    key.Add(ctx.rmv.getValue()).Add(ctx.do_search);
+    key.Add(std::hash<std::string>{}(ctx.general_compile_options));
+    key.Add(env::getEnvironmentGeneration());
+    key.Add(debug::AlwaysEnableConvDirectNaive).Add(debug::IsWarmupOngoing);
+    return key;
+}
+
+std::shared_ptr<ApplicabilityIndex::Entry>
+ApplicabilityIndex::Find(const ExecutionContext& ctx, const ProblemDescription& problem)
+{
+    const auto key = MakeKey(ctx, problem);
+    ++lookups;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto found = entries.find(key);
+    if(found != entries.end())
+    {
+        ++hits;
+        recent.splice(recent.begin(), recent, found->second.age);
+        return found->second.entry;
+    }
+
+    // Drops the least recently used problem, which includes those of a stale environment.
+    // Entries in use stay alive with their queries.
+    if(entries.size() >= max_problems && !recent.empty())
+    {
+        entries.erase(entries.find(*recent.back()));
+        recent.pop_back();
+    }
+
+    auto entry      = std::make_shared<Entry>();
+    entry->features = GetProblemFeatures(ctx, problem);
+    entry->states   = std::make_unique<std::atomic<std::uint8_t>[]>(constraints.size());
+    for(std::size_t i = 0; i < constraints.size(); ++i)
+        entry->states[i].store(Unknown, std::memory_order_relaxed);
+    const auto inserted = entries.emplace(key, Slot{entry, {}}).first;
+    recent.push_front(&inserted->first);
+    inserted->second.age = recent.begin();
+    return entry;
+}
+
+std::optional<bool> ApplicabilityIndex::Lookup(Entry& entry, const solver::Id& id)
+{
+    if(!id.IsValid() || id.Value() >= constraints.size())
+        return std::nullopt;
+
+    if(!constraints[id.Value()].Admits(entry.features))
+    {
+        ++pruned;
+        return false;
+    }
+
+    const auto state = entry.states[id.Value()].load(std::memory_order_relaxed);
+    if(state == Unknown)
+    {
+        ++evaluated;
+        return std::nullopt;
+    }
+    ++memoized;
+    return state == Applicable;
+}
+
+void ApplicabilityIndex::Store(Entry& entry, const solver::Id& id, bool applicable)
+{
+    if(!id.IsValid() || id.Value() >= constraints.size())
+        return;
+    entry.states[id.Value()].store(applicable ? Applicable : NotApplicable,
+                                   std::memory_order_relaxed);
+}
+
+const ApplicabilityConstraints& ApplicabilityIndex::GetConstraints(const solver::Id& id) const
+{
+    static const ApplicabilityConstraints unconstrained{};
+    if(!id.IsValid() || id.Value() >= constraints.size())
+        return unconstrained;
+    return constraints[id.Value()];
+}
+
+ApplicabilityIndex::Stats ApplicabilityIndex::GetStats() const
+{
+    auto stats      = Stats{};
+    stats.lookups   = lookups;
+    stats.hits      = hits;
+    stats.pruned    = pruned;
+    stats.memoized  = memoized;
+    stats.evaluated = evaluated;
+    return stats;
+}
+
+void ApplicabilityIndex::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    recent.clear();
+}
+
+ApplicabilityQuery::ApplicabilityQuery(const ExecutionContext& ctx_,
+                                       const ProblemDescription& problem_)
+    : ctx(ctx_), problem(problem_)
+{
+    if(!env::disabled(MIOPEN_DEBUG_CONV_APPLICABILITY_INDEX))
+        entry = ApplicabilityIndex::Get().Find(ctx, problem);
+}
+
+bool ApplicabilityQuery::IsApplicable(const solver::Id& id) const
+{
+    return IsApplicable(id, id.GetSolver());
+}
+
+} // namespace conv
+} // namespace miopen
@@ -27,8 +27,12 @@
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
 #include <fdeep/fdeep.hpp>
+#include <miopen/conv/heuristics/dense_net.hpp>
 #include <miopen/filesystem.hpp>
 
+#include <mutex>
+#include <optional>
+
 namespace miopen {
 namespace ai {
 namespace common {
@@ -126,10 +130,12 @@ public:
     Metadata metadata;
     Model(const std::string& arch)
         : metadata(Metadata(arch)),
-          model(fdeep::load_model(ModelPath(arch), true, fdeep::dev_null_logger)),
-          input_shape(fdeep::tensor_shape(metadata.num_inputs)),
+          net(common::LoadJSON(ModelPath(arch))),
           offset(metadata.num_outputs - metadata.num_solvers)
     {
+        if(net.GetNumInputs() != metadata.num_inputs ||
+           net.GetNumOutputs() != metadata.num_outputs)
+            MIOPEN_THROW(miopenStatusInternalError, "TunaNet model doesn't match its metadata");
     }
     virtual ~Model() = default;
     /** Is given problem supported by TunaNet?
@@ -145,28 +151,49 @@ public:
      */
     virtual bool IsProblemSupported(const conv::ProblemDescription& problem,
                                     const ExecutionContext& ctx) const = 0;
-    /** Forward (i.e., run inference on) problem through TunaNet
+    /** Forward (i.e., run inference on) a batch of problems through TunaNet
      *
-     * This function takes in a problem, converts it to a numeric vector and feeds it TunaNet
-     * for inference. Its output is a numeric vector that represents a probability distribution.
-     * Each index in this vector represents a solver (as given in metadata.solver_map) and the
-     * value at each index represents the probability that that solver is the fastest for given
-     * convolution problem.
+     * This function converts each problem to a numeric vector and feeds them all to TunaNet
+     * for inference at once. For each problem, it writes a row of metadata.num_solvers values
+     * to `scores`, which represents a probability distribution. Each index in the row
+     * represents a solver (as given in metadata.solver_map) and the value at each index
+     * represents the probability that that solver is the fastest for the problem.
      *
-     * @param problem Problem
+     * Buffers are kept per thread, so that repeated calls don't allocate.
+     *
+     * @param problems Problems
+     * @param count Number of problems
+     * @param scores Rows of scores, one per problem
      */
-    std::vector<float> Forward(const conv::ProblemDescription& problem) const
+    void Forward(const conv::ProblemDescription* const* problems,
+                 std::size_t count,
+                 std::vector<float>& scores) const
     {
-        std::vector<float> features       = ToFeatures(problem);
-        std::vector<fdeep::tensor> output = model.predict({fdeep::tensor(input_shape, features)});
-        std::vector<float> output_vector  = output.front().to_vector();
-        std::vector<float> res(output_vector.begin() + offset, output_vector.end());
-        return res;
+        thread_local auto features  = std::vector<float>{};
+        thread_local auto outputs   = std::vector<float>{};
+        thread_local auto workspace = DenseNet::Workspace{};
+
+        const auto num_inputs  = metadata.num_inputs;
+        const auto num_outputs = metadata.num_outputs;
+        const auto num_solvers = metadata.num_solvers;
+
+        features.resize(count * num_inputs);
+        outputs.resize(count * num_outputs);
+        for(std::size_t i = 0; i < count; ++i)
+            ToFeatures(*problems[i], features.data() + i * num_inputs);
+
+        net.Forward(features.data(), count, outputs.data(), workspace);
+
+        scores.resize(count * num_solvers);
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            const auto* row = outputs.data() + i * num_outputs + offset;
+            std::copy(row, row + num_solvers, scores.begin() + i * num_solvers);
+        }
     }
 
 protected:
-    const fdeep::model model;              // TunaNet model
-    const fdeep::tensor_shape input_shape; // Shape of input tensor required by TunaNet
+    const DenseNet net;  // TunaNet model
     const size_t offset; // Some TunaNet models output some "fluff" before they output kernel
                          // probabilites. This offset tells how many indexes of fluff need to
                          // be skipped in order to get to kernel probabilities.
@@ -177,12 +204,12 @@ protected:
      *
      * @param arch Architecture
      */
-    static std::string ModelPath(const std::string& arch)
+    static fs::path ModelPath(const std::string& arch)
     {
         const auto file_path = GetSystemDbPath() / (arch + ".tn.model");
         if(!fs::exists(file_path))
             MIOPEN_THROW(miopenStatusInternalError, "Unable to load AI model file:" + file_path);
-        return file_path.string();
+        return file_path;
     }
     /** Convert given problem to a numeric vector
      *
@@ -192,8 +219,22 @@ protected:
      * by each sub-class of `Model` on its own.
      *
      * @param problem Problem
+     * @param features Output, metadata.num_inputs values
      */
-    virtual std::vector<float> ToFeatures(const conv::ProblemDescription& problem) const = 0;
+    virtual void ToFeatures(const conv::ProblemDescription& problem, float* features) const = 0;
+
+    /// Normalizes the raw features of a problem into `features`
+    template <std::size_t N>
+    void Normalize(const float (&raw)[N],
+                   const std::vector<float>& mean,
+                   const std::vector<float>& stddev,
+                   float* features) const
+    {
+        if(N != metadata.num_inputs)
+            MIOPEN_THROW(miopenStatusInternalError, "TunaNet features don't match its metadata");
+        for(size_t i = 0; i < N; ++i)
+            features[i] = (raw[i] - mean[i]) / stddev[i];
+    }
 };
 
 class Gfx908Model final : public Model
@@ -267,10 +308,10 @@ public:
     }
 
 protected:
-    std::vector<float> ToFeatures(const conv::ProblemDescription& problem) const override
+    void ToFeatures(const conv::ProblemDescription& problem, float* features) const override
     {
-        const bool isFwd            = problem.GetDirection() == conv::Direction::Forward;
-        std::vector<float> features = {
+        const bool isFwd  = problem.GetDirection() == conv::Direction::Forward;
+        const float raw[] = {
             static_cast<float>(isFwd ? problem.GetInChannels() : problem.GetOutChannels()),
             static_cast<float>(isFwd ? problem.GetInDepth() : problem.GetOutDepth()),
             static_cast<float>(isFwd ? problem.GetInHeight() : problem.GetOutHeight()),
@@ -298,11 +339,7 @@ protected:
             static_cast<float>(metadata.EncodeDirection(problem.GetDirection())),
             static_cast<float>(problem.GetGroupCount())};
 
-        // normalize
-        for(size_t i = 0; i < features.size(); ++i)
-            features[i] = (features[i] - metadata.features_mean[i]) / metadata.features_std[i];
-
-        return features;
+        Normalize(raw, metadata.features_mean, metadata.features_std, features);
     }
 };
 
@@ -368,10 +405,10 @@ public:
     }
 
 protected:
-    std::vector<float> ToFeatures(const conv::ProblemDescription& problem) const override
+    void ToFeatures(const conv::ProblemDescription& problem, float* features) const override
     {
-        const bool isFwd            = problem.GetDirection() == conv::Direction::Forward;
-        std::vector<float> features = {
+        const bool isFwd  = problem.GetDirection() == conv::Direction::Forward;
+        const float raw[] = {
             static_cast<float>(isFwd ? problem.GetInChannels() : problem.GetOutChannels()),
             static_cast<float>(isFwd ? problem.GetInHeight() : problem.GetOutHeight()),
             static_cast<float>(isFwd ? problem.GetInWidth() : problem.GetOutWidth()),
@@ -391,11 +428,7 @@ protected:
             static_cast<float>(metadata.EncodeDirection(problem.GetDirection())),
             static_cast<float>(problem.GetGroupCount())};
 
-        // normalize
-        for(size_t i = 0; i < features.size(); ++i)
-            features[i] = (features[i] - metadata.features_mean[i]) / metadata.features_std[i];
-
-        return features;
+        Normalize(raw, metadata.features_mean, metadata.features_std, features);
     }
 };
 
@@ -461,10 +494,10 @@ public:
     }
 
 protected:
-    std::vector<float> ToFeatures(const conv::ProblemDescription& problem) const override
+    void ToFeatures(const conv::ProblemDescription& problem, float* features) const override
     {
-        const bool isFwd            = problem.GetDirection() == conv::Direction::Forward;
-        std::vector<float> features = {
+        const bool isFwd  = problem.GetDirection() == conv::Direction::Forward;
+        const float raw[] = {
             static_cast<float>(isFwd ? problem.GetInChannels() : problem.GetOutChannels()),
             static_cast<float>(isFwd ? problem.GetInHeight() : problem.GetOutHeight()),
             static_cast<float>(isFwd ? problem.GetInWidth() : problem.GetOutWidth()),
@@ -484,12 +517,7 @@ protected:
             static_cast<float>(metadata.EncodeDirection(problem.GetDirection())),
             static_cast<float>(problem.GetGroupCount())};
 
-        // normalize
-        for(size_t i = 0; i < features.size(); ++i)
-            features[i] =
-                (features[i] - metadata.test_features_mean[i]) / metadata.test_features_std[i];
-
-        return features;
+        Normalize(raw, metadata.test_features_mean, metadata.test_features_std, features);
     }
 };
 
@@ -502,45 +530,53 @@ std::unique_ptr<Model> GetModel(const std::string& device)
     return std::make_unique<Gfx908Model>(); // default model if GPU-specific model is not available
 }
 
-std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
-                                    const ExecutionContext& ctx,
-                                    const std::string& device)
+/// Models are loaded once per device and kept for the lifetime of the process
+const Model& GetCachedModel(const std::string& device)
 {
-    const static std::unique_ptr<Model> model = GetModel(device);
-    if(!model || !model->IsProblemSupported(problem, ctx))
-        return {};
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<Model>> models;
+
+    const std::lock_guard<std::mutex> lock{mutex};
+    auto& model = models[device];
+    if(!model)
+        model = GetModel(device);
+    return *model;
+}
 
-    std::string est_name = ":memory:" + device;
-    auto& db             = AnyRamDb::GetCached(est_name);
-    auto db_res          = db.FindRecord(problem);
-    if(db_res)
+std::optional<std::vector<uint64_t>> FindCachedSolvers(AnyRamDb& db,
+                                                       const conv::ProblemDescription& problem)
+{
+    auto db_res = db.FindRecord(problem);
+    if(!db_res)
+        return std::nullopt;
+
+    MIOPEN_LOG_I2("Cached heuristic (TunaNet) result found");
+    std::vector<uint64_t> db_sol(db_res->size());
+    // cast returned record to solver ids
+    std::transform(db_res->begin(), db_res->end(), db_sol.begin(), [](boost::any id) {
+        return boost::any_cast<uint64_t>(id);
+    });
+    if(miopen::IsLogging(LoggingLevel::Info2))
     {
-        MIOPEN_LOG_I2("Cached heuristic (TunaNet) result found");
-        std::vector<uint64_t> db_sol(db_res->size());
-        // cast returned record to solver ids
-        std::transform(db_res->begin(), db_res->end(), db_sol.begin(), [](boost::any id) {
-            return boost::any_cast<uint64_t>(id);
-        });
-        if(miopen::IsLogging(LoggingLevel::Info2))
-        {
-            std::stringstream ss;
-            for(auto& id : db_sol)
-                ss << solver::Id{id}.ToString() << " ID:" << id << ", ";
-            MIOPEN_LOG_I2("Cached solvers: " << ss.str());
-        }
-        return db_sol;
+        std::stringstream ss;
+        for(auto& id : db_sol)
+            ss << solver::Id{id}.ToString() << " ID:" << id << ", ";
+        MIOPEN_LOG_I2("Cached solvers: " << ss.str());
     }
+    return db_sol;
+}
 
-    MIOPEN_LOG_I2("Evaluating TunaNet");
-    std::vector<float> res = model->Forward(problem); // res[i] gives the probability that the
-                                                      // i-th solver is the fastest for given
-                                                      // problem. ( The exact name of the i-th
-                                                      // solver may be obtained as follows:
-                                                      // model->metadata.solver_map.at(i) )
-
+/// Orders the solvers by their scores (res[i] gives the probability that the i-th solver is
+/// the fastest for given problem, the exact name of the i-th solver may be obtained as follows:
+/// model.metadata.solver_map.at(i)) and caches the result.
+std::vector<uint64_t> StoreSolvers(const Model& model,
+                                   AnyRamDb& db,
+                                   const conv::ProblemDescription& problem,
+                                   const float* res)
+{
     // sort solvers in order of their probabilities
-    std::vector<std::pair<int, float>> sort_res(res.size());
-    for(auto idx = 0; idx < res.size(); idx++)
+    std::vector<std::pair<int, float>> sort_res(model.metadata.num_solvers);
+    for(auto idx = 0; idx < sort_res.size(); idx++)
         sort_res[idx] = {idx, res[idx]};
     const auto cmp = [](const std::pair<int, float>& a, const std::pair<int, float>& b) -> bool {
         return a.second > b.second;
@@ -553,10 +589,10 @@ std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
     for(const auto& kinder : sort_res)
     {
         const auto id     = kinder.first; // index of solver in probability vector
-        const auto sol_id = solver::Id{model->metadata.solver_map.at(id)};
+        const auto sol_id = solver::Id{model.metadata.solver_map.at(id)};
         if(!sol_id.IsValid())
         {
-            MIOPEN_LOG_I2("Invalid solver " << model->metadata.solver_map.at(id) << " removed");
+            MIOPEN_LOG_I2("Invalid solver " << model.metadata.solver_map.at(id) << " removed");
             continue;
         }
         sol.push_back(sol_id.Value());
@@ -572,6 +608,64 @@ std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
     }
     return sol;
 }
+
+std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
+                                    const ExecutionContext& ctx,
+                                    const std::string& device)
+{
+    const auto& model = GetCachedModel(device);
+    if(!model.IsProblemSupported(problem, ctx))
+        return {};
+
+    std::string est_name = ":memory:" + device;
+    auto& db             = AnyRamDb::GetCached(est_name);
+    if(auto cached = FindCachedSolvers(db, problem))
+        return *std::move(cached);
+
+    MIOPEN_LOG_I2("Evaluating TunaNet");
+    thread_local auto scores = std::vector<float>{};
+    const auto* const batch  = &problem;
+    model.Forward(&batch, 1, scores);
+    return StoreSolvers(model, db, problem, scores.data());
+}
+
+std::vector<std::vector<uint64_t>>
+PredictSolvers(const std::vector<conv::ProblemDescription>& problems,
+               const ExecutionContext& ctx,
+               const std::string& device)
+{
+    const auto& model = GetCachedModel(device);
+    auto& db          = AnyRamDb::GetCached(":memory:" + device);
+    auto results      = std::vector<std::vector<uint64_t>>(problems.size());
+    auto pending      = std::vector<const conv::ProblemDescription*>{};
+    auto indices      = std::vector<std::size_t>{};
+
+    for(std::size_t i = 0; i < problems.size(); ++i)
+    {
+        if(!model.IsProblemSupported(problems[i], ctx))
+            continue;
+        if(auto cached = FindCachedSolvers(db, problems[i]))
+        {
+            results[i] = *std::move(cached);
+            continue;
+        }
+        pending.push_back(&problems[i]);
+        indices.push_back(i);
+    }
+
+    if(pending.empty())
+        return results;
+
+    MIOPEN_LOG_I2("Evaluating TunaNet for " << pending.size() << " problems");
+    auto scores = std::vector<float>{};
+    model.Forward(pending.data(), pending.size(), scores);
+    for(std::size_t i = 0; i < pending.size(); ++i)
+    {
+        results[indices[i]] = StoreSolvers(
+            model, db, *pending[i], scores.data() + i * model.metadata.num_solvers);
+    }
+    return results;
+}
 } // namespace immed_mode
 #endif // MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
 
@@ -0,0 +1,425 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/heuristics/dense_net.hpp>
+
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+namespace miopen {
+namespace ai {
+
+namespace {
+
+/// Rows of the weights and of the activations are padded to a multiple of this many floats
+constexpr std::size_t lanes = 16;
+constexpr std::size_t alignment = lanes * sizeof(float);
+/// Rows of a batch evaluated at once
+constexpr std::size_t block_rows = 16;
+
+std::size_t Pad(std::size_t units) { return (units + lanes - 1) / lanes * lanes; }
+
+/// Offset, in floats, of the first aligned float of the buffer
+std::size_t AlignedOffset(const std::vector<float>& buffer)
+{
+    const auto address = reinterpret_cast<std::uintptr_t>(buffer.data());
+    return ((alignment - address % alignment) % alignment) / sizeof(float);
+}
+
+std::vector<unsigned char> DecodeBase64(const std::string& text)
+{
+    static const auto table = []() {
+        const auto digits = std::string{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                                        "0123456789+/"};
+        auto values       = std::array<int, 256>{};
+        values.fill(-1);
+        for(std::size_t i = 0; i < digits.size(); ++i)
+            values[static_cast<unsigned char>(digits[i])] = static_cast<int>(i);
+        return values;
+    }();
+
+    auto bytes = std::vector<unsigned char>{};
+    bytes.reserve(text.size() / 4 * 3);
+    auto bits  = 0u;
+    auto count = 0;
+    for(const auto c : text)
+    {
+        if(c == '=')
+            break;
+        const auto value = table[static_cast<unsigned char>(c)];
+        if(value < 0)
+            MIOPEN_THROW(miopenStatusInvalidValue, "Invalid base64 character in the model");
+        bits = (bits << 6) | static_cast<unsigned>(value);
+        count += 6;
+        if(count >= 8)
+        {
+            count -= 8;
+            bytes.push_back(static_cast<unsigned char>(bits >> count));
+        }
+    }
+    return bytes;
+}
+
+/// frugally-deep stores arrays of floats as lists of base64 encoded chunks
+std::vector<float> DecodeFloats(const nlohmann::json& chunks)
+{
+    auto bytes = std::vector<unsigned char>{};
+    for(const auto& chunk : chunks)
+    {
+        const auto decoded = DecodeBase64(chunk.get<std::string>());
+        bytes.insert(bytes.end(), decoded.begin(), decoded.end());
+    }
+    if(bytes.size() % sizeof(float) != 0)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Truncated array of floats in the model");
+
+    auto values = std::vector<float>(bytes.size() / sizeof(float));
+    std::memcpy(values.data(), bytes.data(), bytes.size());
+    return values;
+}
+
+std::string GetInputName(const nlohmann::json& inbound, std::size_t index)
+{
+    return inbound.at(0).at(index).at(0).get<std::string>();
+}
+
+/// y = x * w + b for a block of rows. The rows of w and b are padded to the stride of y.
+///
+/// Each row of the block is accumulated a tile of lanes outputs at a time. The fixed size of the
+/// tile lets the compiler keep it in vector registers, and the tile of the weights stays in
+/// cache for the next rows.
+void Dense(const float* x,
+           std::size_t x_stride,
+           std::size_t in_units,
+           const float* w,
+           const float* b,
+           std::size_t stride,
+           std::size_t rows,
+           float* y)
+{
+    for(std::size_t o = 0; o < stride; o += lanes)
+    {
+        for(std::size_t r = 0; r < rows; ++r)
+        {
+            const auto* x_row = x + r * x_stride;
+            auto tile         = std::array<float, lanes>{};
+            std::copy(b + o, b + o + lanes, tile.begin());
+
+            for(std::size_t i = 0; i < in_units; ++i)
+            {
+                const auto* w_tile = w + i * stride + o;
+                for(std::size_t l = 0; l < lanes; ++l)
+                    tile[l] += x_row[i] * w_tile[l];
+            }
+
+            std::copy(tile.begin(), tile.end(), y + r * stride + o);
+        }
+    }
+}
+
+void Relu(float* y, std::size_t size)
+{
+    for(std::size_t i = 0; i < size; ++i)
+        y[i] = std::max(y[i], 0.0f);
+}
+
+} // namespace
+
+DenseNet::DenseNet(const nlohmann::json& model, bool verify)
+{
+    const auto& input_shapes  = model.at("input_shapes");
+    const auto& output_shapes = model.at("output_shapes");
+    if(input_shapes.size() != 1 || input_shapes.at(0).size() != 1 || output_shapes.size() != 1 ||
+       output_shapes.at(0).size() != 1)
+        MIOPEN_THROW(miopenStatusNotImplemented, "Only models of a vector to a vector supported");
+
+    num_inputs  = input_shapes.at(0).at(0).get<std::size_t>();
+    num_outputs = output_shapes.at(0).at(0).get<std::size_t>();
+
+    const auto& config = model.at("architecture").at("config");
+    const auto& params = model.at("trainable_params");
+
+    // Fusing a ReLU into the layer it follows is only valid when nothing else uses its outputs
+    auto consumers = std::unordered_map<std::string, std::size_t>{};
+    for(const auto& layer : config.at("layers"))
+        for(const auto& node : layer.at("inbound_nodes"))
+            for(const auto& input : node)
+                ++consumers[input.at(0).get<std::string>()];
+
+    struct Node
+    {
+        std::size_t offset;
+        std::size_t units;
+        /// The layer which computes the node, none for the inputs
+        std::size_t layer;
+    };
+
+    const auto none = std::numeric_limits<std::size_t>::max();
+    auto nodes      = std::unordered_map<std::string, Node>{};
+    auto staging    = std::vector<float>{};
+
+    const auto get_node = [&](const std::string& name) -> const Node& {
+        const auto node = nodes.find(name);
+        if(node == nodes.end())
+            MIOPEN_THROW(miopenStatusNotImplemented, "Layers are not in the order of evaluation");
+        return node->second;
+    };
+
+    const auto add_layer = [&](const std::string& name, Layer layer) {
+        layer.output = activations;
+        activations += Pad(layer.units);
+        nodes.emplace(name, Node{layer.output, layer.units, layers.size()});
+        layers.push_back(layer);
+    };
+
+    for(const auto& layer : config.at("layers"))
+    {
+        const auto name        = layer.at("name").get<std::string>();
+        const auto class_name  = layer.at("class_name").get<std::string>();
+        const auto& inbound    = layer.at("inbound_nodes");
+        const auto& properties = layer.at("config");
+
+        if(class_name == "InputLayer")
+        {
+            if(activations != 0)
+                MIOPEN_THROW(miopenStatusNotImplemented, "Only models with one input supported");
+            nodes.emplace(name, Node{0, num_inputs, none});
+            activations = Pad(num_inputs);
+            continue;
+        }
+
+        if(inbound.size() != 1)
+            MIOPEN_THROW(miopenStatusNotImplemented, "Shared layers are not supported");
+
+        if(class_name == "Dense")
+        {
+            const auto& input  = get_node(GetInputName(inbound, 0));
+            const auto units   = properties.at("units").get<std::size_t>();
+            const auto act     = properties.value("activation", std::string{"linear"});
+            const auto weights = DecodeFloats(params.at(name).at("weights"));
+            if(act != "linear" && act != "relu")
+                MIOPEN_THROW(miopenStatusNotImplemented, "Unsupported activation: " + act);
+            if(weights.size() != input.units * units)
+                MIOPEN_THROW(miopenStatusInvalidValue, "Wrong size of the weights of " + name);
+
+            auto bias = std::vector<float>(units);
+            if(properties.value("use_bias", true))
+                bias = DecodeFloats(params.at(name).at("bias"));
+            if(bias.size() != units)
+                MIOPEN_THROW(miopenStatusInvalidValue, "Wrong size of the bias of " + name);
+
+            auto dense        = Layer{};
+            dense.op          = Op::Dense;
+            dense.relu        = act == "relu";
+            dense.units       = units;
+            dense.input       = input.offset;
+            dense.input_units = input.units;
+
+            // Keras stores the weights as an input units x output units matrix
+            const auto stride = Pad(units);
+            dense.weights     = staging.size();
+            for(std::size_t i = 0; i < input.units; ++i)
+            {
+                const auto row = weights.begin() + i * units;
+                staging.insert(staging.end(), row, row + units);
+                staging.resize(staging.size() + stride - units);
+            }
+            dense.bias = staging.size();
+            staging.insert(staging.end(), bias.begin(), bias.end());
+            staging.resize(staging.size() + stride - units);
+
+            add_layer(name, dense);
+        }
+        else if(class_name == "Add")
+        {
+            if(inbound.at(0).size() != 2)
+                MIOPEN_THROW(miopenStatusNotImplemented, "Only Add of two layers supported");
+            const auto& first  = get_node(GetInputName(inbound, 0));
+            const auto& second = get_node(GetInputName(inbound, 1));
+            if(first.units != second.units)
+                MIOPEN_THROW(miopenStatusInvalidValue, "Inputs of " + name + " differ in size");
+
+            auto add        = Layer{};
+            add.op          = Op::Add;
+            add.units       = first.units;
+            add.input       = first.offset;
+            add.other_input = second.offset;
+            add.input_units = first.units;
+            add_layer(name, add);
+        }
+        else if(class_name == "ReLU")
+        {
+            if(!properties.value("max_value", nlohmann::json{}).is_null() ||
+               properties.value("negative_slope", 0.0) != 0.0 ||
+               properties.value("threshold", 0.0) != 0.0)
+                MIOPEN_THROW(miopenStatusNotImplemented, "Only the plain ReLU is supported");
+
+            const auto input_name = GetInputName(inbound, 0);
+            const auto input      = get_node(input_name);
+            if(input.layer != none && consumers[input_name] == 1 && !layers[input.layer].relu)
+            {
+                layers[input.layer].relu = true;
+                nodes.emplace(name, input);
+                continue;
+            }
+
+            auto relu        = Layer{};
+            relu.op          = Op::Relu;
+            relu.units       = input.units;
+            relu.input       = input.offset;
+            relu.input_units = input.units;
+            add_layer(name, relu);
+        }
+        else
+        {
+            MIOPEN_THROW(miopenStatusNotImplemented, "Unsupported layer: " + class_name);
+        }
+    }
+
+    const auto& outputs = config.at("output_layers");
+    if(outputs.size() != 1)
+        MIOPEN_THROW(miopenStatusNotImplemented, "Only models with one output supported");
+    const auto& result = get_node(outputs.at(0).at(0).get<std::string>());
+    if(result.units != num_outputs)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Wrong size of the output");
+    output = result.offset;
+
+    storage       = std::vector<float>(staging.size() + alignment / sizeof(float));
+    params_offset = AlignedOffset(storage);
+    std::copy(staging.begin(), staging.end(), storage.begin() + params_offset);
+
+    if(verify && model.contains("tests"))
+        Verify(model.at("tests"));
+}
+
+void DenseNet::Forward(const float* inputs,
+                       std::size_t batch_size,
+                       float* outputs,
+                       Workspace& workspace) const
+{
+    const auto max_rows = std::min(batch_size, block_rows);
+    const auto size     = max_rows * activations + alignment / sizeof(float);
+    if(workspace.buffer.size() < size)
+        workspace.buffer.resize(size);
+
+    auto* const base    = workspace.buffer.data() + AlignedOffset(workspace.buffer);
+    const auto* weights = Params();
+
+    for(std::size_t first = 0; first < batch_size; first += block_rows)
+    {
+        const auto rows = std::min(block_rows, batch_size - first);
+        // The activations of a layer for the block are rows x padded units
+        const auto at = [&](std::size_t offset) { return base + offset * rows; };
+
+        const auto in_stride = Pad(num_inputs);
+        for(std::size_t r = 0; r < rows; ++r)
+        {
+            const auto* row = inputs + (first + r) * num_inputs;
+            auto* padded    = at(0) + r * in_stride;
+            std::copy(row, row + num_inputs, padded);
+            std::fill(padded + num_inputs, padded + in_stride, 0.0f);
+        }
+
+        for(const auto& layer : layers)
+        {
+            const auto stride = Pad(layer.units);
+            auto* const y     = at(layer.output);
+
+            switch(layer.op)
+            {
+            case Op::Dense:
+                Dense(at(layer.input),
+                      Pad(layer.input_units),
+                      layer.input_units,
+                      weights + layer.weights,
+                      weights + layer.bias,
+                      stride,
+                      rows,
+                      y);
+                break;
+            case Op::Add: {
+                const auto* a = at(layer.input);
+                const auto* b = at(layer.other_input);
+                for(std::size_t i = 0; i < rows * stride; ++i)
+                    y[i] = a[i] + b[i];
+                break;
+            }
+            case Op::Relu: std::copy(at(layer.input), at(layer.input) + rows * stride, y); break;
+            }
+
+            if(layer.relu || layer.op == Op::Relu)
+                Relu(y, rows * stride);
+        }
+
+        const auto out_stride = Pad(num_outputs);
+        for(std::size_t r = 0; r < rows; ++r)
+        {
+            const auto* row = at(output) + r * out_stride;
+            std::copy(row, row + num_outputs, outputs + (first + r) * num_outputs);
+        }
+    }
+}
+
+std::vector<float> DenseNet::Forward(const std::vector<float>& inputs) const
+{
+    if(inputs.size() % num_inputs != 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Inputs are not a whole number of rows");
+
+    const auto batch_size = inputs.size() / num_inputs;
+    auto outputs          = std::vector<float>(batch_size * num_outputs);
+    auto workspace        = Workspace{};
+    Forward(inputs.data(), batch_size, outputs.data(), workspace);
+    return outputs;
+}
+
+void DenseNet::Verify(const nlohmann::json& tests) const
+{
+    for(const auto& test : tests)
+    {
+        const auto inputs   = DecodeFloats(test.at("inputs").at(0).at("values"));
+        const auto expected = DecodeFloats(test.at("outputs").at(0).at("values"));
+        if(inputs.size() != num_inputs || expected.size() != num_outputs)
+            MIOPEN_THROW(miopenStatusInvalidValue, "Wrong size of the test of the model");
+
+        const auto outputs = Forward(inputs);
+        for(std::size_t i = 0; i < num_outputs; ++i)
+        {
+            if(std::abs(outputs[i] - expected[i]) > 1e-4f * std::max(1.0f, std::abs(expected[i])))
+                MIOPEN_THROW(miopenStatusInternalError,
+                             "The model doesn't reproduce the outputs of its test");
+        }
+    }
+}
+
+} // namespace ai
+} // namespace miopen
@@ -185,6 +185,28 @@ void ProblemDescription::MakeNetworkConfig(std::string& conf_key) const
     conf_key = ss.str();
 }
 
+ProblemKey ProblemDescription::MakeProblemKey() const
+{
+    // The fields of the string form, taken without formatting
+    auto key = ProblemKey{"conv"};
+    key.Add(GetSpatialDims());
+    key.Add(GetInChannels()).Add(GetInDepth()).Add(GetInHeight()).Add(GetInWidth());
+    key.Add(GetWeightsDepth()).Add(GetWeightsHeight()).Add(GetWeightsWidth());
+    key.Add(GetOutChannels()).Add(GetOutDepth()).Add(GetOutHeight()).Add(GetOutWidth());
+    key.Add(GetInBatchSize());
+    key.AddString(in_layout).AddString(weights_layout).AddString(out_layout);
+    key.Add(GetInDataType()).Add(GetWeightsDataType()).Add(GetOutDataType());
+    key.AddOptional(GetInCastType()).AddOptional(GetWeightsCastType());
+    key.AddOptional(GetOutCastType());
+    key.Add(GetPadD()).Add(GetPadH()).Add(GetPadW());
+    key.Add(GetKernelStrideD()).Add(GetKernelStrideH()).Add(GetKernelStrideW());
+    key.Add(GetDilationD()).Add(GetDilationH()).Add(GetDilationW());
+    key.Add(GetGroupCount());
+    key.Add(GetDirection());
+    key.Add(GetAlphaBetaCase());
+    return key;
+}
+
 void ProblemDescription::Serialize(std::ostream& stream) const
 {
     const auto sep = '-';
@@ -26,6 +26,7 @@
 
 #include <miopen/conv/solver_finders.hpp>
 
+#include <miopen/benchmark.hpp>
 #include <miopen/conv_algo_name.hpp>
 #include <miopen/config.h>
 #include <miopen/mlo_internal.hpp>
@@ -226,10 +227,15 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
     if(!arch.empty())
         return {};
 
-    auto selected     = miopen::solver::ConvSolution{miopenStatusUnknownError};
-    auto best         = std::numeric_limits<float>::max();
-    auto best_invoker = Invoker{};
-    auto ret          = std::vector<Solution>{};
+    struct Candidate
+    {
+        const solver::ConvSolution* solution;
+        Invoker invoker;
+        std::vector<Program> programs;
+    };
+
+    auto candidates = std::vector<Candidate>{};
+    candidates.reserve(solutions.size());
 
     for(const auto& sol : solutions)
     {
@@ -254,84 +260,80 @@ static std::vector<Solution> EvaluateInvokers(Handle& handle,
         if(!sol.invoker_factory)
             MIOPEN_THROW("Invoker is not provided by solver " + sol.solver_id);
 
-        std::vector<Program> programs;
-        const auto invoker = handle.PrepareInvoker(*sol.invoker_factory,
-                                                   sol.construction_params,
-                                                   force_attach_binary ? &programs : nullptr);
+        auto& candidate    = candidates.emplace_back();
+        candidate.solution = &sol;
+        candidate.invoker  = handle.PrepareInvoker(*sol.invoker_factory,
+                                                  sol.construction_params,
+                                                  force_attach_binary ? &candidate.programs
+                                                                      : nullptr);
+    }
 
-        try
-        {
-            // Run invoker max 6 times, with ~5 sec time limit.
-            using elapsed_t                 = decltype(handle.GetKernelTime());
-            constexpr elapsed_t TIME_MS_MAX = 5000.0;
-            constexpr int N_RUNS_MAX        = 8;
-            constexpr int N_RUNS_DISCARD    = 3;
-            auto elapsed                    = static_cast<elapsed_t>(0);
-            auto first_elapsed              = static_cast<elapsed_t>(0);
-            int i                           = 0;
-            while(i < N_RUNS_MAX && elapsed < TIME_MS_MAX)
-            {
-                invoker(handle, invoke_ctx);
-                elapsed += handle.GetKernelTime();
-                if(i < N_RUNS_DISCARD)
-                    first_elapsed += elapsed;
-                ++i;
-            }
-            // If the execution time was not too long,
-            // then the 1st run is not counted (assume it's warm-up):
-            if(i > 1)
-                elapsed = (elapsed - first_elapsed) / static_cast<elapsed_t>(i - N_RUNS_DISCARD);
-
-            MIOPEN_LOG_I(sol << ": " << elapsed << (elapsed < best ? " < " : " >= ") << best);
-            if(elapsed < best)
-            {
-                best         = elapsed;
-                selected     = sol;
-                best_invoker = invoker;
-            }
-
-            auto solution = Solution{solver::Id{selected.solver_id}, best, selected.workspace_sz};
-            if(force_attach_binary)
-                solution.SetInvoker(invoker, programs, selected.construction_params);
-            else
-                solution.SetInvoker(invoker, {}, {});
-            ret.emplace_back(std::move(solution));
-        }
-        catch(const miopen::Exception& ex)
-        {
-            MIOPEN_LOG_E(ex.what());
-        }
+    auto benchmark = Benchmark{BenchmarkOptions::FromEnv()};
+
+    // Candidates are sampled in rounds, so a brief slowdown of the device hits all of them
+    // alike, and the clearly slower ones stop early.
+    for(auto& candidate : candidates)
+    {
+        benchmark.Add([&handle, &invoke_ctx, invoker = candidate.invoker]() {
+            invoker(handle, invoke_ctx);
+            return handle.GetKernelTime();
+        });
     }
+    const auto stats = benchmark.Run();
 
-    if(!selected.Succeeded())
+    auto ret = std::vector<Solution>{};
+    for(std::size_t i = 0; i < candidates.size(); ++i)
+    {
+        const auto& sol = *candidates[i].solution;
+        if(stats[i].failed)
+            continue;
+
+        MIOPEN_LOG_I(sol << ": " << stats[i].estimate << " [" << stats[i].ci_low << ", "
+                         << stats[i].ci_high << "], " << stats[i].samples << " samples"
+                         << (stats[i].eliminated ? ", eliminated" : ""));
+
+        auto solution = Solution{solver::Id{sol.solver_id}, stats[i].estimate, sol.workspace_sz};
+        solution.SetTimeStdDev(stats[i].stddev);
+        if(force_attach_binary)
+            solution.SetInvoker(
+                candidates[i].invoker, candidates[i].programs, sol.construction_params);
+        else
+            solution.SetInvoker(candidates[i].invoker, {}, {});
+        ret.emplace_back(std::move(solution));
+    }
+
+    const auto best = Benchmark::GetBest(stats);
+    if(best < 0)
         return {};
 
-    handle.RegisterInvoker(best_invoker, network_config, selected.solver_id, algorithm_name);
-    MIOPEN_LOG_I("Selected: " << selected << ": " << best
+    const auto& selected = *candidates[best].solution;
+    handle.RegisterInvoker(
+        candidates[best].invoker, network_config, selected.solver_id, algorithm_name);
+    MIOPEN_LOG_I("Selected: " << selected << ": " << stats[best].estimate
                               << ", workspace_sz = " << selected.workspace_sz);
 
     return ret;
 }
 
-FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
-                        const ExecutionContext& ctx,
-                        const ProblemDescriptionBase& problem,
-                        const PrimitiveFindParameters& parameters,
-                        const std::vector<std::unique_ptr<ISolversFinder>>& finders,
-                        const std::optional<FindOptions>& options,
-                        bool force_attach_binary)
-{
-    auto& handle = ctx.GetStream();
+using SolutionsByAlgorithm = std::map<AlgorithmName, std::vector<solver::ConvSolution>>;
 
-    // Find
-    auto solutions = std::map<AlgorithmName, std::vector<solver::ConvSolution>>{};
+static SolutionsByAlgorithm
+FindAllSolutions(const AnyInvokeParams& invoke_ctx,
+                 const ExecutionContext& ctx,
+                 const ProblemDescriptionBase& problem,
+                 const PrimitiveFindParameters& parameters,
+                 const std::vector<std::unique_ptr<ISolversFinder>>& finders,
+                 const std::optional<FindOptions>& options,
+                 std::size_t& total)
+{
+    auto solutions = SolutionsByAlgorithm{};
     std::transform(
         finders.begin(), finders.end(), std::inserter(solutions, solutions.end()), [&](auto&& f) {
             return std::make_pair(f->GetAlgorithmName(problem),
                                   f->Find(ctx, problem, invoke_ctx, parameters, options));
         });
 
-    std::size_t total = 0;
+    total = 0;
 
     for(auto it = solutions.begin(); it != solutions.end();)
     {
@@ -345,17 +347,54 @@ FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
         ++it;
     }
 
+    return solutions;
+}
+
+static void PrecompileAllSolutions(const Handle& handle,
+                                   const SolutionsByAlgorithm& solutions,
+                                   std::size_t total,
+                                   bool force_attach_binary)
+{
+    auto all = std::vector<const miopen::solver::ConvSolution*>{};
+    all.reserve(total);
+    for(const auto& ss : solutions)
+        std::transform(ss.second.begin(),
+                       ss.second.end(),
+                       std::back_inserter(all),
+                       [](auto&& s) { return &s; });
+    PrecompileSolutions(handle, all, force_attach_binary);
+}
+
+void PrecompileCore(const ExecutionContext& ctx,
+                    const ProblemDescriptionBase& problem,
+                    const PrimitiveFindParameters& parameters,
+                    const std::vector<std::unique_ptr<ISolversFinder>>& finders,
+                    bool force_attach_binary)
+{
+    std::size_t total = 0;
+    const auto solutions =
+        FindAllSolutions({}, ctx, problem, parameters, finders, std::nullopt, total);
+    PrecompileAllSolutions(ctx.GetStream(), solutions, total, force_attach_binary);
+}
+
+FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
+                        const ExecutionContext& ctx,
+                        const ProblemDescriptionBase& problem,
+                        const PrimitiveFindParameters& parameters,
+                        const std::vector<std::unique_ptr<ISolversFinder>>& finders,
+                        const std::optional<FindOptions>& options,
+                        bool force_attach_binary)
+{
+    auto& handle = ctx.GetStream();
+
+    // Find
+    std::size_t total = 0;
+    const auto solutions =
+        FindAllSolutions(invoke_ctx, ctx, problem, parameters, finders, options, total);
+    ctx.ThrowIfCancelled();
+
     // Precompile
-    {
-        auto all = std::vector<const miopen::solver::ConvSolution*>{};
-        all.reserve(total);
-        for(const auto& ss : solutions)
-            std::transform(ss.second.begin(),
-                           ss.second.end(),
-                           std::back_inserter(all),
-                           [](auto&& s) { return &s; });
-        PrecompileSolutions(handle, all, force_attach_binary);
-    }
+    PrecompileAllSolutions(handle, solutions, total, force_attach_binary);
 
     if(env::enabled((MIOPEN_DEBUG_COMPILE_ONLY)))
         MIOPEN_THROW(
@@ -372,6 +411,7 @@ FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
 
     for(const auto& ss : solutions)
     {
+        ctx.ThrowIfCancelled();
         auto evaluated = EvaluateInvokers(handle,
                                           ss.second,
                                           ss.first,
@@ -27,6 +27,7 @@
 #include <miopen/generic_search.hpp>
 #include <miopen/generic_search_controls.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <chrono>
 
@@ -63,5 +64,13 @@ std::chrono::milliseconds GetTuningTimeMax()
 
 std::size_t GetTuningThreadsMax() { return env::value(MIOPEN_COMPILE_PARALLEL_LEVEL); }
 
+std::size_t GetTuningCompileAheadMax()
+{
+    const auto value = env::value(MIOPEN_TUNING_COMPILE_AHEAD);
+    if(value > 0)
+        return value;
+    return std::max<std::size_t>(2 * GetTuningThreadsMax(), 1);
+}
+
 } // namespace solver
 } // namespace miopen
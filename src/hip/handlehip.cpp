@@ -32,8 +32,10 @@
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
+#include <miopen/kernel_build_service.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/ramdb.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/timer.hpp>
@@ -54,6 +56,7 @@
 #include <cassert>
 #include <chrono>
 #include <thread>
+#include <tuple>
 #include <mutex>
 #include <shared_mutex>
 
@@ -218,6 +221,14 @@ struct HandleImpl
 
     void set_ctx() const { miopen::set_device(this->device); }
 
+    // Code objects are loaded into the device context, so handles of one device can share them.
+    std::string get_programs_device() const
+    {
+        return std::to_string(device) + ":" + target_properties.DbId();
+    }
+
+    void share_programs() { cache.ShareProgramsWith(get_programs_device()); }
+
     std::string get_device_name() const
     {
         hipDeviceProp_t props{};
@@ -227,6 +238,10 @@ struct HandleImpl
         return name; // NOLINT (performance-no-automatic-move)
     }
 
+    // A stream created for a background handle. It is destroyed after everything else, as the
+    // library handles below may refer to it.
+    StreamPtr owned_stream = nullptr;
+
     std::shared_timed_mutex stream_pool_mutex;
     // the main stream and main rocblas_handle rhandle_
 
@@ -290,7 +305,10 @@ struct HandleImpl
     TargetProperties target_properties;
 };
 
-Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleImpl>())
+Handle::Handle(miopenAcceleratorQueue_t stream) : Handle(stream, true) {}
+
+Handle::Handle(miopenAcceleratorQueue_t stream, bool precompile_manifest)
+    : impl(std::make_unique<HandleImpl>())
 {
     meopenHandle_current_stream_id = 0;
     this->impl->device             = get_device_id();
@@ -313,7 +331,10 @@ Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleIm
     this->impl->hip_blasLt_handle = CreateHipblasLtHandle();
 #endif
     this->impl->target_properties.Init(this);
+    this->impl->share_programs();
     MIOPEN_LOG_NQI(*this);
+    if(precompile_manifest)
+        PrecompileFromManifest(*this, this->impl->get_programs_device());
 }
 
 Handle::Handle() : impl(std::make_unique<HandleImpl>())
@@ -340,10 +361,40 @@ Handle::Handle() : impl(std::make_unique<HandleImpl>())
     this->impl->hip_blasLt_handle = CreateHipblasLtHandle();
 #endif
     this->impl->target_properties.Init(this);
+    this->impl->share_programs();
     MIOPEN_LOG_NQI(*this);
+    PrecompileFromManifest(*this, this->impl->get_programs_device());
+}
+
+std::unique_ptr<Handle> Handle::CreateBackgroundHandle() const
+{
+    this->impl->set_ctx();
+
+    // The lowest priority, so that the kernels of the background handle yield to the ones of the
+    // application.
+    int least_priority    = 0;
+    int greatest_priority = 0;
+    auto status           = hipDeviceGetStreamPriorityRange(&least_priority, &greatest_priority);
+    if(status != hipSuccess)
+        MIOPEN_THROW_HIP_STATUS(status, "Failed to get the stream priority range");
+
+    hipStream_t stream;
+    status = hipStreamCreateWithPriority(&stream, hipStreamNonBlocking, least_priority);
+    if(status != hipSuccess)
+        MIOPEN_THROW_HIP_STATUS(status, "Failed to allocate stream");
+
+    auto owned_stream          = HandleImpl::StreamPtr{stream, &hipStreamDestroy};
+    auto handle                = std::unique_ptr<Handle>{new Handle(stream, false)};
+    handle->impl->owned_stream = std::move(owned_stream);
+    return handle;
 }
 
-Handle::~Handle() {}
+Handle::~Handle()
+{
+    if(precompiler)
+        precompiler->WaitAll();
+    RamDb::FlushAll();
+}
 
 // not MT safe
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
@@ -518,8 +569,8 @@ void Handle::ClearKernels(const std::string& algorithm, const std::string& netwo
     this->impl->cache.ClearKernels(algorithm, network_config);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config) const
+std::vector<Kernel> Handle::GetKernelsImpl(const std::string& algorithm,
+                                           const std::string& network_config) const
 {
     return this->impl->cache.GetKernels(algorithm, network_config);
 }
@@ -533,32 +584,50 @@ KernelInvoke Handle::Run(Kernel k, bool coop_launch) const
     return k.Invoke(this->GetStream(), callback, coop_launch);
 }
 
+std::string Handle::GetProgramBuildKey(const fs::path& program_name,
+                                       const std::string& params,
+                                       const std::string& kernel_src,
+                                       bool force_attach_binary) const
+{
+    // Programs are loaded into the device context, like in the shared ProgramCache
+    const auto target = std::to_string(this->impl->device) + ":" + GetTargetProperties().DbId();
+    return KernelBuildService::MakeKey(
+        target, program_name, params, kernel_src, force_attach_binary);
+}
+
 Program Handle::LoadProgram(const fs::path& program_name,
                             std::string params,
                             const std::string& kernel_src,
                             bool force_attach_binary) const
+{
+    return KernelBuildService::Get().Build(
+        GetProgramBuildKey(program_name, params, kernel_src, force_attach_binary), [&]() {
+            return BuildProgram(program_name, params, kernel_src, force_attach_binary);
+        });
+}
+
+KernelBuildFuture Handle::LoadProgramAsync(const fs::path& program_name,
+                                           std::string params,
+                                           const std::string& kernel_src,
+                                           bool force_attach_binary) const
+{
+    auto key = GetProgramBuildKey(program_name, params, kernel_src, force_attach_binary);
+    return KernelBuildService::Get().Submit(std::move(key), [=]() {
+        return BuildProgram(program_name, params, kernel_src, force_attach_binary);
+    });
+}
+
+Program Handle::BuildProgram(const fs::path& program_name,
+                             std::string params,
+                             const std::string& kernel_src,
+                             bool force_attach_binary) const
 {
     this->impl->set_ctx();
     std::string arch_name = this->GetTargetProperties().Name();
 
     std::string orig_params = params; // make a copy for target ID fallback
 
-#if WORKAROUND_ISSUE_3001
-    if(program_name.extension() != ".mlir")
-        params = params + " -mcpu=" + this->GetTargetProperties().Name();
-#else
-    if(program_name.extension() == ".mlir")
-    { // no -mcpu
-    }
-    else if(program_name.extension() == ".s")
-    {
-        params += " -mcpu=" + LcOptionTargetStrings{this->GetTargetProperties()}.targetId;
-    }
-    else
-    {
-        params += " -mcpu=" + this->GetTargetProperties().Name();
-    }
-#endif
+    params = AddTargetOptions(this->GetTargetProperties(), program_name, params);
 
     auto hsaco = miopen::LoadBinary(
         this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
@@ -666,6 +735,21 @@ void Handle::ClearProgram(const fs::path& program_name, const std::string& param
     this->impl->cache.ClearProgram(program_name, params);
 }
 
+BinaryPrefetch
+Handle::WarmPrograms(const std::vector<std::pair<fs::path, std::string>>& programs) const
+{
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    const auto& target = this->GetTargetProperties();
+    auto targeted      = programs;
+    for(auto& program : targeted)
+        program.second = AddTargetOptions(target, program.first, program.second);
+    return miopen::WarmBinaries(target, this->GetMaxComputeUnits(), targeted);
+#else
+    std::ignore = programs;
+    return {};
+#endif
+}
+
 void Handle::Finish() const
 {
     this->impl->set_ctx();
@@ -26,6 +26,7 @@
 
 #include <miopen/config.h>
 #include <miopen/hip_build_utils.hpp>
+#include <miopen/kernel_include_cache.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/exec_utils.hpp>
 #include <miopen/logger.hpp>
@@ -114,18 +115,9 @@ static fs::path HipBuildImpl(const TmpDir& tmp_dir,
                              const TargetProperties& target,
                              const bool testing_mode)
 {
-    // Write out the include files
+    // The include files are written out once per process and shared by all builds.
     // Let's assume includes are overkill for feature tests & optimize'em out.
-    if(!testing_mode)
-    {
-        auto inc_list = GetKernelIncList();
-        fs::create_directories(tmp_dir);
-        for(const auto& inc_file : inc_list)
-        {
-            auto inc_src = GetKernelInc(inc_file);
-            WriteFile(inc_src, tmp_dir / inc_file);
-        }
-    }
+    const auto include_dir = testing_mode ? std::string{} : GetKernelIncludeDir().string();
 
     src += "\nint main() {}\n";
     WriteFile(src, tmp_dir / filename);
@@ -154,6 +146,8 @@ static fs::path HipBuildImpl(const TmpDir& tmp_dir,
     params += " -c";
     params += " -O3 ";
     params += " -Wno-unused-command-line-argument -I. ";
+    if(!include_dir.empty())
+        params += "-I\"" + include_dir + "\" ";
     params += MIOPEN_STRINGIZE(HIP_COMPILER_FLAGS);
 
 #if MIOPEN_BUILD_DEV
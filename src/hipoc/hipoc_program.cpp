@@ -31,6 +31,7 @@
 #include <miopen/hipoc_program.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/kernel_warnings.hpp>
+#include <miopen/load_file.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/mlir_build.hpp>
 #include <miopen/stringutils.hpp>
@@ -328,6 +329,43 @@ void HIPOCProgramImpl::BuildCodeObject(std::string params, const std::string& ke
 #endif
 }
 
+std::string
+AddTargetOptions(const TargetProperties& target, const fs::path& program_name, std::string params)
+{
+#if WORKAROUND_ISSUE_3001
+    if(program_name.extension() != ".mlir")
+        params = params + " -mcpu=" + target.Name();
+#else
+    if(program_name.extension() == ".mlir")
+    { // no -mcpu
+    }
+    else if(program_name.extension() == ".s")
+    {
+        params += " -mcpu=" + LcOptionTargetStrings{target}.targetId;
+    }
+    else
+    {
+        params += " -mcpu=" + target.Name();
+    }
+#endif
+    return params;
+}
+
+std::vector<char> BuildCodeObject(const fs::path& program_name,
+                                  const std::string& params,
+                                  const TargetProperties& target,
+                                  const std::string& kernel_src)
+{
+    // Not using the HIPOCProgramImpl ctor since it loads the module
+    auto impl    = HIPOCProgramImpl{};
+    impl.program = program_name;
+    impl.target  = target;
+    impl.BuildCodeObject(params, kernel_src);
+    if(!impl.binary.empty())
+        return std::move(impl.binary);
+    return LoadFile(impl.hsaco_file);
+}
+
 HIPOCProgram::HIPOCProgram() {}
 HIPOCProgram::HIPOCProgram(const fs::path& program_name,
                            std::string params,
@@ -28,6 +28,7 @@
 #define MIOPEN_GUARD_MLOPEN_ANY_SOLVER_HPP
 
 #include <miopen/problem_description_base.hpp>
+#include <miopen/conv/applicability_index.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/find_solution.hpp>
 #include <miopen/mlo_internal.hpp>
@@ -129,6 +130,12 @@ struct AnySolver
         return ptr_value->MayNeedWorkspace();
     }
 
+    miopen::conv::ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        assert(ptr_value != nullptr);
+        return ptr_value->GetApplicabilityConstraints();
+    }
+
     // virtual base class
     struct AnySolver_base
     {
@@ -163,6 +170,7 @@ struct AnySolver
         virtual size_t GetWorkspaceSize(const ExecutionContext& ctx,
                                         const miopen::conv::ProblemDescription& problem) const = 0;
         virtual bool MayNeedWorkspace() const                                                  = 0;
+        virtual miopen::conv::ApplicabilityConstraints GetApplicabilityConstraints() const = 0;
     };
 
     // templated derived class
@@ -200,6 +208,20 @@ struct AnySolver
             static constexpr bool Is = type::value;
         };
 
+        struct ConstrainedSolver
+        {
+            template <typename U>
+            static constexpr auto Test(U*) -> typename std::is_same<
+                miopen::conv::ApplicabilityConstraints,
+                decltype(std::declval<U>().GetApplicabilityConstraints())>::type;
+
+            template <typename U>
+            static constexpr std::false_type Test(...);
+
+            using type               = decltype(Test<T>(nullptr));
+            static constexpr bool Is = type::value;
+        };
+
         bool TestPerfCfgParams(const ExecutionContext& ctx,
                                const miopen::conv::ProblemDescription& problem,
                                const std::string& params,
@@ -372,6 +394,13 @@ struct AnySolver
             return value.GetWorkspaceSize(ctx, problem);
         }
         bool MayNeedWorkspace() const override { return value.MayNeedWorkspace(); }
+        miopen::conv::ApplicabilityConstraints GetApplicabilityConstraints() const override
+        {
+            if constexpr(ConstrainedSolver::Is)
+                return value.GetApplicabilityConstraints();
+            else
+                return {};
+        }
         const std::type_info& Type() const override { return typeid(T); };
         std::string GetSolverDbId() const override { return value.SolverDbId(); }
 
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_BACKGROUND_FIND_HPP_
+#define GUARD_MIOPEN_BACKGROUND_FIND_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/names.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// Runs full searches of the problems which are served by heuristics in the meantime, see
+/// MIOPEN_FIND_IN_BACKGROUND. The searches run one at a time on a worker thread and use their own
+/// handle, so that they neither block the application nor measure its kernels. The application
+/// keeps using the owner meanwhile, so the searches don't touch it: they publish their results,
+/// which the application applies to the owner on its own thread.
+class MIOPEN_INTERNALS_EXPORT BackgroundFinder
+{
+public:
+    struct Stats
+    {
+        std::size_t queued    = 0;
+        std::size_t completed = 0;
+        std::size_t failed    = 0;
+        /// Searches dropped or cancelled because the handle was destroyed
+        std::size_t cancelled = 0;
+    };
+
+    BackgroundFinder();
+    explicit BackgroundFinder(Handle& owner_);
+    BackgroundFinder(const BackgroundFinder&) = delete;
+    BackgroundFinder& operator=(const BackgroundFinder&) = delete;
+    ~BackgroundFinder();
+
+    /// Queues the search of the problem and returns true, unless it has been queued before.
+    /// Searches run in the order they are queued. Exceptions thrown by the task are logged and
+    /// counted as failures.
+    bool Submit(const NetworkConfig& problem, std::function<void()> task);
+
+    /// The handle the searches are for. Published results get it from here rather than capture
+    /// it, as it changes when the handle is moved.
+    Handle& GetOwner() const;
+    /// Called when the handle is moved, after WaitAll().
+    void SetOwner(Handle& owner_) { owner = &owner_; }
+
+    /// The handle to run the searches on, created by the first Submit() for the device of the
+    /// owner. Only meant for the tasks.
+    Handle& GetSearchHandle();
+
+    /// Set by Stop(). Searches check it between candidates, see ExecutionContext::cancelled, so
+    /// that the handle doesn't wait for a full search when it is destroyed.
+    const std::atomic<bool>& Stopping() const { return stopping; }
+
+    /// Queues work on the owner, such as switching its invokers to the found solutions, for the
+    /// next ApplyPublished().
+    void Publish(std::function<void()> apply);
+    /// Runs the published work. Called by the users of the owner, on the thread of the
+    /// application.
+    void ApplyPublished();
+
+    void WaitAll();
+
+    /// Drops the searches which have not started yet and the published results. The search in
+    /// progress is cancelled at its next check of Stopping(), which this waits for.
+    void Stop();
+
+    Stats GetStats() const;
+
+private:
+    struct ConfigHash
+    {
+        std::size_t operator()(const NetworkConfig& config) const { return config.Hash(); }
+    };
+
+    void Run();
+
+    Handle* owner = nullptr;
+    mutable std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<std::pair<NetworkConfig, std::function<void()>>> queue;
+    std::unordered_set<NetworkConfig, ConfigHash> submitted;
+    bool busy    = false;
+    bool stopped = false;
+    std::atomic<bool> stopping{false};
+    std::vector<std::function<void()>> published;
+    std::atomic<bool> has_published{false};
+    Stats stats;
+    std::thread worker;
+    std::unique_ptr<Handle> search_handle;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BACKGROUND_FIND_HPP_
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_BENCHMARK_HPP_
+#define GUARD_MIOPEN_BENCHMARK_HPP_
+
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace miopen {
+
+enum class TimingEstimator
+{
+    Median,
+    TrimmedMean,
+    Mean,
+    Min,
+};
+
+struct BenchmarkOptions
+{
+    /// Runs of each candidate that are not timed
+    std::size_t warmup = 1;
+    /// Samples taken from each candidate before any of them may be eliminated
+    std::size_t min_samples = 3;
+    std::size_t max_samples = 20;
+    /// A candidate is not sampled anymore once it has taken this long, warmup included
+    float time_limit_ms = 5000.0f;
+    /// Sampling stops once the 95% confidence interval is within this fraction of the estimate
+    float target_ci = 0.02f;
+    TimingEstimator estimator = TimingEstimator::Median;
+    /// Fraction of the samples dropped from each end by the trimmed mean
+    float trim = 0.2f;
+    /// Drop the slower half of the candidates after each round
+    bool successive_halving = true;
+
+    /// Defaults overridden by the MIOPEN_FIND_BENCHMARK_* variables.
+    MIOPEN_INTERNALS_EXPORT static BenchmarkOptions FromEnv();
+};
+
+MIOPEN_INTERNALS_EXPORT TimingEstimator ParseTimingEstimator(std::string_view name);
+
+struct TimingStats
+{
+    /// The time reported for the candidate, as chosen by the estimator
+    float estimate = 0.0f;
+    float mean     = 0.0f;
+    float median   = 0.0f;
+    float min      = 0.0f;
+    float stddev   = 0.0f;
+    /// 95% confidence interval of the estimate
+    float ci_low        = 0.0f;
+    float ci_high       = 0.0f;
+    std::size_t samples = 0;
+    /// The sampler has thrown
+    bool failed = false;
+    /// Stopped early, because the candidate was slower than the best one
+    bool eliminated = false;
+
+    MIOPEN_INTERNALS_EXPORT bool Converged(const BenchmarkOptions& options) const;
+};
+
+MIOPEN_INTERNALS_EXPORT TimingStats ComputeTimingStats(std::vector<float> samples,
+                                                       const BenchmarkOptions& options);
+
+/// Times a set of candidates against each other. Each candidate is warmed up and sampled
+/// min_samples times. Candidates whose confidence interval lies above the one of the best
+/// candidate are eliminated, and with successive halving so is the slower half of the ones
+/// whose estimate is outside of the interval of the best. The others get twice as many samples
+/// in the next round, until their interval is narrow enough, they reach max_samples or use up
+/// their time.
+///
+/// The sampler runs the candidate once and returns its time in milliseconds, which makes the
+/// engine testable with a mocked timer. Candidates whose sampler throws are marked as failed.
+class MIOPEN_INTERNALS_EXPORT Benchmark
+{
+public:
+    using Sampler = std::function<float()>;
+
+    explicit Benchmark(BenchmarkOptions options_) : options(options_) {}
+
+    std::size_t Add(Sampler sampler);
+
+    /// Returns the statistics of the candidates in the order they were added.
+    std::vector<TimingStats> Run();
+
+    /// Index of the fastest candidate that neither failed nor was eliminated, or -1.
+    static int GetBest(const std::vector<TimingStats>& stats);
+
+private:
+    struct Candidate
+    {
+        Sampler sampler;
+        std::vector<float> samples;
+        float spent_ms = 0.0f;
+        TimingStats stats;
+    };
+
+    bool Sample(Candidate& candidate, bool timed);
+
+    BenchmarkOptions options;
+    std::vector<Candidate> candidates;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BENCHMARK_HPP_
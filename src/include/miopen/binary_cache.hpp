@@ -30,7 +30,10 @@
 #include <miopen/config.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/filesystem.hpp>
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace miopen {
 
@@ -41,6 +44,27 @@ GetCacheFile(const std::string& device, const fs::path& name, const std::string&
 
 MIOPEN_INTERNALS_EXPORT fs::path GetCachePath(bool is_system);
 
+/// Binaries prefetched by one WarmBinaries() call. The ones LoadBinary() hasn't taken by the time
+/// this is destroyed are dropped, so prefetched binaries don't outlive the warm-up.
+class MIOPEN_INTERNALS_EXPORT BinaryPrefetch
+{
+public:
+    BinaryPrefetch() = default;
+    explicit BinaryPrefetch(std::uint64_t id_) : id(id_) {}
+    BinaryPrefetch(BinaryPrefetch&& other) noexcept : id(std::exchange(other.id, 0)) {}
+    BinaryPrefetch& operator=(BinaryPrefetch&& other) noexcept
+    {
+        std::swap(id, other.id);
+        return *this;
+    }
+    BinaryPrefetch(const BinaryPrefetch&) = delete;
+    BinaryPrefetch& operator=(const BinaryPrefetch&) = delete;
+    ~BinaryPrefetch();
+
+private:
+    std::uint64_t id = 0;
+};
+
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
 fs::path LoadBinary(const TargetProperties& target,
                     std::size_t num_cu,
@@ -62,6 +86,14 @@ void SaveBinary(const std::vector<char>& hsaco,
                 std::size_t num_cu,
                 const fs::path& name,
                 const std::string& args);
+
+/// Loads the cached binaries of (name, args) programs in bulk and unpacks them in parallel.
+/// The following LoadBinary() call for each of them is served from memory while the returned
+/// object is alive. Prefetching stops once the binaries held in memory reach a size limit.
+MIOPEN_INTERNALS_EXPORT BinaryPrefetch
+WarmBinaries(const TargetProperties& target,
+             std::size_t num_cu,
+             const std::vector<std::pair<fs::path, std::string>>& programs);
 #endif
 
 } // namespace miopen
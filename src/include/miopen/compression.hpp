@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_COMPRESSION_HPP_
+#define GUARD_MIOPEN_COMPRESSION_HPP_
+
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+/// Codecs of the kernel database blobs. The values are stored in the databases, so they must
+/// never change. Records written before the codec was recorded are bzip2.
+enum class CompressionCodec : int
+{
+    Bzip2 = 0,
+    Zstd  = 1,
+};
+
+MIOPEN_INTERNALS_EXPORT bool IsAvailable(CompressionCodec codec);
+MIOPEN_INTERNALS_EXPORT std::string ToString(CompressionCodec codec);
+
+/// The codec new records are written with. MIOPEN_KERN_DB_CODEC=bzip2|zstd overrides the
+/// default, which is the fastest codec available.
+MIOPEN_INTERNALS_EXPORT CompressionCodec GetDefaultCodec();
+
+/// Same contract as compress(): if compressed is not null and the data does not shrink, it is
+/// set to false and the data is returned as is.
+MIOPEN_INTERNALS_EXPORT std::vector<char>
+Compress(CompressionCodec codec, const std::vector<char>& v, bool* compressed = nullptr);
+
+/// Throws if the data is corrupted or does not decompress into exactly size bytes.
+MIOPEN_INTERNALS_EXPORT std::vector<char>
+Decompress(CompressionCodec codec, const std::vector<char>& v, std::size_t size);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_COMPRESSION_HPP_
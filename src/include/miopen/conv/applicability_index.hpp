@@ -0,0 +1,265 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/problem_key.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace conv {
+
+struct ProblemDescription;
+
+/// Coarse properties of a problem and of the context it is solved in. Values of a group are
+/// mutually exclusive. A problem may have no value of a group, e.g. when its tensors do not
+/// share a data type or a layout.
+enum class ProblemFeature : std::uint8_t
+{
+    // Direction
+    Forward,
+    BackwardData,
+    BackwardWeights,
+    // Spatial dimensions
+    Spatial2d,
+    Spatial3d,
+    // Data type of all tensors. Fp8 stands for any tensor of fp8 or bf8 type.
+    Fp32,
+    Fp16,
+    Bfp16,
+    Int8,
+    Fp8,
+    // Tensor casts
+    NotCasted,
+    Casted,
+    // Layout of all tensors
+    LayoutDefault,
+    LayoutNHWC,
+    LayoutNCHWc,
+    // Tensor strides
+    Packed,
+    NonPacked,
+    // Group count
+    SingleGroup,
+    Grouped,
+    // Kernel sources enabled in the context
+    AsmKernels,
+    NoAsmKernels,
+    HipKernels,
+    NoHipKernels,
+    OpenCLKernels,
+    NoOpenCLKernels,
+};
+
+using ProblemFeatures = std::uint32_t;
+
+constexpr ProblemFeatures ToMask(ProblemFeature feature)
+{
+    return ProblemFeatures{1} << static_cast<unsigned>(feature);
+}
+
+namespace detail {
+
+constexpr ProblemFeatures FeatureRange(ProblemFeature first, ProblemFeature last)
+{
+    return (ToMask(last) << 1) - ToMask(first);
+}
+
+constexpr std::array<ProblemFeatures, 10> feature_groups = {
+    FeatureRange(ProblemFeature::Forward, ProblemFeature::BackwardWeights),
+    FeatureRange(ProblemFeature::Spatial2d, ProblemFeature::Spatial3d),
+    FeatureRange(ProblemFeature::Fp32, ProblemFeature::Fp8),
+    FeatureRange(ProblemFeature::NotCasted, ProblemFeature::Casted),
+    FeatureRange(ProblemFeature::LayoutDefault, ProblemFeature::LayoutNCHWc),
+    FeatureRange(ProblemFeature::Packed, ProblemFeature::NonPacked),
+    FeatureRange(ProblemFeature::SingleGroup, ProblemFeature::Grouped),
+    FeatureRange(ProblemFeature::AsmKernels, ProblemFeature::NoAsmKernels),
+    FeatureRange(ProblemFeature::HipKernels, ProblemFeature::NoHipKernels),
+    FeatureRange(ProblemFeature::OpenCLKernels, ProblemFeature::NoOpenCLKernels),
+};
+
+} // namespace detail
+
+MIOPEN_INTERNALS_EXPORT ProblemFeatures GetProblemFeatures(const ExecutionContext& ctx,
+                                                           const ProblemDescription& problem);
+
+/// Problem features a solver can be applicable to. A solver lists the values it accepts, which
+/// rules out the other values of the same groups. Groups with no value listed are not
+/// constrained.
+///
+/// Constraints must follow from unconditional checks of IsApplicable(), so that they only
+/// prune solvers which would not be applicable anyway.
+class ApplicabilityConstraints
+{
+public:
+    constexpr ApplicabilityConstraints() = default;
+    constexpr ApplicabilityConstraints(std::initializer_list<ProblemFeature> accepted)
+    {
+        auto listed = ProblemFeatures{0};
+        for(const auto feature : accepted)
+            listed |= ToMask(feature);
+        allowed = 0;
+        for(const auto group : detail::feature_groups)
+            allowed |= (listed & group) != 0 ? (listed & group) : group;
+    }
+
+    constexpr bool Admits(ProblemFeatures features) const { return (features & ~allowed) == 0; }
+    constexpr ProblemFeatures GetAllowed() const { return allowed; }
+
+private:
+    ProblemFeatures allowed = ~ProblemFeatures{0};
+};
+
+/// Memoized applicability of the convolution solvers.
+///
+/// Solvers are enumerated for every problem without a find-db record, and each of them derives
+/// the same layout, data type and architecture checks again. The index computes the features
+/// of a problem once, answers for the solvers whose constraints rule them out without calling
+/// IsApplicable(), and keeps the results of the other checks. Results are keyed by everything
+/// IsApplicable() may look at: the problem including strides and attributes, the device, the
+/// context flags and the environment.
+class MIOPEN_INTERNALS_EXPORT ApplicabilityIndex
+{
+public:
+    struct Stats
+    {
+        /// Problems looked up, and those found in the index
+        std::size_t lookups = 0;
+        std::size_t hits    = 0;
+        /// Checks answered by the constraints, by earlier results and by IsApplicable()
+        std::size_t pruned    = 0;
+        std::size_t memoized  = 0;
+        std::size_t evaluated = 0;
+    };
+
+    /// Results of one problem, one per solver id: 0 when not known yet, 1 when the solver is
+    /// applicable and 2 when it is not.
+    struct Entry
+    {
+        ProblemFeatures features = 0;
+        std::unique_ptr<std::atomic<std::uint8_t>[]> states;
+    };
+
+    static ApplicabilityIndex& Get();
+
+    explicit ApplicabilityIndex(std::size_t max_problems_);
+
+    static ProblemKey MakeKey(const ExecutionContext& ctx, const ProblemDescription& problem);
+
+    std::shared_ptr<Entry> Find(const ExecutionContext& ctx, const ProblemDescription& problem);
+
+    /// Known result of a check, if any. The constraints of the solver are applied here.
+    std::optional<bool> Lookup(Entry& entry, const solver::Id& id);
+    void Store(Entry& entry, const solver::Id& id, bool applicable);
+
+    const ApplicabilityConstraints& GetConstraints(const solver::Id& id) const;
+
+    Stats GetStats() const;
+    void Clear();
+
+private:
+    struct KeyHash
+    {
+        std::size_t operator()(const ProblemKey& key) const { return key.Hash(); }
+    };
+
+    const std::size_t max_problems;
+    /// Indexed by solver id
+    std::vector<ApplicabilityConstraints> constraints;
+
+    /// Keys of the entries, the most recently used first. Map nodes don't move, so the keys
+    /// are not copied.
+    using Recent = std::list<const ProblemKey*>;
+    struct Slot
+    {
+        std::shared_ptr<Entry> entry;
+        Recent::iterator age;
+    };
+
+    mutable std::mutex mutex;
+    std::unordered_map<ProblemKey, Slot, KeyHash> entries;
+    Recent recent;
+
+    std::atomic<std::size_t> lookups{0};
+    std::atomic<std::size_t> hits{0};
+    std::atomic<std::size_t> pruned{0};
+    std::atomic<std::size_t> memoized{0};
+    std::atomic<std::size_t> evaluated{0};
+};
+
+/// Checks solvers against one problem through the index, which is bypassed when
+/// MIOPEN_DEBUG_CONV_APPLICABILITY_INDEX is disabled. Keeps references to the context and the
+/// problem.
+class MIOPEN_INTERNALS_EXPORT ApplicabilityQuery
+{
+public:
+    ApplicabilityQuery(const ExecutionContext& ctx_, const ProblemDescription& problem_);
+
+    /// Checks a registered solver.
+    bool IsApplicable(const solver::Id& id) const;
+
+    template <class Solver>
+    bool IsApplicable(const Solver& solver) const
+    {
+        return IsApplicable(solver::Id{solver.SolverDbId()}, solver);
+    }
+
+    template <class Solver>
+    bool IsApplicable(const solver::Id& id, const Solver& solver) const
+    {
+        if(entry == nullptr)
+            return solver.IsApplicable(ctx, problem);
+        if(const auto known = ApplicabilityIndex::Get().Lookup(*entry, id))
+            return *known;
+        const auto applicable = solver.IsApplicable(ctx, problem);
+        ApplicabilityIndex::Get().Store(*entry, id, applicable);
+        return applicable;
+    }
+
+private:
+    const ExecutionContext& ctx;
+    const ProblemDescription& problem;
+    std::shared_ptr<ApplicabilityIndex::Entry> entry;
+};
+
+} // namespace conv
+} // namespace miopen
@@ -74,6 +74,11 @@ class Model;
 MIOPEN_INTERNALS_EXPORT std::vector<uint64_t> PredictSolver(const conv::ProblemDescription& problem,
                                                             const ExecutionContext& ctx,
                                                             const std::string& device);
+/// Same as PredictSolver for each of the problems, with the uncached ones evaluated in one batch.
+MIOPEN_INTERNALS_EXPORT std::vector<std::vector<uint64_t>>
+PredictSolvers(const std::vector<conv::ProblemDescription>& problems,
+               const ExecutionContext& ctx,
+               const std::string& device);
 } // namespace immed_mode
 
 #endif // MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
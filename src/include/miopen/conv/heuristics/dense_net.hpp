@@ -0,0 +1,118 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DENSE_NET_HPP_
+#define GUARD_MIOPEN_DENSE_NET_HPP_
+
+#include <miopen/config.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace miopen {
+namespace ai {
+
+/// Inference of the multilayer perceptrons the heuristics are made of, e.g. TunaNet, without
+/// frugally-deep.
+///
+/// The model is read from the frugally-deep JSON. Only graphs of InputLayer, Dense (linear or
+/// relu activation), ReLU and Add layers with a single input and output are supported. A ReLU
+/// is fused into the layer it follows. The parameters of each Dense layer are kept in one
+/// aligned array, with the rows of the weights padded to a multiple of the SIMD width.
+///
+/// Batches are evaluated a block of rows at a time, so that each row of the weights is reused
+/// for the whole block while it's in cache.
+class MIOPEN_INTERNALS_EXPORT DenseNet
+{
+public:
+    /// Scratch memory of the inference. Reusing it makes the calls allocation free.
+    class Workspace
+    {
+        friend class DenseNet;
+        std::vector<float> buffer;
+    };
+
+    /// Throws if the model is not supported. Unless verify is false, also throws if the model
+    /// doesn't reproduce the test outputs stored in the file.
+    explicit DenseNet(const nlohmann::json& model, bool verify = true);
+    DenseNet(const DenseNet&) = delete;
+    DenseNet& operator=(const DenseNet&) = delete;
+    DenseNet(DenseNet&&)                 = default;
+    DenseNet& operator=(DenseNet&&) = default;
+
+    std::size_t GetNumInputs() const { return num_inputs; }
+    std::size_t GetNumOutputs() const { return num_outputs; }
+
+    /// Evaluates batch_size rows of GetNumInputs() inputs into as many rows of GetNumOutputs()
+    /// outputs.
+    void Forward(const float* inputs,
+                 std::size_t batch_size,
+                 float* outputs,
+                 Workspace& workspace) const;
+
+    std::vector<float> Forward(const std::vector<float>& inputs) const;
+
+private:
+    enum class Op
+    {
+        Dense,
+        Add,
+        Relu,
+    };
+
+    struct Layer
+    {
+        Op op;
+        bool relu = false;
+        std::size_t units;
+        /// Offsets of the outputs and inputs in the activations of a row
+        std::size_t output;
+        std::size_t input;
+        std::size_t other_input = 0;
+        std::size_t input_units;
+        /// Offsets of the parameters of Dense layers
+        std::size_t weights = 0;
+        std::size_t bias    = 0;
+    };
+
+    std::size_t num_inputs  = 0;
+    std::size_t num_outputs = 0;
+    std::vector<Layer> layers;
+    /// Padded floats of the activations of a row, the inputs first
+    std::size_t activations = 0;
+    std::size_t output      = 0;
+    std::vector<float> storage;
+    std::size_t params_offset = 0;
+
+    const float* Params() const { return storage.data() + params_offset; }
+    void Verify(const nlohmann::json& tests) const;
+};
+
+} // namespace ai
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DENSE_NET_HPP_
@@ -29,6 +29,7 @@
 #include <boost/any.hpp>
 #include <miopen/conv_algo_name.hpp>
 #include <miopen/names.hpp>
+#include <miopen/problem_key.hpp>
 #include <miopen/scalar.hpp>
 
 #include <miopen/problem_description_base.hpp>
@@ -340,18 +341,23 @@ struct MIOPEN_INTERNALS_EXPORT ProblemDescription : ProblemDescriptionBase
 
     void HeuristicUpdateLayouts();
 
+    /// The string form, used where configs of several problems are concatenated.
     void MakeNetworkConfig(std::string& conf_key) const;
 
-    NetworkConfig MakeNetworkConfig() const override
+    /// Identifies the problem for the in-process caches, built without string formatting.
+    ProblemKey MakeProblemKey() const;
+
+    NetworkConfig MakeNetworkConfig() const override { return NetworkConfig{MakeProblemKey()}; }
+
+    // Todo: remove after fixing fin
+    /// Keeps the string form fin expects, which doesn't match the keys of MakeNetworkConfig().
+    [[deprecated]] NetworkConfig BuildConfKey() const
     {
         std::string ret;
         MakeNetworkConfig(ret);
         return NetworkConfig{ret};
     }
 
-    // Todo: remove after fixing fin
-    [[deprecated]] NetworkConfig BuildConfKey() const { return MakeNetworkConfig(); }
-
     void Serialize(std::ostream& stream) const;
 
     friend std::ostream& operator<<(std::ostream& os, const ProblemDescription& obj)
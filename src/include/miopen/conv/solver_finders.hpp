@@ -172,6 +172,14 @@ FindCoreResult FindCore(const AnyInvokeParams& invoke_ctx,
                         const std::optional<FindOptions>& options = std::nullopt,
                         bool force_attach_binary                  = false);
 
+/// Compiles the kernels of the solutions FindCore() would evaluate, without running them. The
+/// context is expected to have the search disabled, so that nothing is tuned on the device.
+void PrecompileCore(const ExecutionContext& ctx,
+                    const ProblemDescriptionBase& problem,
+                    const PrimitiveFindParameters& parameters,
+                    const std::vector<std::unique_ptr<ISolversFinder>>& finders,
+                    bool force_attach_binary = false);
+
 namespace conv {
 bool IsAlgorithmDisabled(miopenConvAlgorithm_t algo);
 bool IsEnoughWorkspace(std::string_view where,
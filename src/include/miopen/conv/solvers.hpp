@@ -28,6 +28,7 @@
 
 #include <miopen/config.hpp>
 
+#include <miopen/conv/applicability_index.hpp>
 #include <miopen/conv/problem_description.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/execution_context.hpp>
@@ -87,6 +88,12 @@ template <class PerformanceConfig>
 using ConvTunableSolver =
     SolverBaseTunable<ExecutionContext, miopen::conv::ProblemDescription, PerformanceConfig>;
 
+/// Solvers may declare the problem features they can be applicable to with
+///     ApplicabilityConstraints GetApplicabilityConstraints() const;
+/// which lets the applicability index skip them without calling IsApplicable().
+using ApplicabilityConstraints = miopen::conv::ApplicabilityConstraints;
+using ProblemFeature           = miopen::conv::ProblemFeature;
+
 struct PerformanceConfigConvAsm3x3U : PerfConfigBase<PerformanceConfigConvAsm3x3U>
 {
     int limit_wave_cnt;        // [0..9]
@@ -120,6 +127,14 @@ struct ConvAsm3x3U final : ConvTunableSolver<PerformanceConfigConvAsm3x3U>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm3x3U>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::BackwardData, ProblemFeature::Spatial2d,
+                ProblemFeature::Fp32, ProblemFeature::Fp16, ProblemFeature::Bfp16,
+                ProblemFeature::Int8, ProblemFeature::NotCasted, ProblemFeature::LayoutDefault,
+                ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsm3x3U GetDefaultPerformanceConfig(
@@ -228,6 +243,13 @@ struct ConvAsm1x1U final : ConvTunableSolver<PerformanceConfigConvAsm1x1U>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm1x1U>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::BackwardData, ProblemFeature::Spatial2d,
+                ProblemFeature::Fp32, ProblemFeature::Fp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsm1x1U GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -319,6 +341,13 @@ struct ConvAsm1x1UV2 final : ConvTunableSolver<PerformanceConfigConvAsm1x1UV2>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm1x1UV2>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::BackwardData, ProblemFeature::Spatial2d,
+                ProblemFeature::Fp32, ProblemFeature::NotCasted, ProblemFeature::LayoutDefault,
+                ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsm1x1UV2 GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -341,6 +370,12 @@ struct ConvAsm5x10u2v2f1 final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm5x10u2v2f1>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT ConvSolution
@@ -351,6 +386,14 @@ struct ConvAsm5x10u2v2b1 final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm5x10u2v2b1>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::Int8,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT ConvSolution
@@ -364,6 +407,12 @@ struct ConvAsm7x7c3h224w224k64u2v2p3q3f1 final : ConvSolver
         return GetSolverDbId<ConvAsm7x7c3h224w224k64u2v2p3q3f1>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT ConvSolution
@@ -377,6 +426,13 @@ struct ConvOclDirectFwd11x11 final : ConvSolver
         return GetSolverDbId<ConvOclDirectFwd11x11>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Spatial2d, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::NotCasted, ProblemFeature::LayoutDefault,
+                ProblemFeature::Packed, ProblemFeature::OpenCLKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT ConvSolution
@@ -387,6 +443,13 @@ struct ConvOclDirectFwdGen final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvOclDirectFwdGen>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Spatial2d, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::NotCasted, ProblemFeature::LayoutDefault,
+                ProblemFeature::Packed, ProblemFeature::SingleGroup, ProblemFeature::OpenCLKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT ConvSolution
@@ -815,6 +878,13 @@ struct ConvHipImplicitGemmV4R1Fwd final : ConvTunableSolver<PerformanceImplicitG
         return GetSolverDbId<ConvHipImplicitGemmV4R1Fwd>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmV4R1 GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -840,6 +910,13 @@ struct ConvHipImplicitGemmV4R4Fwd final : ConvTunableSolver<PerformanceImplicitG
         return GetSolverDbId<ConvHipImplicitGemmV4R4Fwd>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Fp32, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::SingleGroup,
+                ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmV4R4Fwd GetDefaultPerformanceConfig(
@@ -917,6 +994,13 @@ struct ConvMlirIgemmFwd final : ConvTunableSolver<PerformanceConvMlirIgemm>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvMlirIgemmFwd>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::Int8, ProblemFeature::NotCasted,
+                ProblemFeature::Packed};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceConvMlirIgemm GetDefaultPerformanceConfig(
@@ -998,6 +1082,13 @@ struct ConvMlirIgemmFwdXdlops final : ConvTunableSolver<PerformanceConvMlirIgemm
         return GetSolverDbId<ConvMlirIgemmFwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::Int8, ProblemFeature::NotCasted,
+                ProblemFeature::Packed};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceConvMlirIgemmXdlops GetDefaultPerformanceConfig(
@@ -1023,6 +1114,13 @@ struct ConvHipImplicitGemmV4R4WrW final : ConvTunableSolver<PerformanceImplicitG
         return GetSolverDbId<ConvHipImplicitGemmV4R4WrW>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Fp32, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::SingleGroup,
+                ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmV4R4WrW GetDefaultPerformanceConfig(
@@ -1050,6 +1148,13 @@ struct ConvMlirIgemmWrW final : ConvTunableSolver<PerformanceConvMlirIgemm>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvMlirIgemmWrW>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::Int8, ProblemFeature::NotCasted,
+                ProblemFeature::Packed};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceConvMlirIgemm GetDefaultPerformanceConfig(
@@ -1075,6 +1180,13 @@ struct ConvMlirIgemmWrWXdlops final : ConvTunableSolver<PerformanceConvMlirIgemm
         return GetSolverDbId<ConvMlirIgemmWrWXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::Int8, ProblemFeature::NotCasted,
+                ProblemFeature::Packed};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceConvMlirIgemmXdlops GetDefaultPerformanceConfig(
@@ -1342,6 +1454,13 @@ struct ConvHipImplicitGemmForwardV4R4Xdlops final
         return GetSolverDbId<ConvHipImplicitGemmForwardV4R4Xdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmForwardV4R4Xdlops GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -1374,6 +1493,13 @@ struct ConvHipImplicitGemmForwardV4R4Xdlops_Padded_Gemm final
         return GetSolverDbId<ConvHipImplicitGemmForwardV4R4Xdlops_Padded_Gemm>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmForwardV4R4Xdlops_Padded_Gemm
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -1407,6 +1533,13 @@ struct ConvHipImplicitGemmForwardV4R5Xdlops final
         return GetSolverDbId<ConvHipImplicitGemmForwardV4R5Xdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmForwardV4R5Xdlops GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -1432,6 +1565,13 @@ struct ConvHipImplicitGemmV4R1WrW final : ConvTunableSolver<PerformanceImplicitG
         return GetSolverDbId<ConvHipImplicitGemmV4R1WrW>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmV4R1 GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -1457,6 +1597,13 @@ struct ConvHipImplicitGemmBwdDataV1R1 final : ConvTunableSolver<PerformanceImpli
         return GetSolverDbId<ConvHipImplicitGemmBwdDataV1R1>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Fp32, ProblemFeature::Bfp16,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::SingleGroup, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmBwdDataV1R1 GetDefaultPerformanceConfig(
@@ -1488,6 +1635,13 @@ struct ConvMlirIgemmBwd final : ConvTunableSolver<PerformanceConvMlirIgemm>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvMlirIgemmBwd>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::Int8, ProblemFeature::NotCasted,
+                ProblemFeature::Packed};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceConvMlirIgemm GetDefaultPerformanceConfig(
@@ -1513,6 +1667,13 @@ struct ConvMlirIgemmBwdXdlops final : ConvTunableSolver<PerformanceConvMlirIgemm
         return GetSolverDbId<ConvMlirIgemmBwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::Int8, ProblemFeature::NotCasted,
+                ProblemFeature::Packed};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceConvMlirIgemmXdlops GetDefaultPerformanceConfig(
@@ -1538,6 +1699,13 @@ struct ConvHipImplicitGemmBwdDataV4R1 final : ConvTunableSolver<PerformanceImpli
         return GetSolverDbId<ConvHipImplicitGemmBwdDataV4R1>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Fp32, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::SingleGroup,
+                ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmBwdDataV4R1 GetDefaultPerformanceConfig(
@@ -1571,6 +1739,13 @@ struct ConvHipImplicitGemmBwdDataV4R1Xdlops final
         return GetSolverDbId<ConvHipImplicitGemmBwdDataV4R1Xdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmBwdDataV4R1Xdlops GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -1604,6 +1779,13 @@ struct ConvHipImplicitGemmBwdDataV1R1Xdlops final
         return GetSolverDbId<ConvHipImplicitGemmBwdDataV1R1Xdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmBwdV1R1Xdlops GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -1638,6 +1820,13 @@ struct ConvAsmImplicitGemmV4R1DynamicFwd final : ConvSolver
         return GetSolverDbId<ConvAsmImplicitGemmV4R1DynamicFwd>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::SingleGroup, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -1654,6 +1843,13 @@ struct ConvAsmImplicitGemmV4R1DynamicFwd_1x1 final : ConvSolver
         return GetSolverDbId<ConvAsmImplicitGemmV4R1DynamicFwd_1x1>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::LayoutDefault, ProblemFeature::SingleGroup,
+                ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -1670,6 +1866,13 @@ struct ConvAsmImplicitGemmV4R1DynamicWrw final : ConvSolver
         return GetSolverDbId<ConvAsmImplicitGemmV4R1DynamicWrw>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::SingleGroup, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -1691,6 +1894,13 @@ struct ConvAsmImplicitGemmGTCDynamicWrwXdlops final : ConvSolver
         return GetSolverDbId<ConvAsmImplicitGemmGTCDynamicWrwXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::NotCasted, ProblemFeature::LayoutDefault,
+                ProblemFeature::Packed, ProblemFeature::SingleGroup, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -1712,6 +1922,13 @@ struct ConvAsmImplicitGemmV4R1DynamicBwd final : ConvSolver
         return GetSolverDbId<ConvAsmImplicitGemmV4R1DynamicBwd>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::SingleGroup, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -1728,6 +1945,13 @@ struct ConvAsmImplicitGemmGTCDynamicFwdXdlops final : ConvSolver
         return GetSolverDbId<ConvAsmImplicitGemmGTCDynamicFwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::NotCasted, ProblemFeature::LayoutDefault,
+                ProblemFeature::Packed, ProblemFeature::SingleGroup, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -1744,6 +1968,13 @@ struct ConvAsmImplicitGemmGTCDynamicBwdXdlops final : ConvSolver
         return GetSolverDbId<ConvAsmImplicitGemmGTCDynamicBwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::NotCasted, ProblemFeature::LayoutDefault,
+                ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -1775,6 +2006,14 @@ struct MIOPEN_INTERNALS_EXPORT ConvOclDirectFwd final : ConvOclDirectFwdLegacyEx
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvOclDirectFwd>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::BackwardData, ProblemFeature::Spatial2d,
+                ProblemFeature::Fp32, ProblemFeature::Fp16, ProblemFeature::Bfp16,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::OpenCLKernels};
+    }
+
     static ConvSolution BaseGetSolution(const ExecutionContext&,
                                         const miopen::conv::ProblemDescription&,
                                         const LegacyPerformanceConfig&);
@@ -1793,6 +2032,14 @@ struct MIOPEN_INTERNALS_EXPORT ConvOclDirectFwd1x1 final : ConvOclDirectFwdLegac
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvOclDirectFwd1x1>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::BackwardData, ProblemFeature::Spatial2d,
+                ProblemFeature::Fp32, ProblemFeature::Fp16, ProblemFeature::Bfp16,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::OpenCLKernels};
+    }
+
     bool IsApplicable(const ExecutionContext&,
                       const miopen::conv::ProblemDescription&) const override;
     ConvSolution GetSolution(const ExecutionContext&,
@@ -1811,6 +2058,13 @@ struct ConvBinWinograd3x3U final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvBinWinograd3x3U>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::BackwardData, ProblemFeature::Spatial2d,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -1824,6 +2078,12 @@ struct ConvBinWinogradRxS final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvBinWinogradRxS>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Spatial2d, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::NotCasted, ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -2235,6 +2495,13 @@ struct ConvAsmBwdWrW3x3 final : ConvTunableSolver<PerformanceConfigAsmDirect3x3W
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsmBwdWrW3x3>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigAsmDirect3x3WrW GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -2378,6 +2645,13 @@ struct ConvAsmBwdWrW1x1 final : ConvTunableSolver<PerformanceConfigConvAsmBwdWrW
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsmBwdWrW1x1>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsmBwdWrW1x1 MIOPEN_INTERNALS_EXPORT
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -2540,6 +2814,14 @@ struct ConvOclBwdWrW53 final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvOclBwdWrW53>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::OpenCLKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
@@ -2553,6 +2835,14 @@ struct ConvOclBwdWrW1x1 final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvOclBwdWrW1x1>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed,
+                ProblemFeature::OpenCLKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
@@ -2566,6 +2856,12 @@ struct fft final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<fft>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::BackwardData, ProblemFeature::Fp32,
+                ProblemFeature::LayoutDefault};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
 
@@ -2648,6 +2944,13 @@ struct ConvHipImplicitGemmWrwV4R4Xdlops final
         return GetSolverDbId<ConvHipImplicitGemmWrwV4R4Xdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmWrwV4R4Xdlops GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
@@ -2744,6 +3047,13 @@ struct ConvHipImplicitGemmWrwV4R4Xdlops_Padded_Gemm final
         return GetSolverDbId<ConvHipImplicitGemmWrwV4R4Xdlops_Padded_Gemm>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::Packed, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceImplicitGemmWrwV4R4Xdlops_Padded_Gemm
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -2802,6 +3112,13 @@ struct ConvCkIgemmFwdV6r1DlopsNchw final : ConvTunableSolver<PerformanceConvCkIg
         return GetSolverDbId<ConvCkIgemmFwdV6r1DlopsNchw>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::NotCasted, ProblemFeature::LayoutDefault,
+                ProblemFeature::Packed, ProblemFeature::SingleGroup, ProblemFeature::HipKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT size_t GetWorkspaceSize(
@@ -2831,6 +3148,11 @@ struct ConvDirectNaiveConvFwd final : ConvSolver
         return GetSolverDbId<ConvDirectNaiveConvFwd>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::LayoutDefault, ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
@@ -2851,6 +3173,13 @@ struct ConvDirectNaiveConvBwd final : ConvSolver
         return GetSolverDbId<ConvDirectNaiveConvBwd>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::Fp8, ProblemFeature::LayoutDefault,
+                ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
@@ -2871,6 +3200,13 @@ struct ConvDirectNaiveConvWrw final : ConvSolver
         return GetSolverDbId<ConvDirectNaiveConvWrw>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Fp32, ProblemFeature::Fp16,
+                ProblemFeature::Bfp16, ProblemFeature::Fp8, ProblemFeature::LayoutDefault,
+                ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     bool IsDynamic() const override { return true; }
@@ -2921,6 +3257,12 @@ struct MIOPEN_INTERNALS_EXPORT GemmFwd1x1_0_1_int8 final : GemmFwdBase
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<GemmFwd1x1_0_1_int8>(); }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Fp32, ProblemFeature::Fp16, ProblemFeature::Bfp16,
+                ProblemFeature::Int8, ProblemFeature::NotCasted};
+    }
+
     size_t GetWorkspaceSize(const ExecutionContext&,
                             const miopen::conv::ProblemDescription&) const override;
 
@@ -3462,6 +3804,13 @@ struct ConvAsmImplicitGemmGTCDynamicFwdXdlopsNHWC final
         return GetSolverDbId<ConvAsmImplicitGemmGTCDynamicFwdXdlopsNHWC>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigAsmImplicitGemmGTCFwdXdlopsNHWC
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -3666,6 +4015,13 @@ struct ConvAsmImplicitGemmGTCDynamicBwdXdlopsNHWC final
         return GetSolverDbId<ConvAsmImplicitGemmGTCDynamicBwdXdlopsNHWC>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigAsmImplicitGemmGTCBwdXdlopsNHWC
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -3876,6 +4232,13 @@ struct ConvAsmImplicitGemmGTCDynamicWrwXdlopsNHWC final
         return GetSolverDbId<ConvAsmImplicitGemmGTCDynamicWrwXdlopsNHWC>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d, ProblemFeature::Fp32,
+                ProblemFeature::Fp16, ProblemFeature::Bfp16, ProblemFeature::NotCasted,
+                ProblemFeature::Packed, ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigAsmImplicitGemmGTCWrwXdlopsNHWC
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4231,6 +4594,14 @@ struct ConvAsmImplicitGemmGTCDynamicFwdDlopsNCHWC final
     {
         return GetSolverDbId<ConvAsmImplicitGemmGTCDynamicFwdDlopsNCHWC>();
     }
+
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::Fp16,
+                ProblemFeature::NotCasted, ProblemFeature::LayoutNCHWc, ProblemFeature::Packed,
+                ProblemFeature::AsmKernels};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigAsmImplicitGemmGTCFwdDlopsNCHWC
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4295,6 +4666,12 @@ struct ConvHipImplicitGemmFwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemmFwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutNHWC, ProblemFeature::Packed, ProblemFeature::SingleGroup};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmFwdXdlops GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -4377,6 +4754,12 @@ struct ConvHipImplicitGemmBwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemmBwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial2d, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutNHWC, ProblemFeature::Packed, ProblemFeature::SingleGroup};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmBwdXdlops GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -4462,6 +4845,12 @@ struct ConvHipImplicitGemmGroupFwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemmGroupFwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial2d, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::LayoutNHWC, ProblemFeature::Packed};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmGroupFwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4539,6 +4928,12 @@ struct ConvHipImplicitGemm3DGroupFwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemm3DGroupFwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Spatial3d, ProblemFeature::LayoutDefault,
+                ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemm3DGroupFwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4616,6 +5011,12 @@ struct ConvHipImplicitGemm3DGroupWrwXdlops final
         return GetSolverDbId<ConvHipImplicitGemm3DGroupWrwXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial3d,
+                ProblemFeature::LayoutDefault, ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemm3DGroupWrwXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4693,6 +5094,12 @@ struct ConvHipImplicitGemm3DGroupBwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemm3DGroupBwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial3d, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemm3DGroupBwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4784,6 +5191,12 @@ struct ConvHipImplicitGemmGroupBwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemmGroupBwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Spatial2d, ProblemFeature::NotCasted,
+                ProblemFeature::LayoutDefault, ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmGroupBwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4878,6 +5291,12 @@ struct ConvHipImplicitGemmGroupWrwXdlops final
         return GetSolverDbId<ConvHipImplicitGemmGroupWrwXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Spatial2d,
+                ProblemFeature::LayoutDefault, ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmGroupWrwXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4955,6 +5374,12 @@ struct ConvHipImplicitGemmF16F8F16FwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemmF16F8F16FwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::Forward, ProblemFeature::Fp16, ProblemFeature::Casted,
+                ProblemFeature::LayoutNHWC, ProblemFeature::Packed};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmF16F8F16FwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -5028,6 +5453,12 @@ struct ConvHipImplicitGemmF16F8F16BwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemmF16F8F16BwdXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardData, ProblemFeature::Fp16, ProblemFeature::Casted,
+                ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmF16F8F16BwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -5101,6 +5532,12 @@ struct ConvHipImplicitGemmF16F8F16WrwXdlops final
         return GetSolverDbId<ConvHipImplicitGemmF16F8F16WrwXdlops>();
     }
 
+    ApplicabilityConstraints GetApplicabilityConstraints() const
+    {
+        return {ProblemFeature::BackwardWeights, ProblemFeature::Fp16, ProblemFeature::Casted,
+                ProblemFeature::LayoutNHWC};
+    }
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmF16F8F16WrwXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -151,6 +151,12 @@ std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
                                       int requestAlgoCount,
                                       bool force_attach_binary);
 
+/// Compiles the kernels FindConvolution() is going to need for the problem, without running
+/// anything on the device.
+void PrecompileConvolution(const ExecutionContext& ctx,
+                           const conv::ProblemDescription& problem,
+                           bool force_attach_binary);
+
 struct MIOPEN_INTERNALS_EXPORT ConvolutionDescriptor : miopenConvolutionDescriptor
 {
     ConvolutionDescriptor(std::size_t spatial_dim,
@@ -282,6 +282,7 @@ public:
     friend class PlainTextDb;
     friend class SQLitePerfDb;
     friend class ReadonlyRamDb;
+    friend class MappedDb;
     friend class RamDb;
 };
 
@@ -27,6 +27,7 @@
 #define GUARD_MIOPEN_ENV_HPP
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <optional>
@@ -41,6 +42,9 @@ namespace miopen::env {
 MIOPEN_EXPORT std::optional<std::string> getEnvironmentVariable(std::string_view name);
 MIOPEN_EXPORT void setEnvironmentVariable(std::string_view name, std::string_view value);
 MIOPEN_EXPORT void clearEnvironmentVariable(std::string_view name);
+/// Incremented whenever one of the functions above sets or clears a variable. Caches of results
+/// which depend on the environment use it to tell stale results apart.
+MIOPEN_EXPORT std::uint64_t getEnvironmentGeneration();
 
 namespace detail {
 
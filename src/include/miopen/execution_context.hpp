@@ -27,6 +27,7 @@
 #pragma once
 
 #include <miopen/db_path.hpp>
+#include <miopen/errors.hpp>
 #include <miopen/handle.hpp>
 #if MIOPEN_ENABLE_SQLITE
 #include <miopen/sqlite_db.hpp>
@@ -36,6 +37,7 @@
 #endif
 #include <miopen/filesystem.hpp>
 
+#include <atomic>
 #include <string>
 #include <string_view>
 
@@ -97,6 +99,15 @@ struct MIOPEN_INTERNALS_EXPORT ExecutionContext
     bool disable_perfdb_access      = false;
     bool use_dynamic_solutions_only = false;
     bool is_for_generic_search      = false;
+    /// Set for searches which may be abandoned, see BackgroundFinder::Stopping(). Searches call
+    /// ThrowIfCancelled() between candidates.
+    const std::atomic<bool>* cancelled = nullptr;
+
+    void ThrowIfCancelled() const
+    {
+        if(cancelled != nullptr && cancelled->load())
+            MIOPEN_THROW("The search has been cancelled");
+    }
 
     inline Handle& GetStream() const { return *stream; }
     inline void SetStream(Handle* stream_) { stream = stream_; }
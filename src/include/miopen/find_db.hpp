@@ -167,6 +167,8 @@ public:
         record.in_sync = false;
         record.content.emplace(DbKinds::FindDb, problem);
 
+        // Nothing is stored if the search throws, e.g. when it is cancelled
+        record.dont_store = true;
         const auto result = regenerator();
         record.dont_store = !result.is_optimal;
 
@@ -178,7 +180,10 @@ public:
             const auto algo = solution.GetSolver().GetAlgo(problem.GetDirection());
             record.content->SetValues(
                 solution.GetSolver().ToString(),
-                FindDbData{solution.GetTime(), solution.GetWorkspaceSize(), algo});
+                FindDbData{solution.GetTime(),
+                           solution.GetWorkspaceSize(),
+                           algo,
+                           solution.GetTimeStdDev()});
         }
 
         return result.solutions;
@@ -29,6 +29,7 @@
 
 #include "miopen/miopen.h"
 #include <miopen/env.hpp>
+#include <miopen/conv/applicability_index.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/execution_context.hpp>
@@ -128,6 +129,7 @@ auto FindSolutionImpl(rank<1>,
 
         if(context.do_search || enforce.IsSearch(context)) // TODO: Make it a customization point
         {
+            context.ThrowIfCancelled();
             MIOPEN_LOG_I("Starting search: " << s.SolverDbId() << ", enforce: " << enforce);
             try
             {
@@ -137,6 +139,8 @@ auto FindSolutionImpl(rank<1>,
             }
             catch(const miopen::Exception& ex)
             {
+                // Cancellation ends the search of all solvers, not just this one
+                context.ThrowIfCancelled();
                 MIOPEN_LOG_E("Search failed for: " << s.SolverDbId() << ": " << ex.what());
                 return ConvSolution(miopenStatusInternalError);
             }
@@ -237,6 +241,23 @@ InvokerFactory GetInvokeFactory(Solver s,
     return GetInvokeFactoryImpl(rank<1>{}, s, context, problem, perf_cfg);
 }
 
+/// Returns a predicate checking the applicability of solvers to the problem. Convolution
+/// solvers are checked through the applicability index.
+template <class Context, class Problem>
+auto MakeApplicabilityCheck(const Context& ctx, const Problem& problem)
+{
+    if constexpr(std::is_same<Problem, miopen::conv::ProblemDescription>{})
+    {
+        return [query = miopen::conv::ApplicabilityQuery{ctx, problem}](const auto& solver) {
+            return query.IsApplicable(solver);
+        };
+    }
+    else
+    {
+        return [&](const auto& solver) { return solver.IsApplicable(ctx, problem); };
+    }
+}
+
 template <class... Solvers>
 struct SolverContainer
 {
@@ -282,7 +303,8 @@ struct SolverContainer
     {
         std::vector<Solution> ss;
         std::size_t count    = 0;
-        const auto find_only = GetEnvFindOnlySolver();
+        const auto find_only     = GetEnvFindOnlySolver();
+        const auto is_applicable = MakeApplicabilityCheck(ctx, problem);
         miopen::each_args(
             [&](auto solver) {
                 if(count >= limit)
@@ -298,7 +320,7 @@ struct SolverContainer
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
                 }
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(!is_applicable(solver))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
                 }
@@ -339,7 +361,8 @@ struct SolverContainer
         auto db_container = std::optional<PerformanceDb>{};
         std::vector<Solution> ss;
         std::size_t count    = 0;
-        const auto find_only = GetEnvFindOnlySolver();
+        const auto find_only     = GetEnvFindOnlySolver();
+        const auto is_applicable = MakeApplicabilityCheck(ctx, problem);
         miopen::each_args(
             [&](auto solver) {
                 if(count >= limit)
@@ -353,7 +376,7 @@ struct SolverContainer
                 // it is much faster than IsApplicable().
                 // else if(problem.use_dynamic_solutions_only && !solver.IsDynamic())
                 //    MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(!is_applicable(solver))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
                 }
@@ -399,7 +422,8 @@ struct SolverContainer
         const Context& ctx, const Problem& problem, const bool simple_primitive = false) const
     {
         std::vector<std::pair<std::string, size_t>> res;
-        const auto find_only = GetEnvFindOnlySolver();
+        const auto find_only     = GetEnvFindOnlySolver();
+        const auto is_applicable = MakeApplicabilityCheck(ctx, problem);
         miopen::each_args(
             [&](auto solver) {
                 if(find_only &&
@@ -423,7 +447,7 @@ struct SolverContainer
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
                 }
-                else if(!solver.IsApplicable(ctx, problem))
+                else if(!is_applicable(solver))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
                 }
@@ -442,8 +466,9 @@ struct SolverContainer
     template <class Context, class Problem>
     bool IsAnySolverApplicable(const Context& ctx, const Problem& problem) const
     {
-        const auto find_only = GetEnvFindOnlySolver();
-        auto found           = false;
+        const auto find_only     = GetEnvFindOnlySolver();
+        const auto is_applicable = MakeApplicabilityCheck(ctx, problem);
+        auto found               = false;
 
         miopen::each_args(
             [&](auto solver) {
@@ -460,7 +485,7 @@ struct SolverContainer
                     return;
                 }
 
-                if(solver.IsApplicable(ctx, problem))
+                if(is_applicable(solver))
                 {
                     found = true;
                     return;
@@ -183,8 +183,11 @@ private:
         {
             if(op->kind() == miopenFusionOpConvForward)
             {
-                const auto prob = GetConvProblem(op->GetIdx(), conv::Direction::Forward);
-                net_config << prob.MakeNetworkConfig().ToString();
+                // The string form, it is a part of the db keys of the fusion
+                const auto prob  = GetConvProblem(op->GetIdx(), conv::Direction::Forward);
+                auto conv_config = std::string{};
+                prob.MakeNetworkConfig(conv_config);
+                net_config << conv_config;
             }
             else if(op->kind() == miopenFusionOpBatchNormInference)
             {
@@ -27,6 +27,7 @@
 #ifndef GUARD_MIOPEN_GENERIC_SEARCH_HPP_
 #define GUARD_MIOPEN_GENERIC_SEARCH_HPP_
 
+#include <miopen/benchmark.hpp>
 #include <miopen/binary_cache.hpp>
 #include <miopen/config.hpp>
 #include <miopen/conv_solution.hpp>
@@ -38,15 +39,24 @@
 #include <miopen/timer.hpp>
 #include <miopen/mt_queue.hpp>
 #include <miopen/generic_search_controls.hpp>
+#include <miopen/thread_pool.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <utility>
 #include <vector>
 #include <cstdlib>
 #include <limits>
+#include <memory>
 #include <iterator>
 #include <chrono>
 #include <cassert>
 #include <random>
+#include <type_traits>
 
 namespace miopen {
 namespace solver {
@@ -306,45 +316,283 @@ std::size_t GetTuningIterationsMax();
 std::chrono::milliseconds GetTuningTimeMax(); // returns the max allowed time in milliseconds
 std::size_t GetTuningThreadsMax();
 
+std::size_t GetTuningCompileAheadMax();
+
+/// Optional solver hook used to skip configs before they are compiled or benchmarked:
+///
+///   float PredictTime(const Context&, const Problem&, const PerformanceConfig&) const;
+///
+/// It must be cheap, and should return an optimistic estimate of the kernel time in ms, or a
+/// negative value if it has no idea. Configs whose estimate can't beat the best time measured so
+/// far are skipped.
+template <class Solver, class Context, class Problem, class PerformanceConfig, class = void>
+struct HasTimePredictor : std::false_type
+{
+};
+
+template <class Solver, class Context, class Problem, class PerformanceConfig>
+struct HasTimePredictor<
+    Solver,
+    Context,
+    Problem,
+    PerformanceConfig,
+    std::void_t<decltype(std::declval<const Solver&>().PredictTime(
+        std::declval<const Context&>(),
+        std::declval<const Problem&>(),
+        std::declval<const PerformanceConfig&>()))>> : std::true_type
+{
+};
+
+template <class Solver, class Context, class Problem, class PerformanceConfig>
+bool IsPredictedSlower([[maybe_unused]] const Solver& s,
+                       [[maybe_unused]] const Context& context,
+                       [[maybe_unused]] const Problem& problem,
+                       [[maybe_unused]] const PerformanceConfig& config,
+                       [[maybe_unused]] float best_time)
+{
+    if constexpr(HasTimePredictor<Solver, Context, Problem, PerformanceConfig>::value)
+    {
+        if(best_time == std::numeric_limits<float>::max())
+            return false;
+        const auto predicted = s.PredictTime(context, problem, config);
+        // Same margin as the one used to decide whether a config is worth re-running
+        if(predicted < 0.0f || predicted <= best_time * 1.10f)
+            return false;
+        MIOPEN_LOG_I2("Skipped, predicted " << predicted << " > " << best_time << ' ' << config);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <typename PerformanceConfig>
+struct CompiledCandidate
+{
+    PerformanceConfig config;
+    ConvSolution solution;
+    bool done        = false; // Marks that the agent has finished, no config in this case
+    float compile_ms = 0.0f;
+    std::chrono::steady_clock::time_point queued;
+};
+
+/// Compile agents run on the shared ThreadPool and feed the benchmarking loop through a bounded
+/// queue. They take the next config to build from a common counter, so an agent that got cheap
+/// configs doesn't go idle while others still have work. The search may itself run on a pool
+/// worker, or the pool may be busy, so the loop never waits for agents that haven't started: it
+/// compiles the next config itself when the queue is empty and cancels the agents that are still
+/// queued once all configs are taken.
+template <typename PerformanceConfig>
+struct CompilePipeline
+{
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> n_pruned{0};
+    /// Best time measured so far, the threshold for IsPredictedSlower()
+    std::atomic<float> best_time{std::numeric_limits<float>::max()};
+    ThreadSafeQueue<CompiledCandidate<PerformanceConfig>> queue;
+    const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+    explicit CompilePipeline(std::size_t capacity, ThreadPool& pool_ = ThreadPool::Get())
+        : queue(capacity), pool(pool_)
+    {
+    }
+    CompilePipeline(const CompilePipeline&) = delete;
+    CompilePipeline& operator=(const CompilePipeline&) = delete;
+
+    /// Queues the agents to the pool. Each of them pushes a done marker when it finishes, unless
+    /// it has been cancelled before it started.
+    template <class F>
+    void Start(std::size_t count, F agent)
+    {
+        {
+            const std::lock_guard<std::mutex> lock{agents->mutex};
+            agents->unstarted += count;
+        }
+        remaining += count;
+
+        for(std::size_t idx = 0; idx < count; ++idx)
+        {
+            // The pipeline may be gone by the time a cancelled agent is taken from the pool
+            pool.Post([this, state = agents, agent, idx]() {
+                {
+                    const std::lock_guard<std::mutex> lock{state->mutex};
+                    if(state->unstarted == 0)
+                        return;
+                    --state->unstarted;
+                    ++state->running;
+                }
+
+                auto error = std::exception_ptr{};
+                try
+                {
+                    agent(idx);
+                }
+                catch(...)
+                {
+                    error = std::current_exception();
+                }
+
+                // Don't leave the benchmarking loop waiting for this agent
+                auto done   = CompiledCandidate<PerformanceConfig>{};
+                done.done   = true;
+                std::ignore = queue.push(std::move(done));
+
+                const std::lock_guard<std::mutex> lock{state->mutex};
+                --state->running;
+                if(error && !state->error)
+                    state->error = error;
+                state->idle.notify_all();
+            });
+        }
+    }
+
+    /// Returns the next compiled candidate. Calls compile_next() to build one on the calling thread
+    /// if none is ready. Returns nothing once all configs are taken and the agents are done.
+    template <class F>
+    std::optional<CompiledCandidate<PerformanceConfig>> Pop(F compile_next)
+    {
+        for(;;)
+        {
+            auto candidate = CompiledCandidate<PerformanceConfig>{};
+            if(!queue.try_pop(candidate))
+            {
+                // Nothing is compiled yet, maybe because the pool is busy: help the agents
+                if(auto compiled = compile_next())
+                    return compiled;
+
+                // All configs are taken, only the agents at work can push anything
+                remaining -= Cancel();
+                if(remaining == 0)
+                    return std::nullopt;
+                MIOPEN_LOG_I2("Waiting for item in queue");
+                candidate = queue.pop();
+            }
+
+            if(!candidate.done)
+                return candidate;
+            --remaining;
+        }
+    }
+
+    /// Returns the number of agents that won't start, and so won't push a done marker.
+    std::size_t Cancel()
+    {
+        const std::lock_guard<std::mutex> lock{agents->mutex};
+        return std::exchange(agents->unstarted, 0);
+    }
+
+    /// Stops the agents once they are done with the config at hand.
+    void Close(std::size_t data_size)
+    {
+        next = data_size;
+        queue.close();
+    }
+
+    /// Waits for the agents that have started and rethrows the first error of them.
+    void Wait()
+    {
+        std::ignore = Cancel();
+        std::unique_lock<std::mutex> lock{agents->mutex};
+        agents->idle.wait(lock, [&]() { return agents->running == 0; });
+        if(agents->error)
+            std::rethrow_exception(std::exchange(agents->error, nullptr));
+    }
+
+    ~CompilePipeline()
+    {
+        // The agents refer to the search state, so they must be done before it goes away
+        queue.close();
+        std::ignore = Cancel();
+        std::unique_lock<std::mutex> lock{agents->mutex};
+        agents->idle.wait(lock, [&]() { return agents->running == 0; });
+    }
+
+private:
+    struct Agents
+    {
+        std::mutex mutex;
+        std::condition_variable idle;
+        std::size_t unstarted = 0;
+        std::size_t running   = 0;
+        std::exception_ptr error;
+    };
+
+    ThreadPool& pool;
+    std::shared_ptr<Agents> agents = std::make_shared<Agents>();
+    /// Agents whose done marker hasn't been popped yet, only used by the consumer
+    std::size_t remaining = 0;
+};
+
+/// Compiles the next config that nobody has taken yet, skipping the ones that are predicted to be
+/// slower than the best so far. Returns nothing when all configs are taken or the time budget is
+/// exhausted.
+template <typename PerformanceConfig, typename Solver, typename Context, typename Problem>
+std::optional<CompiledCandidate<PerformanceConfig>>
+CompileNext(CompilePipeline<PerformanceConfig>& pipeline,
+            const Solver& s,
+            const Context& context,
+            const Problem& problem,
+            std::vector<PerformanceConfig>& data)
+{
+    auto idx = pipeline.next++;
+    for(; idx < data.size(); idx = pipeline.next++)
+    {
+        if(!IsPredictedSlower(s, context, problem, data[idx], pipeline.best_time.load()))
+            break;
+        ++pipeline.n_pruned;
+    }
+    if(idx >= data.size())
+        return std::nullopt;
+    if(std::chrono::steady_clock::now() - pipeline.start_time > GetTuningTimeMax())
+    {
+        MIOPEN_LOG_I2("Exhausted time budget");
+        pipeline.next = data.size();
+        return std::nullopt;
+    }
+
+    const auto& profile_h         = context.GetStream();
+    auto& current_config          = data.at(idx);
+    const auto compile_start      = std::chrono::steady_clock::now();
+    ConvSolution current_solution = s.GetSolution(context, problem, current_config);
+    for(const auto& kernel : current_solution.construction_params)
+    {
+        if(profile_h.HasProgram(kernel.kernel_file, kernel.comp_options))
+            continue;
+        std::ignore = profile_h.LoadProgram(kernel.kernel_file, kernel.comp_options, "");
+    }
+
+    auto candidate     = CompiledCandidate<PerformanceConfig>{};
+    candidate.config   = std::move(current_config);
+    candidate.solution = std::move(current_solution);
+    candidate.queued   = std::chrono::steady_clock::now();
+    candidate.compile_ms =
+        std::chrono::duration<float, std::milli>(candidate.queued - compile_start).count();
+    return candidate;
+}
+
 template <typename PerformanceConfig, typename Solver, typename Context, typename Problem>
 void CompileAgent(size_t thread_index,
-                  size_t total_threads,
+                  CompilePipeline<PerformanceConfig>& pipeline,
                   const Solver& s,
                   const Context& context,
                   const Problem& problem,
-                  std::vector<PerformanceConfig>& data,
-                  ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>>& comp_queue)
+                  std::vector<PerformanceConfig>& data)
 {
-    const auto start_time =
-        std::chrono::time_point_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now());
-    const auto data_size   = data.size();
-    const auto time_budget = GetTuningTimeMax();
-    const auto& profile_h  = context.GetStream();
-    // start the counter
-    for(auto idx = thread_index; idx < data_size; idx += total_threads)
+    const auto& profile_h = context.GetStream();
+    while(auto candidate = CompileNext(pipeline, s, context, problem, data))
     {
-        // Check if we are out of time
-        const auto current_time = std::chrono::time_point_cast<std::chrono::milliseconds>(
-            std::chrono::steady_clock::now());
-        if(current_time - start_time > time_budget)
+        const auto kernels = candidate->solution.construction_params;
+        if(!pipeline.queue.push(std::move(*candidate)))
         {
-            MIOPEN_LOG_I2("Thread: " << thread_index << " Done, exhausted time budget");
-            auto tmp = std::make_tuple<PerformanceConfig, ConvSolution, bool>({}, {}, true);
-            comp_queue.push(std::move(tmp));
-            break;
+            // The search has ended, nobody is going to run these
+            for(const auto& kernel : kernels)
+                profile_h.ClearProgram(kernel.kernel_file, kernel.comp_options);
+            MIOPEN_LOG_I2("Thread: " << thread_index << " Done, search has ended");
+            return;
         }
-        auto& current_config          = data.at(idx);
-        ConvSolution current_solution = s.GetSolution(context, problem, current_config);
-        for(const auto& kernel : current_solution.construction_params)
-        {
-            if(profile_h.HasProgram(kernel.kernel_file, kernel.comp_options))
-                continue;
-            std::ignore = profile_h.LoadProgram(kernel.kernel_file, kernel.comp_options, "");
-        }
-        auto tup = std::make_tuple<PerformanceConfig, ConvSolution, bool>(
-            std::move(current_config), std::move(current_solution), false);
-        comp_queue.push(std::move(tup));
     }
+
     MIOPEN_LOG_I2("Thread: " << thread_index << " Done, completed tuning");
 }
 
@@ -407,28 +655,29 @@ auto GenericSearch(const Solver s,
     HeartBeat<PerformanceConfig> heartbeat;
     heartbeat.Start();
 
+    // The first probe of a config warms it up
+    auto benchmark_options   = BenchmarkOptions::FromEnv();
+    benchmark_options.warmup = 0;
+
     const auto total_threads = GetTuningThreadsMax();
 
-    ThreadSafeQueue<std::tuple<PerformanceConfig, ConvSolution, bool>> solution_queue;
-    std::vector<std::thread> compile_agents;
-    compile_agents.reserve(total_threads);
-    for(auto idx = 0; idx < total_threads; ++idx)
-    {
-        compile_agents.emplace_back(CompileAgent<PerformanceConfig, Solver, Context, Problem>,
-                                    idx,
-                                    total_threads,
-                                    std::cref(s),
-                                    std::cref(context),
-                                    std::cref(problem),
-                                    std::ref(all_configs),
-                                    std::ref(solution_queue));
-    }
+    // Compiled programs wait here until they are benchmarked. There is nobody to benchmark them
+    // in the compile-only mode, so the queue must not block there.
+    const auto compile_only = env::enabled(MIOPEN_DEBUG_COMPILE_ONLY);
+    CompilePipeline<PerformanceConfig> pipeline{compile_only ? 0 : GetTuningCompileAheadMax()};
+    pipeline.Start(total_threads, [&](std::size_t idx) {
+        CompileAgent<PerformanceConfig, Solver, Context, Problem>(
+            idx, pipeline, s, context, problem, all_configs);
+    });
+
+    float total_compile_ms   = 0.0f;
+    float total_wait_ms      = 0.0f;
+    float total_benchmark_ms = 0.0f;
 
-    if(!env::enabled(MIOPEN_DEBUG_COMPILE_ONLY))
+    if(!compile_only)
     {
-        size_t n_current       = 0;
-        size_t last_imprv      = 0;
-        auto threads_remaining = total_threads;
+        size_t n_current  = 0;
+        size_t last_imprv = 0;
         while(true)
         {
             if(n_current >= n_runs_total)
@@ -441,26 +690,30 @@ auto GenericSearch(const Solver s,
                 MIOPEN_LOG_I2("Ending Search by patience: " << patience);
                 break;
             }
+            context.ThrowIfCancelled();
 
-            last_imprv++;
-            MIOPEN_LOG_I2("Waiting for item in queue");
-            const auto kinder     = solution_queue.pop();
-            auto current_config   = std::get<0>(kinder);
-            auto current_solution = std::get<1>(kinder);
+            auto candidate = pipeline.Pop(
+                [&]() { return CompileNext(pipeline, s, context, problem, all_configs); });
+            if(!candidate)
+                break;
+            auto& current_config   = candidate->config;
+            auto& current_solution = candidate->solution;
 
-            if(std::get<2>(kinder))
+            // The best time may have improved since the config was compiled
+            if(IsPredictedSlower(s, context, problem, current_config, best_time))
             {
-                threads_remaining--;
-                if(threads_remaining == 0)
-                {
-                    break;
-                }
-                else
-                {
-                    continue;
-                }
+                ++pipeline.n_pruned;
+                for(const auto& kernel : current_solution.construction_params)
+                    profile_h.ClearProgram(kernel.kernel_file, kernel.comp_options);
+                continue;
             }
 
+            last_imprv++;
+            const auto benchmark_start = std::chrono::steady_clock::now();
+            const auto wait_ms =
+                std::chrono::duration<float, std::milli>(benchmark_start - candidate->queued)
+                    .count();
+
             float elapsed_time = 0.0f;
             int ret            = 0;
             MIOPEN_LOG_I2('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
@@ -504,45 +757,43 @@ auto GenericSearch(const Solver s,
             {
                 // Smooth the jitter of measurements:
                 // If the 1st probe is NOT too bad (measured time <= 1.10 * best known time),
-                // then re-run it 9 times more and compute average time,
-                // and decide using average of all 10 attempts vs. the best.
-                constexpr int N_RUNS = 10;
+                // then sample it until the estimate is stable enough,
+                // and decide using the estimate vs. the best.
                 if(elapsed_time / best_time < 1.10f)
                 {
-                    MIOPEN_LOG_I2("Finding average for: " << elapsed_time << " / " << best_time
-                                                          << " = " << (elapsed_time / best_time));
+                    MIOPEN_LOG_I2("Sampling: " << elapsed_time << " / " << best_time << " = "
+                                               << (elapsed_time / best_time));
 
-                    try
-                    {
-                        for(int i = 1; i < N_RUNS; ++i)
-                        {
-                            invoker(profile_h, invoke_ctx);
-                            elapsed_time += profile_h.GetKernelTime();
-                        }
-                    }
-                    catch(...)
+                    auto benchmark = Benchmark{benchmark_options};
+                    benchmark.Add([&]() {
+                        invoker(profile_h, invoke_ctx);
+                        return profile_h.GetKernelTime();
+                    });
+                    const auto stats = benchmark.Run().front();
+
+                    if(stats.failed)
                     {
                         ret = 1;
                     }
-
-                    if(ret == 0)
+                    else
                     {
-                        is_passed = true;
-                        elapsed_time /= N_RUNS;
+                        is_passed    = true;
+                        elapsed_time = stats.estimate;
                         if(elapsed_time < best_time)
                         {
                             MIOPEN_LOG_I('#' << n_current << '/' << n_failed << '/' << n_runs_total
                                              << ' ' << elapsed_time << " < " << best_time << ' '
                                              << current_config);
-                            best_config = current_config;
-                            best_time   = elapsed_time;
-                            n_best      = n_current;
-                            last_imprv  = 0;
+                            best_config        = current_config;
+                            best_time          = elapsed_time;
+                            pipeline.best_time = best_time;
+                            n_best             = n_current;
+                            last_imprv         = 0;
                         }
                         else
                         {
-                            MIOPEN_LOG_I2("Average is not better: " << elapsed_time
-                                                                    << " >= " << best_time);
+                            MIOPEN_LOG_I2("Estimate is not better: " << elapsed_time
+                                                                     << " >= " << best_time);
                         }
                     }
                 }
@@ -554,6 +805,16 @@ auto GenericSearch(const Solver s,
             for(const auto& kernelInfo : current_solution.construction_params)
                 profile_h.ClearProgram(kernelInfo.kernel_file, kernelInfo.comp_options);
 
+            const auto benchmark_ms = std::chrono::duration<float, std::milli>(
+                                          std::chrono::steady_clock::now() - benchmark_start)
+                                          .count();
+            MIOPEN_LOG_I2('#' << n_current << " compile: " << candidate->compile_ms
+                              << " ms, queue wait: " << wait_ms
+                              << " ms, benchmark: " << benchmark_ms << " ms");
+            total_compile_ms += candidate->compile_ms;
+            total_wait_ms += wait_ms;
+            total_benchmark_ms += benchmark_ms;
+
             if(ret != 0)
             {
                 MIOPEN_LOG_E('#' << n_current << " (" << n_runs_total << ") "
@@ -572,13 +833,20 @@ auto GenericSearch(const Solver s,
     }
     else
     {
+        // Build everything along with the agents, this is the point of the compile-only mode
+        while(CompileNext(pipeline, s, context, problem, all_configs)) {}
+        pipeline.Wait();
         MIOPEN_THROW(miopenStatusGpuOperationsSkipped,
                      "Running kernels on GPU is disabled. Search skipped");
     }
 
-    for(auto& agent : compile_agents)
-        agent.join();
+    // Configs that are not compiled yet can't change the result anymore
+    pipeline.Close(all_configs.size());
+    pipeline.Wait();
 
+    MIOPEN_LOG_I("Compile: " << total_compile_ms << " ms, queue wait: " << total_wait_ms
+                             << " ms, benchmark: " << total_benchmark_ms
+                             << " ms, pruned: " << pipeline.n_pruned);
     MIOPEN_LOG_W("Done: " << n_runs_total << '/' << n_failed << '/' << n_runs_total << ", best #"
                           << n_best << ' ' << best_time << ' ' << best_config);
 
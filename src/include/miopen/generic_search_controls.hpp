@@ -46,3 +46,5 @@ MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_COMPILE_PARALLEL_LEVEL,
                               std::thread::hardware_concurrency() / 2)
 #endif
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_COMPILE_ONLY)
+// Max number of compiled configs waiting to be benchmarked. Twice the compile threads if 0
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_COMPILE_AHEAD, 0)
@@ -27,14 +27,18 @@
 #define GUARD_MIOPEN_HANDLE_HPP_
 
 #include <miopen/config.h>
+#include <miopen/binary_cache.hpp>
 #include <miopen/kernel_info.hpp>
 #include <miopen/common.hpp>
 #include <miopen/invoker_cache.hpp>
+#include <miopen/kernel_build_service.hpp>
+#include <miopen/precompile.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/miopen.h>
 #include <miopen/names.hpp>
 #include <miopen/object.hpp>
 #include <miopen/allocator.hpp>
+#include <miopen/background_find.hpp>
 #include <miopen/simple_hash.hpp>
 #include <miopen/solver_id.hpp>
 #include <miopen/stringutils.hpp>
@@ -47,6 +51,7 @@
 #include <ios>
 #include <sstream>
 #include <memory>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 
@@ -120,10 +125,15 @@ struct MIOPEN_EXPORT Handle : miopenHandle
 
     void ClearKernels(const std::string& algorithm, const std::string& network_config) const;
 
-    auto GetKernels(const std::string& algorithm, const std::string& network_config) const
+    std::vector<KernelInvoke> GetKernels(const std::string& algorithm,
+                                         const std::string& network_config) const
     {
-        return this->GetKernelsImpl(algorithm, network_config) |
-               boost::adaptors::transformed([this](Kernel k) { return this->Run(k); });
+        const auto kernels = this->GetKernelsImpl(algorithm, network_config);
+        auto invokes       = std::vector<KernelInvoke>{};
+        invokes.reserve(kernels.size());
+        for(const auto& k : kernels)
+            invokes.push_back(this->Run(k));
+        return invokes;
     }
     KernelInvoke GetKernel(const std::string& algorithm, const std::string& network_config) const
     {
@@ -137,17 +147,30 @@ struct MIOPEN_EXPORT Handle : miopenHandle
     }
 
     KernelInvoke Run(Kernel k, bool coop_launch = false) const;
-    const std::vector<Kernel>& GetKernelsImpl(const std::string& algorithm,
-                                              const std::string& network_config) const;
+    std::vector<Kernel> GetKernelsImpl(const std::string& algorithm,
+                                       const std::string& network_config) const;
 
+    /// Builds the program or loads it from the kernel cache. Goes through KernelBuildService, so
+    /// concurrent requests for the same program share one build.
     Program LoadProgram(const fs::path& program_name,
                         std::string params,
                         const std::string& kernel_src,
                         bool force_attach_binary = false) const;
+    /// Queues LoadProgram() to KernelBuildService. The handle must outlive the build.
+    KernelBuildFuture LoadProgramAsync(const fs::path& program_name,
+                                       std::string params,
+                                       const std::string& kernel_src,
+                                       bool force_attach_binary = false) const;
 
     bool HasProgram(const fs::path& program_name, const std::string& params) const;
+    /// Drops the program from the cache shared by the handles of the device.
     void ClearProgram(const fs::path& program_name, const std::string& params) const;
     void AddProgram(Program prog, const fs::path& program_name, const std::string& params) const;
+    /// Prefetches the cached binaries of (program_name, params) programs in bulk, so that the
+    /// following LoadProgram() calls don't have to read and unpack them one by one. The binaries
+    /// that haven't been used are dropped with the returned object.
+    BinaryPrefetch
+    WarmPrograms(const std::vector<std::pair<fs::path, std::string>>& programs) const;
 
     void Finish() const;
     void Flush() const;
@@ -173,6 +196,14 @@ struct MIOPEN_EXPORT Handle : miopenHandle
 
 private:
     std::string GetDeviceNameImpl() const;
+    std::string GetProgramBuildKey(const fs::path& program_name,
+                                   const std::string& params,
+                                   const std::string& kernel_src,
+                                   bool force_attach_binary) const;
+    Program BuildProgram(const fs::path& program_name,
+                         std::string params,
+                         const std::string& kernel_src,
+                         bool force_attach_binary) const;
 
 public:
     std::ostream& Print(std::ostream& os) const;
@@ -252,7 +283,7 @@ public:
                          const std::string& solver,
                          const std::optional<AlgorithmName>& algo = std::nullopt)
     {
-        invokers.Register({config, solver}, invoker);
+        invokers.Register(config, solver, invoker);
         if(algo.has_value())
             SetAsFound1_0(config, *algo, solver);
     }
@@ -260,7 +291,7 @@ public:
     void
     SetAsFound1_0(const NetworkConfig& config, const AlgorithmName& algo, const std::string& solver)
     {
-        invokers.SetAsFound1_0(config, algo, solver);
+        invokers.SetAsFound1_0(config, algo.ToString(), solver);
     }
 
     std::optional<Invoker> GetInvoker(const NetworkConfig& config,
@@ -273,7 +304,7 @@ public:
         {
             MIOPEN_LOG_I2("Returning an invoker for problem " << config.ToString() << " and solver "
                                                               << solver->ToString());
-            return invokers[std::make_pair(config.ToString(), solver->ToString())];
+            return invokers.FindById(config, *solver);
         }
 
         if(!algo)
@@ -281,15 +312,22 @@ public:
 
         MIOPEN_LOG_I2("Returning an invoker for problem " << config.ToString() << " and algorithm "
                                                           << algo->ToString());
-        return invokers.GetFound1_0(config, *algo);
+        return invokers.GetFound1_0(config, algo->ToString());
     }
 
     std::optional<std::string> GetFound1_0SolverId(const NetworkConfig& config,
                                                    const AlgorithmName& algo) const
     {
-        return invokers.GetFound1_0SolverId(config, algo);
+        return invokers.GetFound1_0SolverId(config, algo.ToString());
     }
 
+    BackgroundPrecompiler& GetPrecompiler() const { return *precompiler; }
+    BackgroundFinder& GetBackgroundFinder() const { return *background_finder; }
+
+    /// Creates a handle for the same device, which work yields to the work of this one where the
+    /// backend allows it.
+    std::unique_ptr<Handle> CreateBackgroundHandle() const;
+
 #if MIOPEN_USE_ROCBLAS
     const rocblas_handle_ptr& rhandle() const;
 #endif
@@ -298,6 +336,9 @@ public:
 #endif
 
 private:
+    /// Background handles skip the manifest, the handle they are created for has compiled it.
+    Handle(miopenAcceleratorQueue_t stream, bool precompile_manifest);
+
 #if MIOPEN_USE_ROCBLAS
     rocblas_handle_ptr CreateRocblasHandle(miopenAcceleratorQueue_t streamID) const;
 #endif
@@ -306,6 +347,11 @@ private:
 #endif
 
     InvokerCache invokers;
+    std::unique_ptr<BackgroundPrecompiler> precompiler =
+        std::make_unique<BackgroundPrecompiler>(*this);
+    // The last member, so that the searches are stopped before the rest of the handle goes away
+    std::unique_ptr<BackgroundFinder> background_finder =
+        std::make_unique<BackgroundFinder>(*this);
 };
 
 inline std::ostream& operator<<(std::ostream& os, const Handle& handle) { return handle.Print(os); }
@@ -26,15 +26,29 @@
 #ifndef GUARD_MIOPEN_HIPOC_PROGRAM_HPP
 #define GUARD_MIOPEN_HIPOC_PROGRAM_HPP
 
+#include <miopen/config.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/manage_ptr.hpp>
 #include <miopen/hipoc_program_impl.hpp>
 #include <miopen/filesystem.hpp>
 #include <hip/hip_runtime_api.h>
 #include <string>
+#include <vector>
 
 namespace miopen {
 
+/// Appends the target options which the HIP backend passes to the compiler. They are a part
+/// of the kernel database keys, so offline builds have to use the same ones.
+MIOPEN_INTERNALS_EXPORT std::string
+AddTargetOptions(const TargetProperties& target, const fs::path& program_name, std::string params);
+
+/// Builds the code object of a program without loading it, so no device is required.
+/// The parameters must already include the target options.
+MIOPEN_INTERNALS_EXPORT std::vector<char> BuildCodeObject(const fs::path& program_name,
+                                                          const std::string& params,
+                                                          const TargetProperties& target,
+                                                          const std::string& kernel_src = "");
+
 struct HIPOCProgramImpl;
 struct HIPOCProgram
 {
@@ -28,46 +28,90 @@
 
 #include <miopen/errors.hpp>
 #include <miopen/invoker.hpp>
+#include <miopen/names.hpp>
+#include <miopen/solver_id.hpp>
 
-#include <map>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 #include <optional>
+#include <shared_mutex>
+#include <vector>
 
 namespace miopen {
 
+/// Thread-safe, as invokers may be registered by background compilation while the handle is in
+/// use.
 class InvokerCache
 {
 public:
-    // network_config, solver_id
-    using Key = std::pair<std::string, std::string>;
+    InvokerCache() = default;
+    InvokerCache(InvokerCache&& other) noexcept;
+    InvokerCache& operator=(InvokerCache&& other) noexcept;
 
-    std::optional<Invoker> operator[](const Key& key) const;
+    std::optional<Invoker> Find(const NetworkConfig& network_config,
+                                const std::string& solver_id) const;
+    /// Compares the numeric ids, so the solver name doesn't have to be rendered.
+    std::optional<Invoker> FindById(const NetworkConfig& network_config,
+                                    const solver::Id& solver_id) const;
     // For find 1.0
-    std::optional<Invoker> GetFound1_0(const std::string& network_config,
+    std::optional<Invoker> GetFound1_0(const NetworkConfig& network_config,
                                        const std::string& algorithm) const;
-    std::optional<std::string> GetFound1_0SolverId(const std::string& network_config,
+    std::optional<std::string> GetFound1_0SolverId(const NetworkConfig& network_config,
                                                    const std::string& algorithm) const;
 
-    void Register(const Key& key, const Invoker& invoker);
+    void Register(const NetworkConfig& network_config,
+                  const std::string& solver_id,
+                  const Invoker& invoker);
     // For find 1.0
-    void SetAsFound1_0(const std::string& network_config,
+    void SetAsFound1_0(const NetworkConfig& network_config,
                        const std::string& algorithm,
                        const std::string& solver_id);
 
 private:
+    struct RegisteredInvoker
+    {
+        std::string solver_id;
+        // solver::Id value, zero if the solver_id doesn't name a registered solver
+        std::uint64_t solver_value;
+        Invoker invoker;
+    };
+
     struct Item
     {
+        // Kept for hash collision checks
+        NetworkConfig network_config;
         // algorithm -> solver_id
         // for find 1.0
-        std::map<std::string, std::string> found_1_0;
-        // solver_id -> invoker
-        std::map<std::string, Invoker> invokers;
+        std::vector<std::pair<std::string, std::string>> found_1_0;
+        // There are only a few solvers per problem, so a linear search is the fastest
+        std::vector<RegisteredInvoker> invokers;
+
+        const Invoker* FindInvoker(const std::string& solver_id) const;
+        const Invoker* FindInvoker(const solver::Id& solver_id) const;
+        const std::string* FindFound1_0(const std::string& algorithm) const;
     };
 
-    // network_config -> Item
-    std::map<std::string, Item> invokers;
+    // Open addressing with linear probing, indexed by the network config hash. Items are never
+    // removed, so an empty slot terminates the search.
+    struct Slot
+    {
+        std::size_t hash = 0;
+        std::unique_ptr<Item> item;
+    };
+
+    mutable std::shared_mutex mutex;
+    std::vector<Slot> slots;
+    std::size_t size = 0;
+
+    /// Returns the slot holding the config or the empty slot where it would be inserted.
+    std::size_t FindSlot(const NetworkConfig& network_config) const;
+    const Item* FindItem(const NetworkConfig& network_config) const;
+    Item* FindItem(const NetworkConfig& network_config);
+    Item& GetOrInsertItem(const NetworkConfig& network_config);
+    void Grow();
 };
 
 } // namespace miopen
@@ -32,6 +32,7 @@
 
 #include <miopen/sqlite_db.hpp>
 #include <miopen/bz2.hpp>
+#include <miopen/compression.hpp>
 #include <miopen/md5.hpp>
 
 #include <boost/core/explicit_operator_bool.hpp>
@@ -64,6 +65,7 @@ struct KernelConfig
            << ",`kernel_blob` BLOB NOT NULL"
            << ",`kernel_hash` TEXT NOT NULL"
            << ",`uncompressed_size` INT NOT NULL"
+           << ",`kernel_codec` INT NOT NULL DEFAULT 0"
            << ");"
            << "CREATE UNIQUE INDEX IF NOT EXISTS "
            << "`idx_" << KernelConfig::table_name() << "` "
@@ -83,6 +85,38 @@ class KernDb : public SQLiteBase<KernDb>
 {
     std::function<std::vector<char>(const std::vector<char>&, bool*)> compress_fn;
     std::function<std::vector<char>(const std::vector<char>&, unsigned int)> decompress_fn;
+    /// bzip2 and zstd verify the checksum of the decompressed data, so hashing it again is
+    /// redundant unless a custom codec is used or the full check is forced.
+    bool verify_md5 = true;
+    /// Codec of the new records. bzip2 goes through compress_fn and decompress_fn.
+    CompressionCodec codec = CompressionCodec::Bzip2;
+    /// Databases written before the codec was recorded hold only bzip2 records.
+    bool has_codec_column = false;
+
+    std::vector<char> UnpackBlob(std::vector<char> blob,
+                                 const std::string& md5_hash,
+                                 int64_t uncompressed_size,
+                                 CompressionCodec blob_codec) const;
+
+    std::vector<char> PackBlob(const std::vector<char>& blob, bool* compressed) const
+    {
+        return codec == CompressionCodec::Bzip2 ? compress_fn(blob, compressed)
+                                                : Compress(codec, blob, compressed);
+    }
+
+    std::string InsertQuery() const
+    {
+        return "INSERT OR REPLACE INTO " + KernelConfig::table_name() +
+               "(kernel_name, kernel_args, kernel_blob, kernel_hash, uncompressed_size" +
+               (has_codec_column ? ", kernel_codec) VALUES(?, ?, ?, ?, ?, ?);"
+                                 : ") VALUES(?, ?, ?, ?, ?);");
+    }
+
+    std::string SelectColumns() const
+    {
+        return has_codec_column ? "kernel_blob, kernel_hash, uncompressed_size, kernel_codec"
+                                : "kernel_blob, kernel_hash, uncompressed_size";
+    }
 
 public:
     MIOPEN_INTERNALS_EXPORT KernDb(DbKinds db_kind, const fs::path& filename_, bool is_system);
@@ -119,27 +153,18 @@ public:
         if(filename.empty())
             return boost::none;
         // Where clause with inserted values defeats the purpose of a prepraed statement
-        auto select_query = "SELECT kernel_blob, kernel_hash, uncompressed_size FROM " +
-                            T::table_name() + " WHERE " + problem_config.Where() + ";";
+        auto select_query = "SELECT " + SelectColumns() + " FROM " + T::table_name() +
+                            " WHERE " + problem_config.Where() + ";";
         auto stmt = SQLite::Statement{sql, select_query};
         // only one result field
         // assert one row
         auto rc = stmt.Step(sql);
         if(rc == SQLITE_ROW)
-        {
-            auto compressed_blob                 = stmt.ColumnBlob(0);
-            auto md5_hash                        = stmt.ColumnText(1);
-            auto uncompressed_size               = stmt.ColumnInt64(2);
-            std::vector<char>& decompressed_blob = compressed_blob;
-            if(uncompressed_size != 0)
-            {
-                decompressed_blob = decompress_fn(compressed_blob, uncompressed_size);
-            }
-            auto new_md5 = md5(decompressed_blob);
-            if(new_md5 != md5_hash)
-                MIOPEN_THROW(miopenStatusInternalError, "Possible database corruption");
-            return decompressed_blob;
-        }
+            return UnpackBlob(stmt.ColumnBlob(0),
+                              stmt.ColumnText(1),
+                              stmt.ColumnInt64(2),
+                              has_codec_column ? static_cast<CompressionCodec>(stmt.ColumnInt64(3))
+                                               : CompressionCodec::Bzip2);
         else if(rc == SQLITE_DONE)
         {
             return boost::none;
@@ -151,18 +176,44 @@ public:
         return boost::none;
     }
 
+    /// Looks up a batch of kernels with a few queries and unpacks the found binaries in
+    /// parallel. Returns an entry per config, in the same order. Records that fail to unpack
+    /// are logged and reported as missing.
+    MIOPEN_INTERNALS_EXPORT std::vector<boost::optional<std::vector<char>>>
+    FindRecordsUnsafe(const std::vector<KernelConfig>& configs);
+
+    std::vector<boost::optional<std::vector<char>>>
+    FindRecords(const std::vector<KernelConfig>& configs)
+    {
+        if(!is_system && DisableUserDbFileIO)
+            return std::vector<boost::optional<std::vector<char>>>(configs.size());
+        return FindRecordsUnsafe(configs);
+    }
+
+    CompressionCodec GetCodec() const { return codec; }
+
+    /// Compresses the kernels in parallel and stores them in a single transaction. Offline
+    /// builders may pass the hashes of the sources each kernel was built from, one per config,
+    /// which are kept in a side table and returned by FindSourceHashesUnsafe.
+    MIOPEN_INTERNALS_EXPORT void
+    StoreRecordsUnsafe(const std::vector<KernelConfig>& configs,
+                       const std::vector<std::string>& source_hashes = {});
+
+    /// Returns the source hash stored along with each config, or an empty string for the
+    /// kernels which are missing or were stored without one.
+    MIOPEN_INTERNALS_EXPORT std::vector<std::string>
+    FindSourceHashesUnsafe(const std::vector<KernelConfig>& configs);
+
     template <typename T>
     bool StoreRecordUnsafe(const T& problem_config)
     {
         if(filename.empty())
             return false;
-        auto insert_query = "INSERT OR REPLACE INTO " + T::table_name() +
-                            "(kernel_name, kernel_args, kernel_blob, kernel_hash, "
-                            "uncompressed_size) VALUES(?, ?, ?, ?, ?);";
+        auto insert_query      = InsertQuery();
         auto md5_sum           = md5(problem_config.kernel_blob);
         auto uncompressed_size = problem_config.kernel_blob.size();
         bool success           = false;
-        auto compressed_blob   = compress_fn(problem_config.kernel_blob, &success);
+        auto compressed_blob   = PackBlob(problem_config.kernel_blob, &success);
         auto stmt              = SQLite::Statement{sql, insert_query};
         stmt.BindPath(1, problem_config.kernel_name);
         stmt.BindText(2, problem_config.kernel_args);
@@ -177,6 +228,8 @@ public:
             stmt.BindInt64(5, uncompressed_size);
         }
         stmt.BindText(4, md5_sum);
+        if(has_codec_column)
+            stmt.BindInt64(6, static_cast<int64_t>(codec));
 
         auto rc = stmt.Step(sql);
         if(rc != SQLITE_DONE)
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_KERN_DB_BUILDER_HPP_
+#define GUARD_MIOPEN_KERN_DB_BUILDER_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/target_properties.hpp>
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+struct Problem;
+
+/// Populates a kernel database offline. The kernels are enumerated from the problems without
+/// running them, so a HIPNOGPU build is enough, and compiled in parallel. Kernels which are in
+/// the database already and were built from the same sources are skipped.
+class MIOPEN_INTERNALS_EXPORT KernDbBuilder
+{
+public:
+    struct Stats
+    {
+        std::size_t kernels = 0;
+        /// Kernels present in the database with matching sources
+        std::size_t skipped = 0;
+        std::size_t built   = 0;
+        std::size_t failed  = 0;
+        double build_s      = 0.0;
+        double store_s      = 0.0;
+    };
+
+    KernDbBuilder(Handle& handle_, fs::path database_);
+
+    /// Adds the kernels of every applicable solver of each problem. Tunable solvers use the
+    /// configs from the perf-db of the handle, or their defaults. Only convolution problems are
+    /// supported, the others are skipped.
+    void AddProblems(const std::vector<Problem>& problems);
+
+    /// Adds a kernel by its build parameters without the target options.
+    void AddKernel(const fs::path& program, const std::string& params);
+
+    const std::vector<std::pair<fs::path, std::string>>& GetKernels() const { return kernels; }
+
+    /// Builds the kernels up to jobs at a time and stores them batch_size at a time, each batch
+    /// in a single transaction. With force set the kernels are rebuilt even when present.
+    Stats Build(std::size_t jobs, std::size_t batch_size, bool force = false) const;
+
+    /// Identifies what a kernel is built from: the library version, the HIP version, the compiler
+    /// and its flags from the build, the build arguments of the kernel with the target options,
+    /// the kernel source and the embedded include files.
+    static std::string GetSourceHash(const fs::path& program, const std::string& build_args);
+
+private:
+    Handle& handle;
+    TargetProperties target;
+    fs::path database;
+    std::vector<std::pair<fs::path, std::string>> kernels;
+    std::set<std::pair<std::string, std::string>> known;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_KERN_DB_BUILDER_HPP_
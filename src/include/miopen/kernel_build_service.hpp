@@ -0,0 +1,141 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_KERNEL_BUILD_SERVICE_HPP_
+#define GUARD_MIOPEN_KERNEL_BUILD_SERVICE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/kernel.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace miopen {
+
+/// Result of a queued program build. Unlike std::shared_future, get() runs the build on the
+/// calling thread if no worker has started it yet, so waiting from a ThreadPool worker can not
+/// starve the build it waits for.
+class MIOPEN_INTERNALS_EXPORT KernelBuildFuture
+{
+public:
+    KernelBuildFuture() = default;
+
+    bool valid() const { return request != nullptr; }
+    bool is_ready() const;
+    Program get() const;
+
+private:
+    friend class KernelBuildService;
+    struct Request;
+
+    explicit KernelBuildFuture(std::shared_ptr<Request> request_) : request(std::move(request_))
+    {
+    }
+
+    std::shared_ptr<Request> request;
+};
+
+/// Process-wide front-end for program builds. Requests for the same (target, program, options,
+/// source) are served by a single build while it is queued or running, wherever they come from:
+/// immediate mode, PrecompileKernels(), tuning or background precompilation. Queued builds run
+/// on the shared ThreadPool, at most MIOPEN_COMPILE_PARALLEL_LEVEL at a time.
+///
+/// Finished programs are not kept here; the ProgramCache of the handle keeps those.
+class MIOPEN_INTERNALS_EXPORT KernelBuildService
+{
+public:
+    using BuildFn = std::function<Program()>;
+
+    struct Stats
+    {
+        /// Calls of Build() and Submit()
+        std::size_t requests = 0;
+        /// Requests that joined a build which was queued or running already
+        std::size_t deduplicated = 0;
+        /// Builds that have been run, including those that have failed
+        std::size_t builds = 0;
+        std::size_t failed = 0;
+        /// Time spent in the builds, which includes loading binaries from the kernel cache
+        double total_ms = 0.0;
+        double max_ms   = 0.0;
+    };
+
+    static KernelBuildService& Get();
+
+    explicit KernelBuildService(std::size_t max_parallel_);
+    ~KernelBuildService();
+
+    KernelBuildService(const KernelBuildService&) = delete;
+    KernelBuildService& operator=(const KernelBuildService&) = delete;
+
+    /// Identifies a build. The target has to tell apart devices whose programs can't be shared.
+    static std::string MakeKey(const std::string& target,
+                               const fs::path& program,
+                               const std::string& options,
+                               const std::string& source,
+                               bool attach_binary);
+
+    /// Queues the build unless the same build is queued or running already. Whatever the build
+    /// refers to must stay alive until it is done.
+    KernelBuildFuture Submit(const std::string& key, BuildFn build);
+
+    /// Joins the same build if it is queued or running, otherwise runs it on the calling thread.
+    Program Build(const std::string& key, const BuildFn& build);
+
+    /// Waits for all queued and running builds.
+    void WaitAll();
+
+    Stats GetStats() const;
+
+private:
+    using Request = KernelBuildFuture::Request;
+
+    const std::size_t max_parallel;
+
+    mutable std::mutex mutex;
+    std::condition_variable idle;
+    std::unordered_map<std::string, std::shared_ptr<Request>> in_flight;
+    std::deque<std::shared_ptr<Request>> queue;
+    std::size_t workers = 0;
+    Stats stats;
+
+    std::shared_ptr<Request> Join(const std::string& key, BuildFn build, bool& joined);
+    void Run(const std::shared_ptr<Request>& request);
+    void Work();
+
+    friend class KernelBuildFuture;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_KERNEL_BUILD_SERVICE_HPP_
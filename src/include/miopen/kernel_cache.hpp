@@ -46,6 +46,13 @@
 #include <miopen/kernel.hpp>
 #include <miopen/simple_hash.hpp>
 #include <miopen/miopen.h>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -53,6 +60,54 @@
 
 namespace miopen {
 
+/**
+ * @brief The ProgramCache class Process-wide cache of programs shared by the handles of a device
+ *
+ * Lookups take a shared lock on one of several shards. Concurrent requests for a program that is
+ * not cached yet wait for a single build instead of building it more than once.
+ */
+class MIOPEN_INTERNALS_EXPORT ProgramCache
+{
+public:
+    using Key = std::pair<fs::path, std::string>;
+
+    /// Returns the cache shared by all users of the same device, which lives as long as any of
+    /// them does.
+    static std::shared_ptr<ProgramCache> GetShared(const std::string& device);
+
+    /// Waits if the program is being built. Returns nothing if it isn't cached or has failed to
+    /// build.
+    std::optional<Program> Find(const Key& key) const;
+    bool Contains(const Key& key) const;
+
+    /// Calls build() unless the program is cached or is being built by another thread. Build
+    /// errors are rethrown to every waiting thread and the failed program is not cached.
+    Program GetOrBuild(const Key& key, const std::function<Program()>& build);
+
+    void Add(const Key& key, Program program);
+    void Remove(const Key& key);
+
+private:
+    struct Entry
+    {
+        std::shared_future<Program> program;
+        /// Identifies the GetOrBuild() call that is building the program, 0 for added programs.
+        std::uint64_t build = 0;
+    };
+
+    struct Shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<Key, Entry, SimpleHash> programs;
+        std::uint64_t last_build = 0;
+    };
+
+    std::array<Shard, 16> shards;
+
+    Shard& GetShard(const Key& key);
+    const Shard& GetShard(const Key& key) const;
+};
+
 /**
  * @brief The KernelCache class Build and cache kernels
  *
@@ -61,9 +116,8 @@ class KernelCache
 {
 
 public:
-    using Key        = std::pair<fs::path, std::string>;
-    using KernelMap  = std::unordered_map<Key, std::vector<Kernel>, SimpleHash>;
-    using ProgramMap = std::unordered_map<Key, Program, SimpleHash>;
+    using Key       = std::pair<fs::path, std::string>;
+    using KernelMap = std::unordered_map<Key, std::vector<Kernel>, SimpleHash>;
 
     Kernel AddKernel(const Handle& h,
                      const std::string& algorithm,
@@ -81,19 +135,27 @@ public:
 
     void ClearKernels(const std::string& algorithm, const std::string& network_config);
 
-    const std::vector<Kernel>& GetKernels(const std::string& algorithm,
-                                          const std::string& network_config);
+    /// Returns a copy, since other threads may add or clear kernels of the same key meanwhile.
+    std::vector<Kernel> GetKernels(const std::string& algorithm,
+                                   const std::string& network_config) const;
 
     bool HasProgram(const fs::path& name, const std::string& params) const;
+    /// Programs are shared by the handles of a device, so this drops the program for all of them.
+    /// Kernels created before keep it alive, the others reload it on the next use.
     void ClearProgram(const fs::path& name, const std::string& params);
 
     void AddProgram(Program prog, const fs::path& program_name, std::string params);
 
+    /// Shares programs with other handles of the same device. Programs added before the call
+    /// are dropped.
+    void ShareProgramsWith(const std::string& device);
+
     KernelCache();
 
 private:
+    mutable std::shared_mutex kernel_mutex;
     KernelMap kernel_map;
-    ProgramMap program_map;
+    std::shared_ptr<ProgramCache> programs;
 };
 
 } // namespace miopen
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_KERNEL_INCLUDE_CACHE_HPP
+#define GUARD_MIOPEN_KERNEL_INCLUDE_CACHE_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace miopen {
+
+/// The embedded kernel include files in the form HIPRTC expects them. HIP kernels are compiled
+/// together with all of the includes, so the table is assembled once per process and shared
+/// by all builds instead of being rebuilt for every kernel variant.
+struct KernelIncludeTable
+{
+    std::vector<std::string> names;
+    std::vector<std::string_view> contents;
+    /// Null terminated name and text of each include, in the order of names.
+    std::vector<const char*> name_ptrs;
+    std::vector<const char*> texts;
+};
+
+MIOPEN_INTERNALS_EXPORT const KernelIncludeTable& GetKernelIncludeTable();
+
+/// A directory holding all of the embedded kernel include files, written on the first call and
+/// removed when the process exits. Offline builds pass it via -I rather than writing the
+/// includes into the temporary directory of each build.
+MIOPEN_INTERNALS_EXPORT const fs::path& GetKernelIncludeDir();
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_KERNEL_INCLUDE_CACHE_HPP
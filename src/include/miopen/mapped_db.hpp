@@ -0,0 +1,152 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_MAPPED_DB_HPP_
+#define GUARD_MIOPEN_MAPPED_DB_HPP_
+
+#include <miopen/db_record.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace miopen {
+
+/// Pre-indexed binary image of a read-only text db (system find-db or perf-db).
+///
+/// The image is produced offline from the text file and is mapped into memory as is. Records are
+/// sorted by KEY and their contents are stored already split into ID:VALUES pairs, so a lookup is
+/// a binary search over the index followed by a copy of the matching pairs, with no text parsing.
+/// Since the image is mapped read-only, all processes on a node share the same page cache.
+///
+/// The same image may also be produced at run time as a snapshot: the first process that needs a
+/// db builds it into a shared directory and the others map it. A snapshot is tied to the size and
+/// the mtime of the text file, so it is rebuilt when the text file changes. The contents hash is
+/// computed by Build() only, so processes that map the image never read the text file.
+///
+/// File layout (integers are in the byte order of the host that built the image, offsets are from
+/// the beginning of the file):
+///   Header
+///   Record[record_count]  - sorted by KEY
+///   Item[item_count]      - ID:VALUES pairs, items of each record are contiguous
+///   char[strings_size]    - KEYs, IDs and VALUES referenced by offset and size
+class MIOPEN_INTERNALS_EXPORT MappedDb
+{
+public:
+    static constexpr std::uint32_t Version = 2;
+
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t db_kind;
+        std::uint64_t source_size;
+        std::int64_t source_mtime;
+        std::uint64_t source_hash;
+        std::uint64_t record_count;
+        std::uint64_t item_count;
+        std::uint64_t records_offset;
+        std::uint64_t items_offset;
+        std::uint64_t strings_offset;
+        std::uint64_t strings_size;
+    };
+
+    struct Record
+    {
+        std::uint64_t key_offset;
+        std::uint32_t key_size;
+        std::uint32_t line;
+        std::uint32_t first_item;
+        std::uint32_t item_count;
+    };
+
+    struct Item
+    {
+        std::uint64_t id_offset;
+        std::uint64_t values_offset;
+        std::uint32_t id_size;
+        std::uint32_t values_size;
+    };
+
+    /// Path of the binary image that accompanies a text db.
+    static fs::path GetPath(const fs::path& text_db_path);
+
+    /// Converts the text db into the binary image. Returns false if the input can't be read or
+    /// the output can't be written.
+    static bool Build(DbKinds db_kind, const fs::path& text_db_path, const fs::path& out_path);
+
+    /// Maps the image. Returns nullptr if the file doesn't exist, is malformed, was built for
+    /// another kind of db, or doesn't match the text file it was produced from: the size and the
+    /// mtime must be the same. The text file is not read, installation preserves the mtime. With
+    /// check_source, the text file must exist as well.
+    static std::unique_ptr<MappedDb> Open(DbKinds db_kind,
+                                          const fs::path& path,
+                                          const fs::path& text_db_path,
+                                          bool check_source = false);
+
+    /// Path of the snapshot of a text db in the snapshot directory.
+    static fs::path GetSnapshotPath(const fs::path& snapshot_dir, const fs::path& text_db_path);
+
+    /// Maps the snapshot of the text db, building it first if it is missing or stale. Builds are
+    /// serialized between processes with a lock file. Returns nullptr if the snapshot can't be
+    /// built.
+    static std::unique_ptr<MappedDb>
+    OpenSnapshot(DbKinds db_kind, const fs::path& snapshot_dir, const fs::path& text_db_path);
+
+    boost::optional<DbRecord> FindRecord(std::string_view key) const;
+
+    std::size_t GetSize() const { return header->record_count; }
+    std::string_view GetKey(std::size_t idx) const;
+    int GetLine(std::size_t idx) const { return static_cast<int>(records[idx].line); }
+    DbRecord GetRecord(std::size_t idx) const;
+
+    const fs::path& GetFilePath() const { return path; }
+
+private:
+    fs::path path;
+    boost::interprocess::file_mapping file;
+    boost::interprocess::mapped_region region;
+    const Header* header  = nullptr;
+    const Record* records = nullptr;
+    const Item* items     = nullptr;
+    const char* strings   = nullptr;
+
+    MappedDb(const fs::path& path_) : path(path_) {}
+
+    std::string_view GetString(std::uint64_t offset, std::uint32_t size) const
+    {
+        return {strings + offset, size};
+    }
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_MAPPED_DB_HPP_
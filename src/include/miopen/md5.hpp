@@ -2,11 +2,13 @@
 #define GUARD_MLOPEN_MD5_HPP
 
 #include <miopen/config.hpp>
+#include <cstddef>
 #include <string>
 #include <vector>
 
 namespace miopen {
 
+MIOPEN_INTERNALS_EXPORT std::string md5(const void* data, std::size_t length);
 MIOPEN_INTERNALS_EXPORT std::string md5(const std::string&);
 MIOPEN_INTERNALS_EXPORT std::string md5(const std::vector<char>&);
 
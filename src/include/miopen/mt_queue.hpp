@@ -28,32 +28,76 @@
 
 #include <queue>
 #include <condition_variable>
+#include <cstddef>
 #include <mutex>
 
+/// Multi-producer queue. With a capacity, push blocks while the queue is full, which keeps
+/// producers from running too far ahead of the consumer.
 template <typename T>
 class ThreadSafeQueue
 {
     std::mutex mutex;
     std::condition_variable cond_var;
+    std::condition_variable not_full;
     std::queue<T> queue;
+    std::size_t capacity = 0;
+    bool closed          = false;
 
 public:
-    void push(T&& item)
-    {
+    ThreadSafeQueue() = default;
+    /// Capacity of 0 means unbounded.
+    explicit ThreadSafeQueue(std::size_t capacity_) : capacity(capacity_) {}
 
+    /// Returns false if the queue has been closed. The item is dropped in that case.
+    bool push(T&& item)
+    {
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            queue.push(item);
+            std::unique_lock<std::mutex> lock(mutex);
+            not_full.wait(lock, [&] { return closed || capacity == 0 || queue.size() < capacity; });
+            if(closed)
+                return false;
+            queue.push(std::move(item));
         }
 
         cond_var.notify_one();
+        return true;
     }
+
     T pop()
     {
         std::unique_lock<std::mutex> lock(mutex);
         cond_var.wait(lock, [&] { return !queue.empty(); });
-        T ret = queue.front();
+        T ret = std::move(queue.front());
         queue.pop();
+        lock.unlock();
+
+        not_full.notify_one();
         return ret;
     }
+
+    /// Returns false right away if the queue is empty.
+    bool try_pop(T& item)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(queue.empty())
+                return false;
+            item = std::move(queue.front());
+            queue.pop();
+        }
+
+        not_full.notify_one();
+        return true;
+    }
+
+    /// Makes all pending and future pushes fail. Used by the consumer when it stops early.
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+
+        not_full.notify_all();
+    }
 };
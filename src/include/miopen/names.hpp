@@ -26,19 +26,48 @@
 
 #pragma once
 
+#include <miopen/problem_key.hpp>
+
+#include <cstddef>
+#include <functional>
 #include <string>
+#include <utility>
 
 namespace miopen {
 
+/// Identifies a problem in the in-process caches. Problems which build a ProblemKey skip the
+/// string formatting; the others use a string. A problem type uses one form only, so configs
+/// of different forms never compare equal. Keys are large, so configs refer to interned keys.
 struct NetworkConfig
 {
-    NetworkConfig() = default;
-    explicit NetworkConfig(const std::string& value_) : value(value_) {}
-    operator std::string() const { return value; }
-    const std::string& ToString() const { return value; }
+    NetworkConfig() : NetworkConfig(std::string{}) {}
+    explicit NetworkConfig(std::string value_)
+        : value(std::move(value_)), hash(std::hash<std::string>{}(value))
+    {
+    }
+    explicit NetworkConfig(const ProblemKey& key_)
+        : key(&ProblemKey::Intern(key_)), hash(key_.Hash())
+    {
+    }
+    operator std::string() const { return ToString(); }
+    /// Keys are rendered on demand, which allocates. Meant for logs and string-keyed caches.
+    std::string ToString() const { return key ? key->ToString() : value; }
+    /// Computed once, so that lookups by the config don't have to hash or compare the string.
+    std::size_t Hash() const { return hash; }
+
+    bool operator==(const NetworkConfig& r) const
+    {
+        // Equal keys are interned once, so they are at the same address
+        if(hash != r.hash || key != r.key)
+            return false;
+        return key != nullptr || value == r.value;
+    }
+    bool operator!=(const NetworkConfig& r) const { return !(*this == r); }
 
 private:
     std::string value;
+    const ProblemKey* key = nullptr;
+    std::size_t hash;
 };
 
 struct AlgorithmName
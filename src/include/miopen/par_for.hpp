@@ -27,6 +27,8 @@
 #ifndef MIOPEN_GUARD_MLOPEN_PAR_FOR_HPP
 #define MIOPEN_GUARD_MLOPEN_PAR_FOR_HPP
 
+#include <miopen/thread_pool.hpp>
+
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -38,43 +40,11 @@
 
 namespace miopen {
 
-struct joinable_thread : std::thread
-{
-    template <class... Xs>
-    joinable_thread(Xs&&... xs) : std::thread(std::forward<Xs>(xs)...) // NOLINT
-    {
-    }
-
-    joinable_thread& operator=(joinable_thread&& other) = default;
-    joinable_thread(joinable_thread&& other)            = default;
-
-    ~joinable_thread()
-    {
-        if(this->joinable())
-            this->join();
-    }
-};
-
-struct thread_factory
-{
-    template <class F>
-    joinable_thread operator()(std::size_t& work, std::size_t n, std::size_t grainsize, F f) const
-    {
-        auto result = joinable_thread([=] {
-            std::size_t start = work;
-            std::size_t last  = std::min(n, work + grainsize);
-            for(std::size_t i = start; i < last; i++)
-            {
-                f(i);
-            }
-        });
-        work += grainsize;
-        return result;
-    }
-};
-
+/// Runs the items on the shared ThreadPool. Threads take ranges of consecutive items which shrink
+/// as the work runs out, down to min_chunk items, so that a few expensive items don't leave the
+/// other threads idle.
 template <class F>
-void par_for_impl(std::size_t n, std::size_t threadsize, F f)
+void par_for_impl(std::size_t n, std::size_t threadsize, std::size_t min_chunk, F f)
 {
     if(threadsize <= 1)
     {
@@ -83,14 +53,11 @@ void par_for_impl(std::size_t n, std::size_t threadsize, F f)
     }
     else
     {
-        std::vector<joinable_thread> threads(threadsize);
-        const std::size_t grainsize = std::ceil(static_cast<double>(n) / threads.size());
-
-        std::size_t work = 0;
-        std::generate(threads.begin(),
-                      threads.end(),
-                      std::bind(thread_factory{}, std::ref(work), n, grainsize, f));
-        assert(work >= n);
+        ThreadPool::Get().ParallelForRanges(
+            n, threadsize, min_chunk, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t i = begin; i < end; i++)
+                    f(i);
+            });
     }
 }
 
@@ -99,7 +66,7 @@ void par_for(std::size_t n, std::size_t min_grain, F f)
 {
     const auto threadsize =
         std::min<std::size_t>(std::thread::hardware_concurrency(), n / min_grain);
-    par_for_impl(n, threadsize, f);
+    par_for_impl(n, threadsize, min_grain, f);
 }
 
 struct min_grain
@@ -111,7 +78,7 @@ template <class F>
 void par_for(std::size_t n, min_grain mg, F f)
 {
     const auto threadsize = std::min<std::size_t>(std::thread::hardware_concurrency(), n / mg.n);
-    par_for_impl(n, threadsize, f);
+    par_for_impl(n, threadsize, mg.n, f);
 }
 
 template <class F>
@@ -129,14 +96,15 @@ template <class F>
 void par_for(std::size_t n, max_threads mt, F f)
 {
     const auto threadsize = std::min<std::size_t>(std::thread::hardware_concurrency(), mt.n);
-    par_for_impl(n, std::min(threadsize, n), f);
+    par_for_impl(n, std::min(threadsize, n), 1, f);
 }
 
+/// Every one of the threadsize tasks calls f(i) for i = start, start + threadsize, ... in order.
 template <class F>
 void par_for_strided(std::size_t n, max_threads mt, F f)
 {
     auto threadsize = std::min<std::size_t>(std::thread::hardware_concurrency(), mt.n);
-    par_for_impl(threadsize, threadsize, [&](auto start) {
+    par_for_impl(threadsize, threadsize, 1, [&](auto start) {
         for(std::size_t i = start; i < n; i += threadsize)
         {
             f(i);
@@ -144,6 +112,27 @@ void par_for_strided(std::size_t n, max_threads mt, F f)
     });
 }
 
+/// For many cheap items, like the elements of a tensor. Calls f(begin, end) for ranges of
+/// consecutive items which shrink as the work runs out. Ranges are at least 16 items long unless
+/// there are only a few items, so that threads don't write to the same cache lines.
+template <class F>
+void par_for_ranges(std::size_t n, F f)
+{
+    if(n == 0)
+        return;
+
+    const auto threadsize = std::min<std::size_t>(std::thread::hardware_concurrency(), n);
+    if(threadsize <= 1)
+    {
+        f(std::size_t{0}, n);
+        return;
+    }
+
+    const auto min_chunk = std::clamp<std::size_t>(n / (4 * threadsize), 1, 16);
+    ThreadPool::Get().ParallelForRanges(
+        n, threadsize, min_chunk, [&](std::size_t begin, std::size_t end) { f(begin, end); });
+}
+
 } // namespace miopen
 
 #endif
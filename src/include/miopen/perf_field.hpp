@@ -29,6 +29,7 @@
 #include <miopen/errors.hpp>
 #include <miopen/serializable.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <ostream>
 #include <string>
@@ -50,11 +51,16 @@ struct FindDbData : solver::Serializable<FindDbData>
     float time;
     std::size_t workspace;
     std::string algorithm;
+    /// Standard deviation of the time, 0 when unknown
+    float time_stddev;
 
-    FindDbData() : time(-1), workspace(-1), algorithm("<invalid>") {}
+    FindDbData() : time(-1), workspace(-1), algorithm("<invalid>"), time_stddev(0) {}
 
-    FindDbData(float time_, std::size_t workspace_, const std::string& algorithm_)
-        : time(time_), workspace(workspace_), algorithm(algorithm_)
+    FindDbData(float time_,
+               std::size_t workspace_,
+               const std::string& algorithm_,
+               float time_stddev_ = 0)
+        : time(time_), workspace(workspace_), algorithm(algorithm_), time_stddev(time_stddev_)
     {
     }
 
@@ -64,6 +70,16 @@ struct FindDbData : solver::Serializable<FindDbData>
         f(self.time, "time");
         f(self.workspace, "workspace");
         f(self.algorithm, "algorithm");
+        f(self.time_stddev, "time_stddev");
+    }
+
+    bool Deserialize(const std::string& s)
+    {
+        // Records written before the spread of the time was kept have three fields. Older
+        // versions of the library read the first three fields of the new ones.
+        if(std::count(s.begin(), s.end(), ',') == 2)
+            return Serializable::Deserialize(s + ",0");
+        return Serializable::Deserialize(s);
     }
 
     friend std::ostream& operator<<(std::ostream& os, const FindDbData& obj)
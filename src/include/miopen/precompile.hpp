@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_PRECOMPILE_HPP_
+#define GUARD_MIOPEN_PRECOMPILE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/names.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+struct Problem;
+
+/// Compiles the code of the problems an application is going to solve on background threads, so
+/// that the first calls for these problems don't pay for compilation. Foreground calls wait only
+/// for the problem they need, and only if it is still being compiled.
+class MIOPEN_INTERNALS_EXPORT BackgroundPrecompiler
+{
+public:
+    struct Stats
+    {
+        std::size_t queued    = 0;
+        std::size_t completed = 0;
+        std::size_t failed    = 0;
+        /// Foreground lookups of precompiled problems that were ready. Lookups are counted only
+        /// while some compilation is unfinished.
+        std::size_t hits = 0;
+        /// Foreground lookups of precompiled problems that had to wait for the compilation
+        std::size_t waits = 0;
+        /// Foreground lookups of problems that have not been precompiled
+        std::size_t misses = 0;
+    };
+
+    BackgroundPrecompiler() = default;
+    explicit BackgroundPrecompiler(Handle& owner_) : owner(&owner_) {}
+    BackgroundPrecompiler(const BackgroundPrecompiler&) = delete;
+    BackgroundPrecompiler& operator=(const BackgroundPrecompiler&) = delete;
+    ~BackgroundPrecompiler();
+
+    /// Runs the task on the shared ThreadPool, unless there is a task for this problem already.
+    /// Exceptions thrown by the task are logged and counted as failures.
+    void Submit(const NetworkConfig& problem, std::function<void()> task);
+
+    /// Called before the problem is compiled in the foreground. Waits for the background task of
+    /// the problem if there is one, and returns whether there was one. Doesn't lock, and returns
+    /// false, when all the tasks are done.
+    bool Wait(const NetworkConfig& problem);
+
+    void WaitAll();
+
+    /// The handle the tasks compile for. Tasks get it from here rather than capture it, as it
+    /// changes when the handle is moved.
+    Handle& GetOwner() const;
+    /// Called when the handle is moved, after WaitAll().
+    void SetOwner(Handle& owner_) { owner = &owner_; }
+
+    Stats GetStats() const;
+
+private:
+    struct ConfigHash
+    {
+        std::size_t operator()(const NetworkConfig& config) const { return config.Hash(); }
+    };
+
+    Handle* owner = nullptr;
+    // Keeps the foreground lookups free of locking while nothing is being compiled
+    std::atomic<std::size_t> unfinished{0};
+    mutable std::mutex mutex;
+    std::unordered_map<NetworkConfig, std::shared_future<void>, ConfigHash> tasks;
+    Stats stats;
+};
+
+/// Starts background compilation of the best known solution of each problem. Only convolution
+/// problems are supported, the others are skipped.
+MIOPEN_INTERNALS_EXPORT void PrecompileAsync(Handle& handle, const std::vector<Problem>& problems);
+
+/// Starts background compilation of the kernels Find is going to evaluate for the problem. Returns
+/// the key to wait for with BackgroundPrecompiler::Wait() before the problem is searched, or
+/// nothing for the problems other than convolutions, which are not supported.
+MIOPEN_INTERNALS_EXPORT std::optional<NetworkConfig>
+PrecompileFindAsync(Handle& handle, const Problem& problem, bool attach_binaries);
+
+/// Reads the problems from a manifest, which is a JSON array of problems in the same format as
+/// they are stored in serialized solutions.
+MIOPEN_INTERNALS_EXPORT std::vector<Problem> LoadPrecompileManifest(const fs::path& path);
+
+/// Starts background compilation of the problems listed in the manifest set by the
+/// MIOPEN_PRECOMPILE_MANIFEST environment variable, if any. Runs once per process for each
+/// device, which is any string identifying where the compiled programs can be used.
+void PrecompileFromManifest(Handle& handle, const std::string& device);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PRECOMPILE_HPP_
@@ -266,6 +266,20 @@ struct ProblemContainer : miopenProblem
     friend void from_json(const nlohmann::json& j, ProblemContainer& problem);
 };
 
+/// Returns the index of the first problem identical to each of the problems.
+MIOPEN_INTERNALS_EXPORT std::vector<std::size_t>
+GetFirstIdenticalProblems(const std::vector<ProblemContainer::Item>& problems);
+
+/// Finds the solutions of several problems, e.g. of all the layers of a network, at once.
+/// Identical problems are searched once. The kernels of the convolution problems are compiled on
+/// background threads, so that the device evaluates a problem while the kernels of the following
+/// ones are being built. Returns the solutions of each problem, in the same order.
+MIOPEN_INTERNALS_EXPORT std::vector<std::vector<Solution>>
+FindSolutionsBatch(Handle& handle,
+                   const std::vector<ProblemContainer::Item>& problems,
+                   const FindOptions& options,
+                   std::size_t max_solutions);
+
 } // namespace miopen
 
 inline std::ostream& operator<<(std::ostream& stream, const miopen::Problem& problem)
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_PROBLEM_KEY_HPP_
+#define GUARD_MIOPEN_PROBLEM_KEY_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace miopen {
+
+/// Compact binary identity of a problem for the in-process caches. Fields are appended as
+/// 64-bit words and hashed as they go, so a key is built without heap allocations and hashed
+/// without a second pass. Keys are trivially copyable and compared with memcmp.
+///
+/// The string form is only meant for logs. On-disk databases keep using the serialized
+/// problem descriptions.
+class MIOPEN_INTERNALS_EXPORT ProblemKey
+{
+public:
+    static constexpr std::size_t capacity = 96;
+
+    /// The kind tells apart keys of different primitives which happen to have the same fields.
+    explicit ProblemKey(std::string_view kind) { AddString(kind); }
+
+    template <class T>
+    ProblemKey& Add(T value)
+    {
+        if constexpr(std::is_enum<T>{})
+        {
+            return Add(static_cast<std::underlying_type_t<T>>(value));
+        }
+        else if constexpr(std::is_floating_point<T>{})
+        {
+            const auto as_double = static_cast<double>(value);
+            auto word            = std::uint64_t{};
+            std::memcpy(&word, &as_double, sizeof(word));
+            SetBit(floats, size);
+            return AddWord(word);
+        }
+        else
+        {
+            static_assert(std::is_integral<T>{}, "Unsupported problem key field");
+            return AddWord(static_cast<std::uint64_t>(value));
+        }
+    }
+
+    /// Adds whether there is a value followed by the value.
+    template <class T>
+    ProblemKey& AddOptional(const std::optional<T>& value)
+    {
+        Add(value.has_value());
+        return value ? Add(*value) : *this;
+    }
+
+    /// Adds the number of elements followed by the elements.
+    template <class T>
+    ProblemKey& AddRange(const std::vector<T>& values)
+    {
+        Add(values.size());
+        for(const auto& value : values)
+            Add(value);
+        return *this;
+    }
+
+    /// Short strings such as layouts and data type names are stored as text.
+    ProblemKey& AddString(std::string_view str)
+    {
+        SetBit(strings, size);
+        AddWord(str.size());
+        for(std::size_t i = 0; i < str.size(); i += sizeof(std::uint64_t))
+        {
+            auto word = std::uint64_t{};
+            std::memcpy(&word, str.data() + i, std::min(sizeof(word), str.size() - i));
+            AddWord(word);
+        }
+        return *this;
+    }
+
+    std::uint64_t Hash() const
+    {
+        // Final avalanche of MurmurHash3
+        auto h = state ^ size;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    /// Renders the fields as "kind:field0xfield1x...".
+    std::string ToString() const
+    {
+        auto ret = std::string{};
+        for(std::size_t i = 0; i < size;)
+        {
+            if(i == 1 + (words[0] + 7) / 8)
+                ret += ':';
+            else if(i != 0)
+                ret += 'x';
+
+            if(GetBit(strings, i))
+            {
+                const auto length = words[i++];
+                ret.append(reinterpret_cast<const char*>(&words[i]), length);
+                i += (length + 7) / 8;
+            }
+            else if(GetBit(floats, i))
+            {
+                auto value = 0.0;
+                std::memcpy(&value, &words[i++], sizeof(value));
+                ret += std::to_string(value);
+            }
+            else
+            {
+                ret += std::to_string(static_cast<std::int64_t>(words[i++]));
+            }
+        }
+        return ret;
+    }
+
+    /// Returns the process-wide copy of the key. Only the first request for a key allocates, so
+    /// that configs can refer to keys without owning them.
+    static const ProblemKey& Intern(const ProblemKey& key);
+
+    friend bool operator==(const ProblemKey& l, const ProblemKey& r)
+    {
+        return l.size == r.size && l.strings == r.strings && l.floats == r.floats &&
+               std::memcmp(l.words.data(), r.words.data(), l.size * sizeof(std::uint64_t)) == 0;
+    }
+    friend bool operator!=(const ProblemKey& l, const ProblemKey& r) { return !(l == r); }
+
+private:
+    std::array<std::uint64_t, capacity> words{};
+    std::size_t size = 0;
+    /// Words which start a string or hold a floating point value, one bit per word
+    using Mask = std::array<std::uint64_t, (capacity + 63) / 64>;
+    Mask strings{};
+    Mask floats{};
+    std::uint64_t state = 0;
+
+    static void SetBit(Mask& mask, std::size_t idx)
+    {
+        if(idx < capacity)
+            mask[idx / 64] |= std::uint64_t{1} << (idx % 64);
+    }
+
+    static bool GetBit(const Mask& mask, std::size_t idx)
+    {
+        return ((mask[idx / 64] >> (idx % 64)) & 1) != 0;
+    }
+
+    ProblemKey& AddWord(std::uint64_t word)
+    {
+        if(size == capacity)
+            MIOPEN_THROW(miopenStatusInternalError, "Too many fields in a problem key");
+        words[size++] = word;
+
+        // Mixing step of MurmurHash3 x64
+        word *= 0x87c37b91114253d5ULL;
+        word = (word << 31) | (word >> 33);
+        word *= 0x4cf5ad432745937fULL;
+        state ^= word;
+        state = ((state << 27) | (state >> 37)) * 5 + 0x52dce729;
+        return *this;
+    }
+};
+
+static_assert(std::is_trivially_copyable<ProblemKey>{}, "ProblemKey must be trivially copyable");
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PROBLEM_KEY_HPP_
@@ -58,6 +58,7 @@ public:
     }
 
     RamDb(DbKinds db_kind_, const fs::path& path, bool is_system = false);
+    ~RamDb();
 
     RamDb(const RamDb&) = delete;
     RamDb(RamDb&&)      = delete;
@@ -99,6 +100,24 @@ public:
     bool RemoveRecord(const std::string& key);
     bool Remove(const std::string& key, const std::string& id);
 
+    /// Enables batched writes: stores and updates are applied to the cache and journaled in
+    /// memory, then written to the file in a single rewrite once max_records are pending, on
+    /// Flush() and on destruction. max_delay is checked on accesses to the db, so an idle db
+    /// keeps an overdue batch until it is used again or flushed. The file is replaced by rename,
+    /// so other processes never read a partially written file, and a process crash loses only
+    /// the pending batch. The file isn't synced to disk, so a system crash may lose more.
+    /// Stores and updates return false when the batch was due and could not be written, the
+    /// records are kept pending in that case. max_records == 0 restores the write-through
+    /// behavior.
+    void SetWriteBatch(std::size_t max_records, std::chrono::milliseconds max_delay);
+
+    /// Writes all pending records to the file. Returns false if writing has failed, pending
+    /// records are kept in that case.
+    bool Flush();
+
+    /// Flushes all cached instances. Returns immediately when no instance has pending records.
+    static void FlushAll();
+
     template <class T>
     inline bool Remove(const T& problem_config, const std::string& id)
     {
@@ -133,14 +152,33 @@ private:
         std::string content;
     };
 
+    struct PendingRecord
+    {
+        DbRecord record;
+        /// Merge with the record from the file instead of replacing it.
+        bool merge;
+    };
+
     ramdb_clock::time_point file_read_time;
     std::map<std::string, CacheItem> cache;
 
+    std::size_t write_batch_size = 0;
+    std::chrono::milliseconds write_batch_delay{0};
+    ramdb_clock::time_point first_pending_time;
+    std::map<std::string, PendingRecord> pending;
+
     boost::optional<miopen::DbRecord> FindRecordUnsafe(const std::string& problem);
 
     bool ValidateUnsafe();
     void Prefetch();
 
+    bool IsBatchingWrites() const { return !DisableUserDbFileIO && write_batch_size > 0; }
+    void SetCacheEntryUnsafe(const DbRecord& record);
+    bool IsBatchDueUnsafe() const;
+    bool AddPendingUnsafe(const DbRecord& record, bool merge);
+    void ApplyPendingUnsafe();
+    bool WriteBatchUnsafe();
+
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
     void UpdateCacheEntryUnsafe(const DbRecord& record);
 #endif
@@ -28,9 +28,12 @@
 
 #include <miopen/db_record.hpp>
 #include <miopen/filesystem.hpp>
+#include <miopen/mapped_db.hpp>
 
 #include <boost/optional.hpp>
 
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <string>
 #include <sstream>
@@ -51,6 +54,9 @@ public:
 
     boost::optional<DbRecord> FindRecord(const std::string& problem) const
     {
+        if(mapped)
+            return mapped->FindRecord(problem);
+
         MIOPEN_LOG_I2("Looking for key " << problem << " in file " << db_path);
         const auto it = cache.find(problem);
 
@@ -95,17 +101,23 @@ public:
         std::string content;
     };
 
-    const std::unordered_map<std::string, CacheItem>& GetCacheMap() const { return cache; }
+    /// When the db has been loaded from the binary index, the map is rebuilt from it on the first
+    /// call. This is intended for tools and tests only.
+    const std::unordered_map<std::string, CacheItem>& GetCacheMap() const;
+
+    bool IsMapped() const { return mapped != nullptr; }
 
 private:
     DbKinds db_kind;
     fs::path db_path;
-    std::unordered_map<std::string, CacheItem> cache;
-
-    ReadonlyRamDb(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb(ReadonlyRamDb&&)      = default;
-    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = default;
+    mutable std::unordered_map<std::string, CacheItem> cache;
+    std::unique_ptr<MappedDb> mapped;
+    mutable std::once_flag cache_from_mapped;
+
+    ReadonlyRamDb(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb(ReadonlyRamDb&&)      = delete;
+    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = delete;
 
     void Prefetch(bool warn_if_unreadable);
     void ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable);
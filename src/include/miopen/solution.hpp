@@ -101,6 +101,9 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
 
     float GetTime() const { return time; }
     void SetTime(float value) { time = value; }
+    /// Standard deviation of the samples the time was estimated from, 0 when unknown
+    float GetTimeStdDev() const { return time_stddev; }
+    void SetTimeStdDev(float value) { time_stddev = value; }
     std::size_t GetWorkspaceSize() const { return workspace_required; }
     void SetWorkspaceSize(std::size_t value) { workspace_required = value; }
     const solver::Id& GetSolver() const { return solver; }
@@ -150,6 +153,7 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
 
 private:
     float time                     = 0;
+    float time_stddev              = 0;
     std::size_t workspace_required = 0;
     solver::Id solver;
     ProblemContainer problem;
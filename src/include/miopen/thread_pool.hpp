@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_THREAD_POOL_HPP_
+#define GUARD_MIOPEN_THREAD_POOL_HPP_
+
+#include <miopen/config.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace miopen {
+
+/// Process-wide pool of worker threads. Every worker has its own task queue and steals from the
+/// others when it runs out of work.
+class MIOPEN_INTERNALS_EXPORT ThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    /// The shared pool is created on first use. Its size is MIOPEN_THREAD_POOL_SIZE, or the
+    /// number of hardware threads if that is not set.
+    static ThreadPool& Get();
+
+    explicit ThreadPool(std::size_t threads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t Size() const { return workers.size(); }
+
+    /// Queues the task to the current worker when called from one, otherwise spreads tasks over
+    /// all workers. Workers take the tasks of every queue in FIFO order, so that the ones queued
+    /// first, e.g. the background compilation of the first layers of a network, are done first.
+    void Post(Task task);
+
+    template <class F>
+    auto Submit(F&& f) -> std::future<std::invoke_result_t<F>>
+    {
+        using Result = std::invoke_result_t<F>;
+        auto task    = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+        auto future  = task->get_future();
+        Post([task]() { (*task)(); });
+        return future;
+    }
+
+    /// Calls f(i) for every i in [0, n) using the calling thread and up to parallelism - 1 pool
+    /// workers. Indices are handed out one at a time, so slow items don't hold up the others.
+    /// Returns when all calls have completed and rethrows the first exception thrown by f.
+    void ParallelFor(std::size_t n,
+                     std::size_t parallelism,
+                     const std::function<void(std::size_t)>& f);
+
+    /// For many cheap items. Calls f(begin, end) for ranges covering [0, n). Ranges start large
+    /// and shrink as the work runs out, down to min_chunk items, so that the per-range overhead
+    /// stays small and the threads still finish at about the same time.
+    void ParallelForRanges(std::size_t n,
+                           std::size_t parallelism,
+                           std::size_t min_chunk,
+                           const std::function<void(std::size_t, std::size_t)>& f);
+
+private:
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::size_t pending = 0;
+    bool stop           = false;
+    std::atomic<std::size_t> next{0};
+
+    void Work(std::size_t idx);
+    bool TryPop(std::size_t idx, Task& task);
+    void ParallelForImpl(std::size_t n,
+                         std::size_t parallelism,
+                         std::size_t min_chunk,
+                         bool guided,
+                         const std::function<void(std::size_t, std::size_t)>& f);
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_THREAD_POOL_HPP_
@@ -27,116 +27,248 @@
 #include <miopen/invoker_cache.hpp>
 #include <miopen/logger.hpp>
 
+#include <algorithm>
+#include <mutex>
+
 namespace miopen {
 
-std::optional<Invoker> InvokerCache::operator[](const Key& key) const
+InvokerCache::InvokerCache(InvokerCache&& other) noexcept
+{
+    const std::unique_lock<std::shared_mutex> lock{other.mutex};
+    slots = std::move(other.slots);
+    size  = std::exchange(other.size, 0);
+}
+
+InvokerCache& InvokerCache::operator=(InvokerCache&& other) noexcept
+{
+    if(this != &other)
+    {
+        const std::scoped_lock lock{mutex, other.mutex};
+        slots = std::move(other.slots);
+        size  = std::exchange(other.size, 0);
+    }
+    return *this;
+}
+
+const Invoker* InvokerCache::Item::FindInvoker(const std::string& solver_id) const
+{
+    for(const auto& invoker : invokers)
+    {
+        if(invoker.solver_id == solver_id)
+            return &invoker.invoker;
+    }
+    return nullptr;
+}
+
+const Invoker* InvokerCache::Item::FindInvoker(const solver::Id& solver_id) const
+{
+    if(!solver_id.IsValid())
+        return nullptr;
+    for(const auto& invoker : invokers)
+    {
+        if(invoker.solver_value == solver_id.Value())
+            return &invoker.invoker;
+    }
+    return nullptr;
+}
+
+const std::string* InvokerCache::Item::FindFound1_0(const std::string& algorithm) const
+{
+    for(const auto& found : found_1_0)
+    {
+        if(found.first == algorithm)
+            return &found.second;
+    }
+    return nullptr;
+}
+
+std::size_t InvokerCache::FindSlot(const NetworkConfig& network_config) const
+{
+    const auto mask = slots.size() - 1;
+    auto i          = network_config.Hash() & mask;
+    while(slots[i].item && !(slots[i].hash == network_config.Hash() &&
+                             slots[i].item->network_config == network_config))
+        i = (i + 1) & mask;
+    return i;
+}
+
+const InvokerCache::Item* InvokerCache::FindItem(const NetworkConfig& network_config) const
 {
-    const auto item = invokers.find(key.first);
-    if(item == invokers.end())
+    if(slots.empty())
+        return nullptr;
+    return slots[FindSlot(network_config)].item.get();
+}
+
+InvokerCache::Item* InvokerCache::FindItem(const NetworkConfig& network_config)
+{
+    if(slots.empty())
+        return nullptr;
+    return slots[FindSlot(network_config)].item.get();
+}
+
+void InvokerCache::Grow()
+{
+    auto old_slots  = std::move(slots);
+    slots           = std::vector<Slot>(old_slots.empty() ? 64 : old_slots.size() * 2);
+    const auto mask = slots.size() - 1;
+
+    for(auto& old_slot : old_slots)
+    {
+        if(!old_slot.item)
+            continue;
+        auto i = old_slot.hash & mask;
+        while(slots[i].item)
+            i = (i + 1) & mask;
+        slots[i] = std::move(old_slot);
+    }
+}
+
+InvokerCache::Item& InvokerCache::GetOrInsertItem(const NetworkConfig& network_config)
+{
+    if(const auto item = FindItem(network_config))
+        return *item;
+
+    // Keeping the load factor at most 1/2 keeps the probe sequences short
+    if(2 * (size + 1) > slots.size())
+        Grow();
+
+    auto& slot                = slots[FindSlot(network_config)];
+    slot.hash                 = network_config.Hash();
+    slot.item                 = std::make_unique<Item>();
+    slot.item->network_config = network_config;
+    ++size;
+    return *slot.item;
+}
+
+std::optional<Invoker> InvokerCache::Find(const NetworkConfig& network_config,
+                                          const std::string& solver_id) const
+{
+    const std::shared_lock<std::shared_mutex> lock{mutex};
+    const auto item = FindItem(network_config);
+    if(item == nullptr)
         return std::nullopt;
-    const auto& item_invokers = item->second.invokers;
-    const auto invoker        = item_invokers.find(key.second);
-    if(invoker == item_invokers.end())
+    const auto invoker = item->FindInvoker(solver_id);
+    if(invoker == nullptr)
         return std::nullopt;
-    return invoker->second;
+    return *invoker;
 }
 
-std::optional<Invoker> InvokerCache::GetFound1_0(const std::string& network_config,
+std::optional<Invoker> InvokerCache::FindById(const NetworkConfig& network_config,
+                                              const solver::Id& solver_id) const
+{
+    const std::shared_lock<std::shared_mutex> lock{mutex};
+    const auto item = FindItem(network_config);
+    if(item == nullptr)
+        return std::nullopt;
+    const auto invoker = item->FindInvoker(solver_id);
+    if(invoker == nullptr)
+        return std::nullopt;
+    return *invoker;
+}
+
+std::optional<Invoker> InvokerCache::GetFound1_0(const NetworkConfig& network_config,
                                                  const std::string& algorithm) const
 {
-    const auto item = invokers.find(network_config);
-    if(item == invokers.end())
+    const std::shared_lock<std::shared_mutex> lock{mutex};
+    const auto item = FindItem(network_config);
+    if(item == nullptr)
     {
-        MIOPEN_LOG_I2("No invokers found for " << network_config);
+        MIOPEN_LOG_I2("No invokers found for " << network_config.ToString());
         return std::nullopt;
     }
-    if(item->second.found_1_0.empty())
+    if(item->found_1_0.empty())
     {
-        MIOPEN_LOG_I2("Invokers found for " << network_config
+        MIOPEN_LOG_I2("Invokers found for " << network_config.ToString()
                                             << " but there is no find 1.0 result.");
         return std::nullopt;
     }
-    const auto& item_invokers = item->second.invokers;
-    const auto& found_1_0_ids = item->second.found_1_0;
-    const auto found_1_0_id   = found_1_0_ids.find(algorithm);
-    if(found_1_0_id == found_1_0_ids.end())
+    const auto found_1_0_id = item->FindFound1_0(algorithm);
+    if(found_1_0_id == nullptr)
     {
-        MIOPEN_LOG_I2("Invokers found for "
-                      << network_config << " but there is no one with an algorithm " << algorithm);
+        MIOPEN_LOG_I2("Invokers found for " << network_config.ToString()
+                                            << " but there is no one with an algorithm "
+                                            << algorithm);
         return std::nullopt;
     }
-    const auto invoker = item_invokers.find(found_1_0_id->second);
-    if(invoker == item_invokers.end())
+    const auto invoker = item->FindInvoker(*found_1_0_id);
+    if(invoker == nullptr)
     {
-        MIOPEN_THROW("No invoker with solver_id of " + found_1_0_id->second +
-                     " was registered for " + network_config);
+        MIOPEN_THROW("No invoker with solver_id of " + *found_1_0_id + " was registered for " +
+                     network_config.ToString());
     }
-    return invoker->second;
+    return *invoker;
 }
 
-std::optional<std::string> InvokerCache::GetFound1_0SolverId(const std::string& network_config,
+std::optional<std::string> InvokerCache::GetFound1_0SolverId(const NetworkConfig& network_config,
                                                              const std::string& algorithm) const
 {
-    const auto item = invokers.find(network_config);
-    if(item == invokers.end())
+    const std::shared_lock<std::shared_mutex> lock{mutex};
+    const auto item = FindItem(network_config);
+    if(item == nullptr)
     {
-        MIOPEN_LOG_I2("No invokers found for " << network_config);
+        MIOPEN_LOG_I2("No invokers found for " << network_config.ToString());
         return std::nullopt;
     }
-    if(item->second.found_1_0.empty())
+    if(item->found_1_0.empty())
     {
-        MIOPEN_LOG_I2("Invokers found for " << network_config
+        MIOPEN_LOG_I2("Invokers found for " << network_config.ToString()
                                             << " but there is no find 1.0 result.");
         return std::nullopt;
     }
-    const auto& found_1_0_ids = item->second.found_1_0;
-    const auto found_1_0_id   = found_1_0_ids.find(algorithm);
-    if(found_1_0_id == found_1_0_ids.end())
+    const auto found_1_0_id = item->FindFound1_0(algorithm);
+    if(found_1_0_id == nullptr)
     {
-        MIOPEN_LOG_I2("Invokers found for "
-                      << network_config << " but there is no one with an algorithm " << algorithm);
+        MIOPEN_LOG_I2("Invokers found for " << network_config.ToString()
+                                            << " but there is no one with an algorithm "
+                                            << algorithm);
         return std::nullopt;
     }
-    return found_1_0_id->second;
+    return *found_1_0_id;
 }
 
-void InvokerCache::Register(const Key& key, const Invoker& invoker)
+void InvokerCache::Register(const NetworkConfig& network_config,
+                            const std::string& solver_id,
+                            const Invoker& invoker)
 {
-    auto it = invokers.find(key.first);
-    if(it != invokers.end())
-    {
-        it->second.invokers.insert({key.second, invoker});
-    }
-    else
+    const std::unique_lock<std::shared_mutex> lock{mutex};
+    auto& item = GetOrInsertItem(network_config);
+    // The first registered invoker wins, as with std::map::insert
+    if(item.FindInvoker(solver_id) == nullptr)
     {
-        auto& item = invokers.insert({key.first, Item{}}).first->second;
-        item.invokers.insert({key.second, invoker});
+        const auto id = solver::Id{solver_id};
+        item.invokers.push_back({solver_id, id.IsValid() ? id.Value() : 0, invoker});
     }
-    MIOPEN_LOG_I2("Invoker registered for algorithm " << key.first << " and solver " << key.second);
+    MIOPEN_LOG_I2("Invoker registered for algorithm " << network_config.ToString()
+                                                      << " and solver " << solver_id);
 }
 
-void InvokerCache::SetAsFound1_0(const std::string& network_config,
+void InvokerCache::SetAsFound1_0(const NetworkConfig& network_config,
                                  const std::string& algorithm,
                                  const std::string& solver_id)
 {
-    const auto item = invokers.find(network_config);
-    if(item == invokers.end())
-        MIOPEN_THROW("No invoker was registered for " + network_config);
+    const std::unique_lock<std::shared_mutex> lock{mutex};
+    const auto item = FindItem(network_config);
+    if(item == nullptr)
+        MIOPEN_THROW("No invoker was registered for " + network_config.ToString());
 
+    // Validating at find time
+    if(item->FindInvoker(solver_id) == nullptr)
     {
-        // Validating at find time
-        const auto& item_invokers = item->second.invokers;
-        const auto invoker        = item_invokers.find(solver_id);
-        if(invoker == item_invokers.end())
-        {
-            MIOPEN_THROW("No invoker with solver_id of " + solver_id + " was registered for " +
-                         network_config);
-        }
+        MIOPEN_THROW("No invoker with solver_id of " + solver_id + " was registered for " +
+                     network_config.ToString());
     }
 
-    item->second.found_1_0[algorithm] = solver_id;
+    auto& found_1_0 = item->found_1_0;
+    const auto it   = std::find_if(found_1_0.begin(), found_1_0.end(), [&](const auto& found) {
+        return found.first == algorithm;
+    });
+    if(it != found_1_0.end())
+        it->second = solver_id;
+    else
+        found_1_0.emplace_back(algorithm, solver_id);
+
     MIOPEN_LOG_I2("Solver " << solver_id << " registered as find 1.0 best for " << algorithm
-                            << " in " << network_config);
+                            << " in " << network_config.ToString());
 }
 
 } // namespace miopen
@@ -24,12 +24,24 @@
  *
  *******************************************************************************/
 #include "miopen/bz2.hpp"
+#include <miopen/errors.hpp>
 #include <miopen/kern_db.hpp>
+#include <miopen/par_for.hpp>
+
+#include <exception>
+#include <map>
+#include <utility>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_KERN_DB_VERIFY_MD5)
 
 namespace miopen {
 KernDb::KernDb(DbKinds db_kind, const fs::path& filename_, bool is_system_)
     : KernDb(db_kind, filename_, is_system_, compress, decompress)
 {
+    verify_md5 = env::enabled(MIOPEN_DEBUG_KERN_DB_VERIFY_MD5);
+    // Databases without the codec column can only hold bzip2 records
+    if(has_codec_column)
+        codec = GetDefaultCodec();
 }
 
 KernDb::KernDb(
@@ -66,7 +78,241 @@ KernDb::KernDb(
            << filename;
         MIOPEN_LOG_W(ss.str());
         dbInvalid = true;
+        return;
+    }
+
+    const auto codec_column = std::vector<std::string>{"kernel_codec"};
+    has_codec_column        = CheckTableColumns(KernelConfig::table_name(), codec_column);
+    if(!has_codec_column && !is_system)
+    {
+        // User databases created by older versions get the column. Existing records are bzip2.
+        try
+        {
+            sql.Exec("ALTER TABLE `" + KernelConfig::table_name() +
+                     "` ADD COLUMN `kernel_codec` INT NOT NULL DEFAULT 0;");
+        }
+        catch(const Exception&)
+        {
+            // Another process may have added it meanwhile
+        }
+        has_codec_column = CheckTableColumns(KernelConfig::table_name(), codec_column);
+    }
+}
+
+std::vector<char> KernDb::UnpackBlob(std::vector<char> blob,
+                                     const std::string& md5_hash,
+                                     int64_t uncompressed_size,
+                                     CompressionCodec blob_codec) const
+{
+    if(uncompressed_size != 0)
+    {
+        if(blob_codec == CompressionCodec::Bzip2)
+            blob = decompress_fn(blob, uncompressed_size);
+        else
+            blob = Decompress(blob_codec, blob, uncompressed_size);
+        if(blob.size() != static_cast<std::size_t>(uncompressed_size))
+            MIOPEN_THROW(miopenStatusInternalError, "Possible database corruption");
+        if(!verify_md5)
+            return blob;
+    }
+    if(md5(blob) != md5_hash)
+        MIOPEN_THROW(miopenStatusInternalError, "Possible database corruption");
+    return blob;
+}
+
+std::vector<boost::optional<std::vector<char>>>
+KernDb::FindRecordsUnsafe(const std::vector<KernelConfig>& configs)
+{
+    auto results = std::vector<boost::optional<std::vector<char>>>(configs.size());
+    if(filename.empty() || configs.empty())
+        return results;
+
+    struct Row
+    {
+        std::size_t idx;
+        std::vector<char> blob;
+        std::string md5_hash;
+        int64_t uncompressed_size;
+        CompressionCodec codec;
+    };
+
+    // A kernel may be requested more than once
+    auto indices = std::map<std::pair<std::string, std::string>, std::vector<std::size_t>>{};
+    for(std::size_t i = 0; i < configs.size(); ++i)
+        indices[{configs[i].kernel_name.string(), configs[i].kernel_args}].push_back(i);
+
+    // Keeps the number of bound parameters below the default SQLITE_MAX_VARIABLE_NUMBER
+    constexpr std::size_t batch_size = 256;
+    auto rows                        = std::vector<Row>{};
+    auto it                          = indices.begin();
+
+    while(it != indices.end())
+    {
+        auto batch = std::vector<decltype(it)>{};
+        for(; it != indices.end() && batch.size() < batch_size; ++it)
+            batch.push_back(it);
+
+        std::ostringstream ss;
+        ss << "SELECT kernel_name, kernel_args, " << SelectColumns() << " FROM "
+           << KernelConfig::table_name() << " WHERE ";
+        for(std::size_t i = 0; i < batch.size(); ++i)
+            ss << (i == 0 ? "" : " OR ") << "(kernel_name = ? AND kernel_args = ?)";
+        ss << ';';
+
+        auto stmt = SQLite::Statement{sql, ss.str()};
+        for(std::size_t i = 0; i < batch.size(); ++i)
+        {
+            stmt.BindText(2 * i + 1, batch[i]->first.first);
+            stmt.BindText(2 * i + 2, batch[i]->first.second);
+        }
+
+        for(;;)
+        {
+            const auto rc = stmt.Step(sql);
+            if(rc == SQLITE_DONE)
+                break;
+            if(rc != SQLITE_ROW)
+                MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+
+            const auto found = indices.find({stmt.ColumnText(0), stmt.ColumnText(1)});
+            if(found == indices.end())
+                continue;
+            rows.push_back({found->second.front(),
+                            stmt.ColumnBlob(2),
+                            stmt.ColumnText(3),
+                            stmt.ColumnInt64(4),
+                            has_codec_column ? static_cast<CompressionCodec>(stmt.ColumnInt64(5))
+                                             : CompressionCodec::Bzip2});
+        }
+    }
+
+    par_for(rows.size(), min_grain{1}, [&](auto i) {
+        auto& row = rows[i];
+        try
+        {
+            results[row.idx] =
+                UnpackBlob(std::move(row.blob), row.md5_hash, row.uncompressed_size, row.codec);
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Unable to unpack " << configs[row.idx].kernel_name << ": "
+                                             << ex.what());
+        }
+    });
+
+    for(const auto& index : indices)
+    {
+        for(std::size_t i = 1; i < index.second.size(); ++i)
+            results[index.second[i]] = results[index.second.front()];
+    }
+
+    return results;
+}
+
+namespace {
+
+const std::string& SourcesTable()
+{
+    static const std::string name = "kern_db_sources";
+    return name;
+}
+
+} // namespace
+
+void KernDb::StoreRecordsUnsafe(const std::vector<KernelConfig>& configs,
+                                const std::vector<std::string>& source_hashes)
+{
+    if(filename.empty() || configs.empty())
+        return;
+    if(!source_hashes.empty() && source_hashes.size() != configs.size())
+        MIOPEN_THROW(miopenStatusInternalError, "Expected a source hash per kernel");
+
+    struct Packed
+    {
+        std::vector<char> blob;
+        std::string md5_hash;
+        bool compressed = false;
+    };
+
+    auto packed = std::vector<Packed>(configs.size());
+    par_for(configs.size(), min_grain{1}, [&](auto i) {
+        const auto& blob   = configs[i].kernel_blob;
+        packed[i].md5_hash = md5(blob);
+        packed[i].blob     = PackBlob(blob, &packed[i].compressed);
+    });
+
+    sql.Exec("BEGIN IMMEDIATE TRANSACTION;");
+    try
+    {
+        if(!source_hashes.empty())
+        {
+            sql.Exec("CREATE TABLE IF NOT EXISTS `" + SourcesTable() +
+                     "` (`kernel_name` TEXT NOT NULL, `kernel_args` TEXT NOT NULL, "
+                     "`source_hash` TEXT NOT NULL, PRIMARY KEY(kernel_name, kernel_args));");
+        }
+
+        const auto insert_query        = InsertQuery();
+        const auto insert_source_query = "INSERT OR REPLACE INTO " + SourcesTable() +
+                                         "(kernel_name, kernel_args, source_hash) VALUES(?, ?, ?);";
+
+        for(std::size_t i = 0; i < configs.size(); ++i)
+        {
+            const auto& config = configs[i];
+            const auto& pack   = packed[i];
+            auto stmt          = SQLite::Statement{sql, insert_query};
+            stmt.BindPath(1, config.kernel_name);
+            stmt.BindText(2, config.kernel_args);
+            stmt.BindBlob(3, pack.compressed ? pack.blob : config.kernel_blob);
+            stmt.BindText(4, pack.md5_hash);
+            stmt.BindInt64(5, pack.compressed ? config.kernel_blob.size() : 0);
+            if(has_codec_column)
+                stmt.BindInt64(6, static_cast<int64_t>(codec));
+            if(stmt.Step(sql) != SQLITE_DONE)
+                MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+
+            if(source_hashes.empty())
+                continue;
+            auto source = SQLite::Statement{sql, insert_source_query};
+            source.BindPath(1, config.kernel_name);
+            source.BindText(2, config.kernel_args);
+            source.BindText(3, source_hashes[i]);
+            if(source.Step(sql) != SQLITE_DONE)
+                MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+        }
+        sql.Exec("COMMIT;");
+    }
+    catch(...)
+    {
+        sql.Exec("ROLLBACK;");
+        throw;
+    }
+}
+
+std::vector<std::string> KernDb::FindSourceHashesUnsafe(const std::vector<KernelConfig>& configs)
+{
+    auto results = std::vector<std::string>(configs.size());
+    if(filename.empty() || configs.empty() ||
+       !CheckTableColumns(SourcesTable(), {"kernel_name", "kernel_args", "source_hash"}))
+        return results;
+
+    // A hash is only valid while its kernel is in the database
+    const auto query = "SELECT s.source_hash FROM " + SourcesTable() + " AS s INNER JOIN " +
+                       KernelConfig::table_name() +
+                       " AS k ON k.kernel_name = s.kernel_name AND k.kernel_args = s.kernel_args"
+                       " WHERE s.kernel_name = ? AND s.kernel_args = ?;";
+
+    for(std::size_t i = 0; i < configs.size(); ++i)
+    {
+        auto stmt = SQLite::Statement{sql, query};
+        stmt.BindPath(1, configs[i].kernel_name);
+        stmt.BindText(2, configs[i].kernel_args);
+        const auto rc = stmt.Step(sql);
+        if(rc == SQLITE_ROW)
+            results[i] = stmt.ColumnText(0);
+        else if(rc != SQLITE_DONE)
+            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
     }
+    return results;
 }
 
 } // namespace miopen
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/kern_db_builder.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/hipoc_program.hpp>
+#include <miopen/kern_db.hpp>
+#include <miopen/kernel.hpp>
+#include <miopen/kernel_include_cache.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/thread_pool.hpp>
+#include <miopen/version.h>
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+
+namespace miopen {
+
+namespace {
+
+const std::string& GetIncludesHash()
+{
+    static const auto hash = [] {
+        const auto& table = GetKernelIncludeTable();
+        auto hashes       = std::string{};
+        for(std::size_t i = 0; i < table.names.size(); ++i)
+            hashes += md5(table.names[i] + '\n' + std::string{table.contents[i]});
+        return md5(hashes);
+    }();
+    return hash;
+}
+
+/// The compiler and the flags it gets from the build, which change the code objects without
+/// changing the sources.
+const std::string& GetToolchainId()
+{
+    static const auto id = [] {
+        auto ss = std::ostringstream{};
+        ss << "hip " << HIP_PACKAGE_VERSION_FLAT;
+#if MIOPEN_USE_COMGR
+        ss << " comgr " << MIOPEN_AMD_COMGR_VERSION_MAJOR << '.' << MIOPEN_AMD_COMGR_VERSION_MINOR
+           << '.' << MIOPEN_AMD_COMGR_VERSION_PATCH;
+#endif
+#if MIOPEN_USE_HIPRTC
+        ss << " hiprtc";
+#endif
+#ifdef MIOPEN_HIP_COMPILER
+        ss << " compiler " << std::string(MIOPEN_HIP_COMPILER);
+#endif
+        ss << " flags " << MIOPEN_STRINGIZE(HIP_COMPILER_FLAGS);
+        return ss.str();
+    }();
+    return id;
+}
+
+double SecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+KernDbBuilder::KernDbBuilder(Handle& handle_, fs::path database_)
+    : handle(handle_), target(handle_.GetTargetProperties()), database(std::move(database_))
+{
+}
+
+void KernDbBuilder::AddProblems(const std::vector<Problem>& problems)
+{
+    for(const auto& problem : problems)
+    {
+        if(!std::holds_alternative<ConvolutionDescriptor>(problem.GetOperatorDescriptor()))
+        {
+            MIOPEN_LOG_I("Only convolution problems are supported, skipped.");
+            continue;
+        }
+
+        auto conv_problem = problem.AsConvolution();
+        auto ctx          = ExecutionContext{&handle};
+        conv_problem.SetupFloats(ctx);
+        ctx.disable_search_enforce = true;
+        auto db                    = GetDb(ctx);
+
+        for(const auto& id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
+        {
+            const auto solver = id.GetSolver();
+            if(solver.IsEmpty() || !solver.IsApplicable(ctx, conv_problem))
+                continue;
+
+            try
+            {
+                const auto solution = solver.FindSolution(ctx, conv_problem, db, {});
+                if(!solution.Succeeded())
+                    continue;
+                for(const auto& kernel : solution.construction_params)
+                    AddKernel(kernel.kernel_file, kernel.comp_options);
+            }
+            catch(const std::exception& ex)
+            {
+                MIOPEN_LOG_W(id.ToString() << " failed for "
+                                           << conv_problem.MakeNetworkConfig().ToString() << ": "
+                                           << ex.what());
+            }
+        }
+    }
+}
+
+void KernDbBuilder::AddKernel(const fs::path& program, const std::string& params)
+{
+    if(known.emplace(program.string(), params).second)
+        kernels.emplace_back(program, params);
+}
+
+std::string KernDbBuilder::GetSourceHash(const fs::path& program, const std::string& build_args)
+{
+    const auto version = std::to_string(MIOPEN_VERSION_MAJOR) + "." +
+                         std::to_string(MIOPEN_VERSION_MINOR) + "." +
+                         std::to_string(MIOPEN_VERSION_PATCH) + "." +
+                         MIOPEN_STRINGIZE(MIOPEN_VERSION_TWEAK) + '\n' + GetToolchainId() + '\n' +
+                         build_args;
+    // MLIR kernels are generated by the library itself
+    if(program.extension() == ".mlir")
+        return md5(version);
+    return md5(version + '\n' + GetIncludesHash() + '\n' + std::string{GetKernelSrc(program)});
+}
+
+KernDbBuilder::Stats
+KernDbBuilder::Build(std::size_t jobs, std::size_t batch_size, bool force) const
+{
+    auto stats    = Stats{};
+    stats.kernels = kernels.size();
+
+    auto db      = KernDb{DbKinds::KernelDb, database, false};
+    auto configs = std::vector<KernelConfig>{};
+    auto hashes  = std::vector<std::string>{};
+    configs.reserve(kernels.size());
+    hashes.reserve(kernels.size());
+    for(const auto& kernel : kernels)
+    {
+        // The same keys as the HIP backend uses at run time
+        configs.push_back({make_object_file_name(kernel.first),
+                           AddTargetOptions(target, kernel.first, kernel.second),
+                           {}});
+        hashes.push_back(GetSourceHash(kernel.first, configs.back().kernel_args));
+    }
+
+    auto todo = std::vector<std::size_t>{};
+    {
+        const auto stored = force ? std::vector<std::string>(configs.size())
+                                  : db.FindSourceHashesUnsafe(configs);
+        for(std::size_t i = 0; i < configs.size(); ++i)
+        {
+            if(!stored[i].empty() && stored[i] == hashes[i])
+                ++stats.skipped;
+            else
+                todo.push_back(i);
+        }
+    }
+
+    batch_size = std::max<std::size_t>(batch_size, 1);
+    for(std::size_t begin = 0; begin < todo.size(); begin += batch_size)
+    {
+        const auto end = std::min(begin + batch_size, todo.size());
+        // Not std::vector<bool>, the workers write their items concurrently
+        auto built     = std::vector<char>(end - begin, 0);
+
+        const auto build_start = std::chrono::steady_clock::now();
+        ThreadPool::Get().ParallelFor(end - begin, jobs, [&](std::size_t i) {
+            auto& config       = configs[todo[begin + i]];
+            const auto& kernel = kernels[todo[begin + i]];
+            try
+            {
+                config.kernel_blob = BuildCodeObject(kernel.first, config.kernel_args, target);
+                built[i]           = 1;
+            }
+            catch(const std::exception& ex)
+            {
+                MIOPEN_LOG_E("Unable to build " << kernel.first << " '" << kernel.second
+                                                << "': " << ex.what());
+            }
+        });
+        stats.build_s += SecondsSince(build_start);
+
+        auto batch        = std::vector<KernelConfig>{};
+        auto batch_hashes = std::vector<std::string>{};
+        for(std::size_t i = 0; i < built.size(); ++i)
+        {
+            const auto idx = todo[begin + i];
+            if(built[i] == 0)
+            {
+                ++stats.failed;
+                continue;
+            }
+            batch.push_back(std::move(configs[idx]));
+            batch_hashes.push_back(hashes[idx]);
+        }
+
+        const auto store_start = std::chrono::steady_clock::now();
+        db.StoreRecordsUnsafe(batch, batch_hashes);
+        stats.store_s += SecondsSince(store_start);
+        stats.built += batch.size();
+
+        MIOPEN_LOG_I("Built " << stats.built + stats.failed << '/' << todo.size() << " kernels");
+    }
+
+    return stats;
+}
+
+} // namespace miopen
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/kernel_build_service.hpp>
+
+#include <miopen/generic_search_controls.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/thread_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+namespace miopen {
+
+struct KernelBuildFuture::Request
+{
+    KernelBuildService* service = nullptr;
+    std::string key;
+    KernelBuildService::BuildFn build;
+    // Set by the thread which runs the build
+    std::atomic<bool> started{false};
+    std::promise<Program> promise;
+    std::shared_future<Program> result;
+};
+
+bool KernelBuildFuture::is_ready() const
+{
+    return request->result.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+}
+
+Program KernelBuildFuture::get() const
+{
+    if(!request->started.exchange(true))
+        request->service->Run(request);
+    return request->result.get();
+}
+
+KernelBuildService& KernelBuildService::Get()
+{
+    // Builds are run by the pool, which has to outlive the service
+    std::ignore = ThreadPool::Get();
+    static KernelBuildService instance{
+        std::max<std::size_t>(env::value(MIOPEN_COMPILE_PARALLEL_LEVEL), 1)};
+    return instance;
+}
+
+KernelBuildService::KernelBuildService(std::size_t max_parallel_)
+    : max_parallel(std::max<std::size_t>(max_parallel_, 1))
+{
+}
+
+KernelBuildService::~KernelBuildService() { WaitAll(); }
+
+std::string KernelBuildService::MakeKey(const std::string& target,
+                                        const fs::path& program,
+                                        const std::string& options,
+                                        const std::string& source,
+                                        bool attach_binary)
+{
+    return md5(target + '\n' + program.string() + '\n' + options + '\n' +
+               (attach_binary ? "1" : "0") + '\n' + source);
+}
+
+std::shared_ptr<KernelBuildService::Request>
+KernelBuildService::Join(const std::string& key, BuildFn build, bool& joined)
+{
+    ++stats.requests;
+
+    const auto it = in_flight.find(key);
+    joined        = it != in_flight.end();
+    if(joined)
+    {
+        ++stats.deduplicated;
+        return it->second;
+    }
+
+    auto request     = std::make_shared<Request>();
+    request->service = this;
+    request->key     = key;
+    request->build   = std::move(build);
+    request->result  = request->promise.get_future().share();
+    in_flight.emplace(key, request);
+    return request;
+}
+
+KernelBuildFuture KernelBuildService::Submit(const std::string& key, BuildFn build)
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+
+    auto joined  = false;
+    auto request = Join(key, std::move(build), joined);
+    if(!joined)
+    {
+        queue.push_back(request);
+        if(workers < max_parallel)
+        {
+            ++workers;
+            ThreadPool::Get().Post([this]() { Work(); });
+        }
+    }
+
+    return KernelBuildFuture{request};
+}
+
+Program KernelBuildService::Build(const std::string& key, const BuildFn& build)
+{
+    auto request = std::shared_ptr<Request>{};
+
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        auto joined = false;
+        request     = Join(key, build, joined);
+        if(joined)
+            MIOPEN_LOG_I2("Waiting for the build of " << key);
+    }
+
+    return KernelBuildFuture{request}.get();
+}
+
+void KernelBuildService::Run(const std::shared_ptr<Request>& request)
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto failed      = false;
+
+    try
+    {
+        request->promise.set_value(request->build());
+    }
+    catch(...)
+    {
+        failed = true;
+        request->promise.set_exception(std::current_exception());
+    }
+    request->build = nullptr;
+
+    const auto ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        const auto it = in_flight.find(request->key);
+        if(it != in_flight.end() && it->second == request)
+            in_flight.erase(it);
+
+        ++stats.builds;
+        if(failed)
+            ++stats.failed;
+        stats.total_ms += ms;
+        stats.max_ms = std::max(stats.max_ms, ms);
+    }
+    idle.notify_all();
+}
+
+void KernelBuildService::Work()
+{
+    while(true)
+    {
+        auto request = std::shared_ptr<Request>{};
+
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+            // Requests taken over by their waiters are skipped.
+            while(!queue.empty() && request == nullptr)
+            {
+                if(!queue.front()->started.exchange(true))
+                    request = queue.front();
+                queue.pop_front();
+            }
+
+            if(request == nullptr)
+            {
+                --workers;
+                idle.notify_all();
+                return;
+            }
+        }
+
+        Run(request);
+    }
+}
+
+void KernelBuildService::WaitAll()
+{
+    std::unique_lock<std::mutex> lock{mutex};
+    idle.wait(lock, [&]() { return workers == 0 && in_flight.empty(); });
+}
+
+KernelBuildService::Stats KernelBuildService::GetStats() const
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    return stats;
+}
+
+} // namespace miopen
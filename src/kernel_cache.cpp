@@ -46,49 +46,183 @@
 #include <miopen/stringutils.hpp>
 
 #include <iostream>
+#include <chrono>
 #include <iterator>
+#include <map>
+#include <mutex>
 
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEVICE_ARCH)
 
 namespace miopen {
 
-const std::vector<Kernel>& KernelCache::GetKernels(const std::string& algorithm,
-                                                   const std::string& network_config)
+std::shared_ptr<ProgramCache> ProgramCache::GetShared(const std::string& device)
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::map<std::string, std::weak_ptr<ProgramCache>> instances;
+
+    const std::lock_guard<std::mutex> lock{mutex};
+    auto& instance = instances[device];
+    auto shared    = instance.lock();
+    if(!shared)
+    {
+        shared   = std::make_shared<ProgramCache>();
+        instance = shared;
+    }
+    return shared;
+}
+
+ProgramCache::Shard& ProgramCache::GetShard(const Key& key)
+{
+    return shards[SimpleHash{}(key) % shards.size()];
+}
+
+const ProgramCache::Shard& ProgramCache::GetShard(const Key& key) const
+{
+    return shards[SimpleHash{}(key) % shards.size()];
+}
+
+std::optional<Program> ProgramCache::Find(const Key& key) const
+{
+    auto program = std::shared_future<Program>{};
+
+    {
+        const auto& shard = GetShard(key);
+        const std::shared_lock<std::shared_mutex> lock{shard.mutex};
+        const auto it = shard.programs.find(key);
+        if(it == shard.programs.end())
+            return std::nullopt;
+        program = it->second.program;
+    }
+
+    try
+    {
+        return program.get();
+    }
+    catch(const std::exception&)
+    {
+        return std::nullopt;
+    }
+}
+
+bool ProgramCache::Contains(const Key& key) const
+{
+    const auto& shard = GetShard(key);
+    const std::shared_lock<std::shared_mutex> lock{shard.mutex};
+    return shard.programs.count(key) > 0;
+}
+
+Program ProgramCache::GetOrBuild(const Key& key, const std::function<Program()>& build)
+{
+    auto& shard   = GetShard(key);
+    auto program  = std::shared_future<Program>{};
+    auto promise  = std::promise<Program>{};
+    auto is_owner = false;
+    auto build_id = std::uint64_t{0};
+
+    {
+        const std::shared_lock<std::shared_mutex> lock{shard.mutex};
+        const auto it = shard.programs.find(key);
+        if(it != shard.programs.end())
+            program = it->second.program;
+    }
+
+    if(!program.valid())
+    {
+        const std::unique_lock<std::shared_mutex> lock{shard.mutex};
+        build_id = ++shard.last_build;
+        const auto inserted =
+            shard.programs.emplace(key, Entry{promise.get_future().share(), build_id});
+        program  = inserted.first->second.program;
+        is_owner = inserted.second;
+    }
+
+    if(!is_owner)
+    {
+        if(program.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+        {
+            MIOPEN_LOG_I2("Waiting for another thread to build " << key.first << ", "
+                                                                 << key.second);
+        }
+        return program.get();
+    }
+
+    try
+    {
+        promise.set_value(build());
+    }
+    catch(...)
+    {
+        {
+            // The entry may have been replaced by Add() meanwhile, that program is kept.
+            const std::unique_lock<std::shared_mutex> lock{shard.mutex};
+            const auto it = shard.programs.find(key);
+            if(it != shard.programs.end() && it->second.build == build_id)
+                shard.programs.erase(it);
+        }
+        promise.set_exception(std::current_exception());
+    }
+
+    return program.get();
+}
+
+void ProgramCache::Add(const Key& key, Program program)
+{
+    auto promise = std::promise<Program>{};
+    promise.set_value(std::move(program));
+
+    auto& shard = GetShard(key);
+    const std::unique_lock<std::shared_mutex> lock{shard.mutex};
+    shard.programs[key] = Entry{promise.get_future().share()};
+}
+
+void ProgramCache::Remove(const Key& key)
+{
+    auto& shard = GetShard(key);
+    const std::unique_lock<std::shared_mutex> lock{shard.mutex};
+    shard.programs.erase(key);
+}
+
+std::vector<Kernel> KernelCache::GetKernels(const std::string& algorithm,
+                                            const std::string& network_config) const
 {
 
     std::pair<std::string, std::string> key = std::make_pair(algorithm, network_config);
 
-    const auto it = kernel_map.find(key);
-    if(it != kernel_map.end())
     {
-        MIOPEN_LOG_I2(it->second.size()
-                      << " kernels for key: " << key.first << " \"" << key.second << '\"');
-        return it->second;
+        const std::shared_lock<std::shared_mutex> lock{kernel_mutex};
+        const auto it = kernel_map.find(key);
+        if(it != kernel_map.end())
+        {
+            MIOPEN_LOG_I2(it->second.size()
+                          << " kernels for key: " << key.first << " \"" << key.second << '\"');
+            return it->second;
+        }
     }
 
-    static const std::vector<Kernel> empty{};
     MIOPEN_LOG_I2("0 kernels for key: " << key.first << " \"" << key.second << '\"');
-    return empty;
+    return {};
 }
 
 bool KernelCache::HasProgram(const fs::path& name, const std::string& params) const
 {
-    const auto key = std::make_pair(name, params);
-    return program_map.count(key) > 0;
+    return programs->Contains(std::make_pair(name, params));
 }
 
 void KernelCache::ClearProgram(const fs::path& name, const std::string& params)
 {
-    if(HasProgram(name, params))
-    {
-        const auto key = std::make_pair(name, params);
-        program_map.erase(key);
-    }
+    programs->Remove(std::make_pair(name, params));
 }
 
 void KernelCache::AddProgram(Program prog, const fs::path& program_name, std::string params)
 {
-    program_map[std::make_pair(program_name, params)] = prog;
+    programs->Add(std::make_pair(program_name, params), prog);
+}
+
+void KernelCache::ShareProgramsWith(const std::string& device)
+{
+    programs = ProgramCache::GetShared(device);
 }
 
 Kernel KernelCache::AddKernel(const Handle& h,
@@ -108,29 +242,22 @@ Kernel KernelCache::AddKernel(const Handle& h,
         MIOPEN_LOG_I2("Key: " << key.first << " \"" << key.second << '\"');
 
     const auto program = [&] {
-        auto program_it = program_map.find(std::make_pair(program_name, params));
-        if(program_it != program_map.end())
+        const auto program_key = std::make_pair(program_name, params);
+        auto program           = programs->GetOrBuild(program_key, [&]() {
+            return h.LoadProgram(program_name, params, kernel_src, program_out != nullptr);
+        });
+
+        if(program_out != nullptr && !program.IsCodeObjectInMemory() &&
+           !program.IsCodeObjectInFile())
         {
-            auto& program = program_it->second;
-
-            if(program_out != nullptr && !program.IsCodeObjectInMemory() &&
-               !program.IsCodeObjectInFile())
-            {
-                // We need the binaries attached to the program.
-                // This may happen if someone calls immediate mode and then find 2.0 with request
-                // for binaries.
-                program = h.LoadProgram(program_name, params, kernel_src, true);
-            }
-
-            return program;
+            // We need the binaries attached to the program.
+            // This may happen if someone calls immediate mode and then find 2.0 with request
+            // for binaries.
+            program = h.LoadProgram(program_name, params, kernel_src, true);
+            programs->Add(program_key, program);
         }
-        else
-        {
-            auto program = h.LoadProgram(program_name, params, kernel_src, program_out != nullptr);
 
-            program_map[std::make_pair(program_name, params)] = program;
-            return program;
-        }
+        return program;
     }();
 
     if(program_out != nullptr)
@@ -156,6 +283,7 @@ Kernel KernelCache::AddKernel(const Handle& h,
 
 void KernelCache::AddKernel(Key key, Kernel k, std::size_t cache_index)
 {
+    const std::unique_lock<std::shared_mutex> lock{kernel_mutex};
     auto&& v = kernel_map[key];
     if(cache_index >= v.size())
     {
@@ -171,7 +299,8 @@ void KernelCache::ClearKernels(const std::string& algorithm, const std::string&
         MIOPEN_THROW("Network config or algorithm empty.");
     }
     const std::pair<std::string, std::string> key = std::make_pair(algorithm, network_config);
-    auto&& v                                      = this->kernel_map[key];
+    const std::unique_lock<std::shared_mutex> lock{kernel_mutex};
+    auto&& v = this->kernel_map[key];
     if(!v.empty())
     {
         MIOPEN_LOG_I2(v.size() << " kernels for key: " << key.first << " \"" << key.second << '\"');
@@ -179,6 +308,6 @@ void KernelCache::ClearKernels(const std::string& algorithm, const std::string&
     v.clear();
 }
 
-KernelCache::KernelCache() {}
+KernelCache::KernelCache() : programs(std::make_shared<ProgramCache>()) {}
 
 } // namespace miopen
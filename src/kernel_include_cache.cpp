@@ -0,0 +1,77 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/kernel_include_cache.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/kernel.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tmp_dir.hpp>
+#include <miopen/write_file.hpp>
+
+#include <tuple>
+
+namespace miopen {
+
+const KernelIncludeTable& GetKernelIncludeTable()
+{
+    static const KernelIncludeTable table = [] {
+        auto t               = KernelIncludeTable{};
+        const auto& inc_list = GetKernelIncList();
+        t.names.reserve(inc_list.size());
+        t.name_ptrs.reserve(inc_list.size());
+        t.contents.reserve(inc_list.size());
+        t.texts.reserve(inc_list.size());
+        for(const auto& inc_name : inc_list)
+        {
+            // The texts are embedded null terminated by addkernels.
+            const auto inc_text = GetKernelInc(inc_name);
+            t.names.push_back(inc_name.get().string());
+            t.contents.push_back(inc_text);
+            t.texts.push_back(inc_text.data());
+        }
+        // Taken once the names are complete, so that no reallocation invalidates them.
+        for(const auto& name : t.names)
+            t.name_ptrs.push_back(name.c_str());
+        return t;
+    }();
+    return table;
+}
+
+const fs::path& GetKernelIncludeDir()
+{
+    static const TmpDir dir{"kernel-includes"};
+    static const bool written = [] {
+        const auto& table = GetKernelIncludeTable();
+        for(std::size_t i = 0; i < table.names.size(); ++i)
+            WriteFile(table.contents[i], dir.path / table.names[i]);
+        MIOPEN_LOG_I2(table.names.size() << " kernel includes written to " << dir.path);
+        return true;
+    }();
+    std::ignore = written;
+    return dir.path;
+}
+
+} // namespace miopen
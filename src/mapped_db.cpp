@@ -0,0 +1,408 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/mapped_db.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+
+#include <boost/interprocess/exceptions.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+namespace miopen {
+
+namespace {
+
+constexpr char Magic[8] = {'M', 'I', 'O', 'D', 'B', 'I', 'D', 'X'};
+
+bool IsInBounds(std::uint64_t offset, std::uint64_t size, std::uint64_t total)
+{
+    return offset <= total && size <= total - offset;
+}
+
+std::int64_t GetMTime(const fs::path& path)
+{
+    return static_cast<std::int64_t>(fs::last_write_time(path).time_since_epoch().count());
+}
+
+/// Not a cryptographic hash, it only has to notice that the text db has been replaced. Words are
+/// hashed rather than bytes, so hashing is much faster than parsing the file.
+std::uint64_t HashFile(const fs::path& path)
+{
+    auto input = std::ifstream{path, std::ios::binary};
+    auto hash  = std::uint64_t{0xcbf29ce484222325};
+    auto chunk = std::vector<char>(1 << 20);
+
+    while(input)
+    {
+        input.read(chunk.data(), chunk.size());
+        const auto size = static_cast<std::size_t>(input.gcount());
+        auto i          = std::size_t{0};
+
+        for(; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t))
+        {
+            auto word = std::uint64_t{};
+            std::memcpy(&word, chunk.data() + i, sizeof(word));
+            hash = (hash ^ word) * 0x100000001b3;
+            hash ^= hash >> 29;
+        }
+
+        for(; i < size; ++i)
+            hash = (hash ^ static_cast<unsigned char>(chunk[i])) * 0x100000001b3;
+    }
+
+    return hash;
+}
+
+} // namespace
+
+fs::path MappedDb::GetPath(const fs::path& text_db_path)
+{
+    return text_db_path.string() + ".idx";
+}
+
+bool MappedDb::Build(DbKinds db_kind, const fs::path& text_db_path, const fs::path& out_path)
+{
+    auto input = std::ifstream{text_db_path};
+    if(!input)
+    {
+        MIOPEN_LOG_E("File is unreadable: " << text_db_path);
+        return false;
+    }
+
+    // Sorted by key, the first occurrence of a key wins the same way as in ReadonlyRamDb.
+    auto parsed = std::map<std::string, std::pair<int, DbRecord>>{};
+    auto line   = std::string{};
+    auto n_line = 0;
+
+    while(std::getline(input, line))
+    {
+        ++n_line;
+
+        if(line.empty())
+            continue;
+
+        const auto key_size = line.find('=');
+        if(key_size == std::string::npos || key_size == 0)
+        {
+            MIOPEN_LOG_E("Ill-formed record: key not found: " << text_db_path << "#" << n_line);
+            continue;
+        }
+
+        auto key    = line.substr(0, key_size);
+        auto record = DbRecord{key};
+        if(!record.ParseContents(line.substr(key_size + 1)))
+        {
+            MIOPEN_LOG_E("Error parsing payload under the key: " << key << " form file "
+                                                                 << text_db_path << "#" << n_line);
+            continue;
+        }
+
+        parsed.emplace(std::move(key), std::make_pair(n_line, std::move(record)));
+    }
+
+    auto records = std::vector<Record>{};
+    auto items   = std::vector<Item>{};
+    auto strings = std::string{};
+
+    const auto add_string = [&](const std::string& str) {
+        const auto offset = strings.size();
+        strings.append(str);
+        return static_cast<std::uint64_t>(offset);
+    };
+
+    records.reserve(parsed.size());
+    for(const auto& [key, line_and_record] : parsed)
+    {
+        const auto& record = line_and_record.second;
+
+        // Keep the output reproducible regardless of the unordered_map iteration order.
+        auto pairs = std::vector<std::pair<std::string, std::string>>{record.map.begin(),
+                                                                      record.map.end()};
+        std::sort(pairs.begin(), pairs.end());
+
+        records.push_back({add_string(key),
+                           static_cast<std::uint32_t>(key.size()),
+                           static_cast<std::uint32_t>(line_and_record.first),
+                           static_cast<std::uint32_t>(items.size()),
+                           static_cast<std::uint32_t>(pairs.size())});
+
+        for(const auto& [id, values] : pairs)
+        {
+            const auto id_offset     = add_string(id);
+            const auto values_offset = add_string(values);
+            items.push_back({id_offset,
+                             values_offset,
+                             static_cast<std::uint32_t>(id.size()),
+                             static_cast<std::uint32_t>(values.size())});
+        }
+    }
+
+    auto header = Header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version        = Version;
+    header.db_kind        = static_cast<std::uint32_t>(db_kind);
+    header.source_size    = fs::file_size(text_db_path);
+    header.source_mtime   = GetMTime(text_db_path);
+    header.source_hash    = HashFile(text_db_path);
+    header.record_count   = records.size();
+    header.item_count     = items.size();
+    header.records_offset = sizeof(Header);
+    header.items_offset   = header.records_offset + records.size() * sizeof(Record);
+    header.strings_offset = header.items_offset + items.size() * sizeof(Item);
+    header.strings_size   = strings.size();
+
+    // Write next to the destination and rename, so that readers never observe a partial image.
+    const auto tmp_path = fs::path{out_path.string() + ".tmp"};
+    {
+        auto output = std::ofstream{tmp_path, std::ios::binary | std::ios::trunc};
+        if(!output)
+        {
+            MIOPEN_LOG_E("Unable to open for writing: " << tmp_path);
+            return false;
+        }
+
+        output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        output.write(reinterpret_cast<const char*>(records.data()),
+                     records.size() * sizeof(Record));
+        output.write(reinterpret_cast<const char*>(items.data()), items.size() * sizeof(Item));
+        output.write(strings.data(), strings.size());
+
+        if(!output)
+        {
+            MIOPEN_LOG_E("Error writing: " << tmp_path);
+            output.close();
+            std::error_code ec;
+            fs::remove(tmp_path, ec);
+            return false;
+        }
+    }
+    try
+    {
+        fs::rename(tmp_path, out_path);
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_E("Unable to publish " << out_path << ": " << ex.what());
+        std::error_code ec;
+        fs::remove(tmp_path, ec);
+        return false;
+    }
+
+    MIOPEN_LOG_I("Indexed " << records.size() << " records from " << text_db_path << " into "
+                            << out_path);
+    return true;
+}
+
+std::unique_ptr<MappedDb> MappedDb::Open(DbKinds db_kind,
+                                         const fs::path& path,
+                                         const fs::path& text_db_path,
+                                         bool check_source)
+{
+    if(!fs::exists(path))
+        return nullptr;
+
+    auto db = std::unique_ptr<MappedDb>{new MappedDb{path}};
+
+    try
+    {
+        namespace bip = boost::interprocess;
+        db->file      = bip::file_mapping{path.string().c_str(), bip::read_only};
+        db->region    = bip::mapped_region{db->file, bip::read_only};
+    }
+    catch(const boost::interprocess::interprocess_exception& ex)
+    {
+        MIOPEN_LOG_W("Unable to map " << path << ": " << ex.what());
+        return nullptr;
+    }
+
+    const auto size = static_cast<std::uint64_t>(db->region.get_size());
+    const auto base = static_cast<const char*>(db->region.get_address());
+
+    if(size < sizeof(Header))
+    {
+        MIOPEN_LOG_W("Truncated db index: " << path);
+        return nullptr;
+    }
+
+    const auto& header = *reinterpret_cast<const Header*>(base);
+
+    if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version ||
+       header.db_kind != static_cast<std::uint32_t>(db_kind))
+    {
+        MIOPEN_LOG_W("Unsupported db index: " << path);
+        return nullptr;
+    }
+
+    // Installation preserves the mtime, so the text file doesn't have to be read.
+    const auto has_source = fs::exists(text_db_path);
+    if((check_source && !has_source) ||
+       (has_source && (fs::file_size(text_db_path) != header.source_size ||
+                       GetMTime(text_db_path) != header.source_mtime)))
+    {
+        if(check_source)
+            MIOPEN_LOG_I("Db snapshot is out of date: " << path);
+        else
+            MIOPEN_LOG_W("Db index is out of date: " << path << ", ignored.");
+        return nullptr;
+    }
+
+    if(header.record_count > size / sizeof(Record) || header.item_count > size / sizeof(Item) ||
+       !IsInBounds(header.records_offset, header.record_count * sizeof(Record), size) ||
+       !IsInBounds(header.items_offset, header.item_count * sizeof(Item), size) ||
+       !IsInBounds(header.strings_offset, header.strings_size, size) ||
+       header.records_offset % alignof(Record) != 0 || header.items_offset % alignof(Item) != 0)
+    {
+        MIOPEN_LOG_W("Ill-formed db index: " << path);
+        return nullptr;
+    }
+
+    db->header  = &header;
+    db->records = reinterpret_cast<const Record*>(base + header.records_offset);
+    db->items   = reinterpret_cast<const Item*>(base + header.items_offset);
+    db->strings = base + header.strings_offset;
+
+    // Only the index is touched here, the strings are paged in on demand.
+    for(auto i = std::uint64_t{0}; i < header.record_count; ++i)
+    {
+        const auto& record = db->records[i];
+        if(!IsInBounds(record.key_offset, record.key_size, header.strings_size) ||
+           !IsInBounds(record.first_item, record.item_count, header.item_count))
+        {
+            MIOPEN_LOG_W("Ill-formed db index: " << path << ", record #" << i);
+            return nullptr;
+        }
+    }
+
+    for(auto i = std::uint64_t{0}; i < header.item_count; ++i)
+    {
+        const auto& item = db->items[i];
+        if(!IsInBounds(item.id_offset, item.id_size, header.strings_size) ||
+           !IsInBounds(item.values_offset, item.values_size, header.strings_size))
+        {
+            MIOPEN_LOG_W("Ill-formed db index: " << path << ", item #" << i);
+            return nullptr;
+        }
+    }
+
+    MIOPEN_LOG_I2("Mapped " << header.record_count << " records from " << path);
+    return db;
+}
+
+fs::path MappedDb::GetSnapshotPath(const fs::path& snapshot_dir, const fs::path& text_db_path)
+{
+    // Different installations may have text dbs with the same name, so the path is a part of the
+    // name of the snapshot.
+    const auto path_hash = md5(fs::absolute(text_db_path).string()).substr(0, 16);
+    return snapshot_dir / (text_db_path.filename().string() + "." + path_hash + ".snapshot");
+}
+
+std::unique_ptr<MappedDb>
+MappedDb::OpenSnapshot(DbKinds db_kind, const fs::path& snapshot_dir, const fs::path& text_db_path)
+{
+    if(!fs::exists(text_db_path))
+        return nullptr;
+
+    const auto path = GetSnapshotPath(snapshot_dir, text_db_path);
+
+    if(auto db = Open(db_kind, path, text_db_path, true))
+        return db;
+
+    try
+    {
+        if(!fs::exists(snapshot_dir))
+        {
+            fs::create_directories(snapshot_dir);
+            fs::permissions(snapshot_dir, FS_ENUM_PERMS_ALL);
+        }
+
+        auto& lock_file = LockFile::Get(LockFilePath(path));
+        const std::lock_guard<LockFile> lock{lock_file};
+
+        // Another process may have published it while we were waiting for the lock.
+        if(auto db = Open(db_kind, path, text_db_path, true))
+            return db;
+
+        // Processes that have mapped the old snapshot keep using it, as the file is replaced by
+        // a rename rather than overwritten.
+        if(!Build(db_kind, text_db_path, path))
+            return nullptr;
+        fs::permissions(path, FS_ENUM_PERMS_ALL);
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_W("Unable to publish db snapshot " << path << ": " << ex.what());
+        return nullptr;
+    }
+
+    return Open(db_kind, path, text_db_path, true);
+}
+
+std::string_view MappedDb::GetKey(std::size_t idx) const
+{
+    return GetString(records[idx].key_offset, records[idx].key_size);
+}
+
+DbRecord MappedDb::GetRecord(std::size_t idx) const
+{
+    const auto& record = records[idx];
+    auto ret           = DbRecord{std::string{GetKey(idx)}};
+
+    for(auto i = record.first_item; i < record.first_item + record.item_count; ++i)
+    {
+        const auto& item = items[i];
+        ret.map.emplace(GetString(item.id_offset, item.id_size),
+                        GetString(item.values_offset, item.values_size));
+    }
+
+    return ret;
+}
+
+boost::optional<DbRecord> MappedDb::FindRecord(std::string_view key) const
+{
+    MIOPEN_LOG_I2("Looking for key " << key << " in file " << path);
+
+    const auto end = records + header->record_count;
+    const auto it  = std::lower_bound(records, end, key, [this](const Record& record, auto k) {
+        return GetString(record.key_offset, record.key_size) < k;
+    });
+
+    if(it == end || GetString(it->key_offset, it->key_size) != key)
+        return boost::none;
+
+    MIOPEN_LOG_I2("Key match: " << key);
+    return GetRecord(it - records);
+}
+
+} // namespace miopen
@@ -32,8 +32,10 @@
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
+#include <miopen/kernel_build_service.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/ramdb.hpp>
 #include <miopen/timer.hpp>
 #include <miopen/hipoc_program.hpp>
 
@@ -61,15 +63,31 @@
 
 namespace miopen {
 
-Handle::Handle(miopenAcceleratorQueue_t /* stream */) : Handle::Handle() {}
+Handle::Handle(miopenAcceleratorQueue_t stream) : Handle(stream, true) {}
 
-Handle::Handle() : impl(new HandleImpl())
+Handle::Handle() : Handle(nullptr, true) {}
+
+Handle::Handle(miopenAcceleratorQueue_t /* stream */, bool precompile_manifest)
+    : impl(new HandleImpl())
 {
     this->impl->target_properties.Init(this);
+    this->impl->cache.ShareProgramsWith(this->GetDbBasename());
     MIOPEN_LOG_NQI(*this);
+    if(precompile_manifest)
+        PrecompileFromManifest(*this, this->GetDbBasename());
+}
+
+std::unique_ptr<Handle> Handle::CreateBackgroundHandle() const
+{
+    return std::unique_ptr<Handle>{new Handle(nullptr, false)};
 }
 
-Handle::~Handle() {}
+Handle::~Handle()
+{
+    if(precompiler)
+        precompiler->WaitAll();
+    RamDb::FlushAll();
+}
 
 void Handle::SetStream(miopenAcceleratorQueue_t /* streamID */) const {}
 
@@ -170,18 +188,49 @@ void Handle::ClearProgram(const fs::path& program_name, const std::string& param
     this->impl->cache.ClearProgram(program_name, params);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config) const
+std::vector<Kernel> Handle::GetKernelsImpl(const std::string& algorithm,
+                                           const std::string& network_config) const
 {
     return this->impl->cache.GetKernels(algorithm, network_config);
 }
 
 KernelInvoke Handle::Run(Kernel /*k*/, bool /*coop_launch*/) const { return {}; }
 
+std::string Handle::GetProgramBuildKey(const fs::path& program_name,
+                                       const std::string& params,
+                                       const std::string& kernel_src,
+                                       bool force_attach_binary) const
+{
+    return KernelBuildService::MakeKey(
+        GetDbBasename(), program_name, params, kernel_src, force_attach_binary);
+}
+
 Program Handle::LoadProgram(const fs::path& program_name,
                             std::string params,
                             const std::string& kernel_src,
                             bool force_attach_binary) const
+{
+    return KernelBuildService::Get().Build(
+        GetProgramBuildKey(program_name, params, kernel_src, force_attach_binary), [&]() {
+            return BuildProgram(program_name, params, kernel_src, force_attach_binary);
+        });
+}
+
+KernelBuildFuture Handle::LoadProgramAsync(const fs::path& program_name,
+                                           std::string params,
+                                           const std::string& kernel_src,
+                                           bool force_attach_binary) const
+{
+    auto key = GetProgramBuildKey(program_name, params, kernel_src, force_attach_binary);
+    return KernelBuildService::Get().Submit(std::move(key), [=]() {
+        return BuildProgram(program_name, params, kernel_src, force_attach_binary);
+    });
+}
+
+Program Handle::BuildProgram(const fs::path& program_name,
+                             std::string params,
+                             const std::string& kernel_src,
+                             bool force_attach_binary) const
 {
     std::ignore = force_attach_binary;
 
@@ -238,6 +287,23 @@ void Handle::AddProgram(Program prog, const fs::path& program_name, const std::s
     this->impl->cache.AddProgram(prog, program_name, params);
 }
 
+BinaryPrefetch
+Handle::WarmPrograms(const std::vector<std::pair<fs::path, std::string>>& programs) const
+{
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    auto targeted = programs;
+    for(auto& program : targeted)
+    {
+        if(program.first.extension() == ".mlir")
+            program.second += " -mcpu=" + this->GetTargetProperties().Name();
+    }
+    return miopen::WarmBinaries(GetTargetProperties(), GetMaxComputeUnits(), targeted);
+#else
+    std::ignore = programs;
+    return {};
+#endif
+}
+
 void Handle::Finish() const {}
 void Handle::Flush() const {}
 
@@ -48,6 +48,7 @@
 #include <miopen/datatype.hpp>
 #include <miopen/any_solver.hpp>
 #include <miopen/conv/tensors.hpp>
+#include <miopen/conv/applicability_index.hpp>
 #include <miopen/problem.hpp>
 #include <miopen/conv/compiled_in_parameters.hpp>
 #include <miopen/conv/data_invoke_params.hpp>
@@ -64,6 +65,7 @@ MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_IMMED_FALLBACK)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DUMP_TENSOR_PATH)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_FORCE_IMMED_MODE_FALLBACK)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_FIND_IN_BACKGROUND)
 
 namespace miopen {
 
@@ -105,7 +107,9 @@ Invoker LoadOrPrepareInvoker(const ExecutionContext& ctx,
 {
     const auto& handle = ctx.GetStream();
     const auto config  = problem.MakeNetworkConfig();
-    auto invoker       = handle.GetInvoker(config, solver_id);
+    // The problem may be being compiled in the background, see PrecompileAsync()
+    std::ignore  = handle.GetPrecompiler().Wait(config);
+    auto invoker = handle.GetInvoker(config, solver_id);
     if(invoker)
         return *invoker;
     return PrepareInvoker(ctx, problem, config, solver_id);
@@ -140,6 +144,149 @@ static void ShrinkToFind10Results(std::vector<Solution>& found)
     found = std::move(out);
 }
 
+/// Runs the full search of the problem, as in the Normal find mode, unless the user find-db has
+/// the results already, and stores the results in the user find-db.
+static std::vector<Solution> SearchConvolution(const ExecutionContext& ctx,
+                                               const conv::ProblemDescription& problem,
+                                               const AnyInvokeParams& invoke_ctx,
+                                               bool force_attach_binary)
+{
+    return UserFindDbRecord::TryLoad(ctx.GetStream(), problem, [&]() {
+        const auto params =
+            conv::ConvFindParameters{problem.GetConv().IsWinograd3x3SupportedAndFast(ctx, problem)};
+
+        return FindCore(invoke_ctx,
+                        ctx,
+                        problem,
+                        params,
+                        conv::GetConvSolverFinders(),
+                        std::nullopt,
+                        force_attach_binary);
+    });
+}
+
+static AnyInvokeParams MakeSearchInvokeParams(const conv::ProblemDescription& problem,
+                                              Data_t in,
+                                              Data_t weights,
+                                              Data_t out,
+                                              Data_t workspace,
+                                              std::size_t workspace_size)
+{
+    const auto& fp16_alt = problem.GetConv().attribute.gfx90aFp16alt;
+
+    switch(problem.GetDirection())
+    {
+    case conv::Direction::Forward:
+        return conv::DataInvokeParams(
+            {problem.GetIn(), in, problem.GetWeights(), weights, problem.GetOut(), out},
+            workspace,
+            workspace_size,
+            fp16_alt.GetFwd());
+    case conv::Direction::BackwardData:
+        return conv::DataInvokeParams(
+            {problem.GetIn(), in, problem.GetWeights(), weights, problem.GetOut(), out},
+            workspace,
+            workspace_size,
+            fp16_alt.GetBwd());
+    case conv::Direction::BackwardWeights:
+        return conv::WrWInvokeParams{
+            {problem.GetIn(), in, problem.GetOut(), out, problem.GetWeights(), weights},
+            workspace,
+            workspace_size,
+            fp16_alt.GetWrW()};
+    }
+
+    MIOPEN_THROW(miopenStatusNotImplemented);
+}
+
+/// The search runs on the handle of the background finder, with buffers of its own. The
+/// application uses its handle meanwhile, so the results are applied on its thread, by the next
+/// find or convolution call: the handle switches its find 1.0 invokers to the best found solution
+/// of each algorithm, if it doesn't need more workspace than the one it replaces.
+static void SearchConvolutionInBackground(const ExecutionContext& ctx,
+                                          const conv::ProblemDescription& problem)
+{
+    auto& finder = ctx.GetStream().GetBackgroundFinder();
+
+    finder.Submit(problem.MakeNetworkConfig(), [&finder, problem]() {
+        auto& search_handle = finder.GetSearchHandle();
+
+        // Searched as in the Normal find mode, whatever mode the application uses
+        auto conv = problem.GetConv();
+        conv.findMode.Set(FindMode::Values::Normal);
+        const auto search_problem = conv::ProblemDescription{problem.GetIn(),
+                                                             problem.GetWeights(),
+                                                             problem.GetOut(),
+                                                             conv,
+                                                             problem.GetDirection(),
+                                                             problem.GetBias(),
+                                                             problem.GetAlpha(),
+                                                             problem.GetBeta()};
+
+        auto search_ctx      = ExecutionContext{&search_handle};
+        search_ctx.cancelled = &finder.Stopping();
+        search_problem.SetupFloats(search_ctx);
+
+        // The allocator of the application may not be called from another thread
+        const auto allocate = [&](const TensorDescriptor& desc) {
+            return search_handle.Create(desc.GetElementSpace() * get_data_size(desc.GetType()));
+        };
+
+        const auto in             = allocate(problem.GetIn());
+        const auto weights        = allocate(problem.GetWeights());
+        const auto out            = allocate(problem.GetOut());
+        const auto workspace_size = conv.GetWorkSpaceSize(search_ctx, search_problem);
+        const auto workspace =
+            workspace_size != 0 ? search_handle.Create(workspace_size) : nullptr;
+        const auto invoke_ctx = MakeSearchInvokeParams(
+            search_problem, in.get(), weights.get(), out.get(), workspace.get(), workspace_size);
+
+        auto results = SearchConvolution(search_ctx, search_problem, invoke_ctx, false);
+        ShrinkToFind10Results(results);
+
+        finder.Publish([&finder, problem, results = std::move(results)]() {
+            auto& handle = finder.GetOwner();
+            auto app_ctx = ExecutionContext{&handle};
+            problem.SetupFloats(app_ctx);
+            const auto config = problem.MakeNetworkConfig();
+
+            for(const auto& result : results)
+            {
+                const auto id   = result.GetSolver();
+                const auto algo = AlgorithmName{id.GetAlgo(problem.GetDirection())};
+
+                // The application has allocated the workspace for the solution it was given
+                const auto current = handle.GetFound1_0SolverId(config, algo);
+                if(current && *current != id.ToString() &&
+                   solver::Id{*current}.GetSolver().GetWorkspaceSize(app_ctx, problem) <
+                       result.GetWorkspaceSize())
+                {
+                    MIOPEN_LOG_I("Kept " << *current << " instead of " << id.ToString()
+                                         << ", which needs more workspace");
+                    continue;
+                }
+
+                // The search has built the kernels, so this loads them from the caches
+                if(handle.GetInvoker(config, id))
+                    handle.SetAsFound1_0(config, algo, id.ToString());
+                else
+                    PrepareInvoker(app_ctx, problem, config, id);
+            }
+
+            MIOPEN_LOG_I("Applied the background search of " << config.ToString());
+        });
+
+        MIOPEN_LOG_I("Background search of " << problem.MakeNetworkConfig().ToString()
+                                             << " has completed");
+    });
+}
+
+static bool IsFindInBackgroundEnabled(const ExecutionContext& ctx)
+{
+    return env::enabled(MIOPEN_FIND_IN_BACKGROUND) &&
+           !FindEnforce{}.IsSomethingEnforced(ctx) && !env::enabled(MIOPEN_DEBUG_COMPILE_ONLY);
+}
+
 std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
                                       const conv::ProblemDescription& problem,
                                       const AnyInvokeParams& invoke_ctx,
@@ -151,6 +298,8 @@ std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
     const auto& conv     = problem.GetConv();
     const auto& findMode = conv.findMode;
 
+    ctx.GetStream().GetBackgroundFinder().ApplyPublished();
+
     if(findMode.IsFast(ctx) || findMode.IsHybrid(ctx))
     {
         auto fallback = bool{};
@@ -162,6 +311,18 @@ std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
         // In Hybrid Find mode, we use Normal Find instead of Immediate fallback kernels.
     }
 
+    // The heuristic choice serves the call until the search in the background is done
+    if(!sol.has_value() && IsFindInBackgroundEnabled(ctx) &&
+       UserFindDbRecord{ctx.GetStream(), problem}.empty())
+    {
+        auto sols = conv.GetSolutions(ctx, problem, 1, nullptr, &invoke_ctx);
+        if(!sols.empty())
+        {
+            sol = sols.front();
+            SearchConvolutionInBackground(ctx, problem);
+        }
+    }
+
     if(sol.has_value())
     {
         /// It is possible to measure actual execution time and return it to the caller.
@@ -173,20 +334,9 @@ std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
     }
     else
     {
-        results = UserFindDbRecord::TryLoad(ctx.GetStream(), problem, [&]() {
-            auto ctx_copy                       = ctx;
-            ctx_copy.use_dynamic_solutions_only = findMode.IsDynamicHybrid(ctx);
-            const auto params =
-                conv::ConvFindParameters{conv.IsWinograd3x3SupportedAndFast(ctx_copy, problem)};
-
-            return FindCore(invoke_ctx,
-                            ctx_copy,
-                            problem,
-                            params,
-                            conv::GetConvSolverFinders(),
-                            std::nullopt,
-                            force_attach_binary);
-        });
+        auto ctx_copy                       = ctx;
+        ctx_copy.use_dynamic_solutions_only = findMode.IsDynamicHybrid(ctx);
+        results = SearchConvolution(ctx_copy, problem, invoke_ctx, force_attach_binary);
     }
 
     if(env::enabled(MIOPEN_DEBUG_COMPILE_ONLY))
@@ -206,6 +356,53 @@ std::vector<Solution> FindConvolution(const ExecutionContext& ctx,
     return results;
 }
 
+void PrecompileConvolution(const ExecutionContext& ctx,
+                           const conv::ProblemDescription& problem,
+                           bool force_attach_binary)
+{
+    const auto& conv     = problem.GetConv();
+    const auto& findMode = conv.findMode;
+
+    // Mirrors FindConvolution(): the solutions it is going to load or evaluate are compiled.
+    if(findMode.IsFast(ctx) || findMode.IsHybrid(ctx))
+    {
+        auto fallback   = bool{};
+        const auto sols = conv.GetSolutions(ctx, problem, 1, &fallback);
+        if(!sols.empty() && (!(findMode.IsHybrid(ctx) && fallback) ||
+                             env::enabled(MIOPEN_DEBUG_FORCE_IMMED_MODE_FALLBACK)))
+        {
+            CompileSolution(solver::Id{sols.front().solution_id}, ctx, problem);
+            return;
+        }
+    }
+
+    {
+        const auto record = UserFindDbRecord{ctx.GetStream(), problem};
+        if(!record.empty())
+        {
+            for(const auto& entry : record)
+            {
+                const auto id = solver::Id{entry.first};
+                if(id.IsValid())
+                    CompileSolution(id, ctx, problem);
+            }
+            return;
+        }
+    }
+
+    // Nothing is tuned here, so under exhaustive search the tuned kernels are still compiled by
+    // the search itself.
+    auto ctx_copy                       = ctx;
+    ctx_copy.use_dynamic_solutions_only = findMode.IsDynamicHybrid(ctx);
+    ctx_copy.do_search                  = false;
+    ctx_copy.disable_search_enforce     = true;
+    const auto params =
+        conv::ConvFindParameters{conv.IsWinograd3x3SupportedAndFast(ctx_copy, problem)};
+
+    PrecompileCore(
+        ctx_copy, problem, params, conv::GetConvSolverFinders(), force_attach_binary);
+}
+
 template <class FieldType>
 static inline void FillFindReturnParameters(const std::vector<Solution>& results,
                                             FieldType miopenConvAlgoPerf_t::*field,
@@ -482,6 +679,7 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
 
         const auto algorithm_name = AlgorithmName{ConvolutionAlgoToDirectionalString(
             static_cast<miopenConvAlgorithm_t>(algo), conv::Direction::Forward)};
+        handle.GetBackgroundFinder().ApplyPublished();
         const auto network_config = problem.MakeNetworkConfig();
         const auto& invoker       = handle.GetInvoker(network_config, {}, algorithm_name);
 
@@ -597,13 +795,14 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
 
     auto interim = std::vector<miopenConvSolution_t>{};
     interim.reserve(maxSolutionCount); // For speed. In most cases we have less entries than asked.
+    const auto applicability = conv::ApplicabilityQuery{ctx, problem};
 
     // TunaNet Fallback
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
     if(!env::disabled(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK))
     {
-        const static std::string arch = ctx.GetStream().GetDeviceName();
-        auto solvers                  = ai::immed_mode::PredictSolver(problem, ctx, arch);
+        const auto arch = ctx.GetStream().GetDeviceName();
+        auto solvers    = ai::immed_mode::PredictSolver(problem, ctx, arch);
         if(!solvers.empty())
         {
             MIOPEN_LOG_I2("Using TunaNet Fallback");
@@ -620,7 +819,7 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
                     continue;
                 if(!sol.IsDynamic())
                     continue; // branch should never be taken
-                if(!sol.IsApplicable(ctx, problem))
+                if(!applicability.IsApplicable(solver_id, sol))
                     continue;
                 const auto ws = sol.GetWorkspaceSize(ctx, problem);
                 if(!conv::IsEnoughWorkspace("GetSolutionsFallback AI", solver_id, ws, invokeParams))
@@ -654,7 +853,7 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
                 continue;
             const auto& s = solver_id.GetSolver();
             // Let's allow non-dynamic later, if necessary.
-            if(s.IsEmpty() || !s.IsDynamic() || !s.IsApplicable(ctx, problem))
+            if(s.IsEmpty() || !s.IsDynamic() || !applicability.IsApplicable(solver_id, s))
                 continue;
             const auto ws = s.GetWorkspaceSize(ctx, problem);
             if(!conv::IsEnoughWorkspace("GetSolutionsFallback WTI", solver_id, ws, invokeParams))
@@ -742,11 +941,12 @@ std::vector<miopenConvSolution_t> GetSolutions(const ExecutionContext& ctx,
     std::sort(begin(interim), end(interim), SolutionTimeComparator{});
     auto out = std::vector<miopenConvSolution_t>{};
     out.reserve(maxSolutionCount);
-    auto n_copied = 0;
+    auto n_copied            = 0;
+    const auto applicability = conv::ApplicabilityQuery{ctx, problem};
     for(const auto& s : interim)
     {
         const auto solver_id = solver::Id{s.solution_id};
-        if(!solver_id.GetSolver().IsApplicable(ctx, problem))
+        if(!applicability.IsApplicable(solver_id))
             continue;
         if(!conv::IsEnoughWorkspace("GetSolutions", solver_id, s.workspace_size, invokeParams))
             continue;
@@ -783,6 +983,9 @@ ConvolutionDescriptor::GetSolutions(const ExecutionContext& ctx,
     if(!solutions.empty())
         return solutions;
 
+    if(IsFindInBackgroundEnabled(ctx))
+        SearchConvolutionInBackground(ctx, problem);
+
     return GetSolutionsFallback(ctx, problem, maxSolutionCount, invokeParams);
 }
 
@@ -974,6 +1177,7 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
         const auto algorithm_name = AlgorithmName{ConvolutionAlgoToDirectionalString(
             static_cast<miopenConvAlgorithm_t>(algo), conv::Direction::BackwardData)};
 
+        handle.GetBackgroundFinder().ApplyPublished();
         const auto network_config = problem.MakeNetworkConfig();
         const auto& invoker       = handle.GetInvoker(network_config, {}, algorithm_name);
 
@@ -1178,6 +1382,7 @@ void ConvolutionDescriptor::ConvolutionBackwardWeights(const Handle& handle,
 
         decltype(auto) algorithm_name = AlgorithmName{ConvolutionAlgoToDirectionalString(
             static_cast<miopenConvAlgorithm_t>(algo), direction)};
+        handle.GetBackgroundFinder().ApplyPublished();
         decltype(auto) network_config = problem.MakeNetworkConfig();
         decltype(auto) invoker = handle.GetInvoker(network_config, std::nullopt, algorithm_name);
 
@@ -32,16 +32,19 @@
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
+#include <miopen/kernel_build_service.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/load_file.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/manage_ptr.hpp>
 #include <miopen/ocldeviceinfo.hpp>
+#include <miopen/ramdb.hpp>
 #include <miopen/timer.hpp>
 
 #include <miopen/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 
+#include <sstream>
 #include <string>
 
 #ifndef _WIN32
@@ -171,7 +174,18 @@ struct HandleImpl
     }
 };
 
-Handle::Handle(miopenAcceleratorQueue_t stream) : impl(new HandleImpl())
+// Programs belong to the context of the handle
+static std::string GetProgramsDevice(const Handle& handle)
+{
+    std::ostringstream target;
+    target << miopen::GetContext(handle.GetStream()) << ":" << handle.GetTargetProperties().DbId();
+    return target.str();
+}
+
+Handle::Handle(miopenAcceleratorQueue_t stream) : Handle(stream, true) {}
+
+Handle::Handle(miopenAcceleratorQueue_t stream, bool precompile_manifest)
+    : impl(new HandleImpl())
 {
     clRetainCommandQueue(stream);
     impl->queue   = HandleImpl::AqPtr{stream};
@@ -181,6 +195,8 @@ Handle::Handle(miopenAcceleratorQueue_t stream) : impl(new HandleImpl())
     this->SetAllocator(nullptr, nullptr, nullptr);
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
+    if(precompile_manifest)
+        PrecompileFromManifest(*this, GetProgramsDevice(*this));
 }
 
 static bool PrintOpenCLDeprecateMsg()
@@ -262,10 +278,57 @@ Handle::Handle() : impl(new HandleImpl())
     this->SetAllocator(nullptr, nullptr, nullptr);
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
+    PrecompileFromManifest(*this, GetProgramsDevice(*this));
+}
+
+Handle::Handle(Handle&& other) noexcept
+{
+    // The background tasks reach the handle through its precompiler and its finder, so they
+    // must be done with the old address before anything is moved
+    if(other.precompiler)
+        other.precompiler->WaitAll();
+    if(other.background_finder)
+        other.background_finder->WaitAll();
+
+    m_MaxMemoryAllocSizeCached = other.m_MaxMemoryAllocSizeCached;
+    impl                       = std::move(other.impl);
+    find_map                   = std::move(other.find_map);
+    invokers                   = std::move(other.invokers);
+    precompiler                = std::move(other.precompiler);
+    background_finder          = std::move(other.background_finder);
+    if(precompiler)
+        precompiler->SetOwner(*this);
+    if(background_finder)
+        background_finder->SetOwner(*this);
 }
 
-Handle::Handle(Handle&&) noexcept = default;
-Handle::~Handle()                 = default;
+std::unique_ptr<Handle> Handle::CreateBackgroundHandle() const
+{
+    // OpenCL queues have no priorities. A separate queue of the same context still lets the
+    // work of the background handle run without being measured along with the application.
+    cl_int status = 0;
+#ifdef CL_VERSION_2_0
+    const cl_queue_properties cq_props[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_PROFILING_ENABLE, 0};
+
+    const auto queue = HandleImpl::AqPtr{
+        clCreateCommandQueueWithProperties(impl->context.get(), impl->device, cq_props, &status)};
+#else
+    const auto queue = HandleImpl::AqPtr{clCreateCommandQueue(
+        impl->context.get(), impl->device, CL_QUEUE_PROFILING_ENABLE, &status)};
+#endif
+    if(status != CL_SUCCESS)
+        MIOPEN_THROW("Error creating command queue");
+
+    // The handle retains the queue
+    return std::unique_ptr<Handle>{new Handle(queue.get(), false)};
+}
+
+Handle::~Handle()
+{
+    if(precompiler)
+        precompiler->WaitAll();
+    RamDb::FlushAll();
+}
 
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
 {
@@ -363,8 +426,8 @@ void Handle::ClearKernels(const std::string& algorithm, const std::string& netwo
     this->impl->cache.ClearKernels(algorithm, network_config);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config) const
+std::vector<Kernel> Handle::GetKernelsImpl(const std::string& algorithm,
+                                           const std::string& network_config) const
 {
     return this->impl->cache.GetKernels(algorithm, network_config);
 }
@@ -388,11 +451,44 @@ KernelInvoke Handle::Run(Kernel k, bool coop_launch) const
     }
 }
 
-Program Handle::LoadProgram(const std::string& program_name,
+std::string Handle::GetProgramBuildKey(const fs::path& program_name,
+                                       const std::string& params,
+                                       const std::string& kernel_src,
+                                       bool force_attach_binary) const
+{
+    return KernelBuildService::MakeKey(
+        GetProgramsDevice(*this), program_name, params, kernel_src, force_attach_binary);
+}
+
+Program Handle::LoadProgram(const fs::path& program_name,
                             std::string params,
                             const std::string& kernel_src,
                             bool force_attach_binary) const
 {
+    return KernelBuildService::Get().Build(
+        GetProgramBuildKey(program_name, params, kernel_src, force_attach_binary), [&]() {
+            return BuildProgram(program_name, params, kernel_src, force_attach_binary);
+        });
+}
+
+KernelBuildFuture Handle::LoadProgramAsync(const fs::path& program_name,
+                                           std::string params,
+                                           const std::string& kernel_src,
+                                           bool force_attach_binary) const
+{
+    auto key = GetProgramBuildKey(program_name, params, kernel_src, force_attach_binary);
+    return KernelBuildService::Get().Submit(std::move(key), [=]() {
+        return BuildProgram(program_name, params, kernel_src, force_attach_binary);
+    });
+}
+
+Program Handle::BuildProgram(const fs::path& program_name_,
+                             std::string params,
+                             const std::string& kernel_src,
+                             bool force_attach_binary) const
+{
+    const auto program_name = program_name_.string();
+
     // Binary serialization is not supported on OpenCL anyway
     std::ignore = force_attach_binary;
 
@@ -451,6 +547,17 @@ void Handle::AddProgram(Program prog,
     this->impl->cache.AddProgram(prog, program_name, params);
 }
 
+BinaryPrefetch
+Handle::WarmPrograms(const std::vector<std::pair<fs::path, std::string>>& programs) const
+{
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    return miopen::WarmBinaries(this->GetTargetProperties(), this->GetMaxComputeUnits(), programs);
+#else
+    std::ignore = programs;
+    return {};
+#endif
+}
+
 void Handle::Finish() const { clFinish(this->GetStream()); }
 
 void Handle::Flush() const { clFlush(this->GetStream()); }
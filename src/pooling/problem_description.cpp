@@ -27,64 +27,47 @@
 #include <miopen/pooling/problem_description.hpp>
 #include <miopen/mlo_internal.hpp>
 #include <miopen/pooling.hpp>
-
-#include <sstream>
+#include <miopen/problem_key.hpp>
 
 namespace miopen {
 
 namespace pooling {
 
-namespace {
-
-template <typename T>
-std::string get_vect_config(const std::vector<T>& v)
-{
-    std::string str;
-    for(auto itr = v.begin(); itr < v.end(); itr++)
-    {
-        str += (std::to_string(*itr) + (itr == v.end() - 1 ? "" : "x"));
-    }
-    return str;
-}
-
-} // namespace
-
 NetworkConfig ProblemDescription::MakeNetworkConfig() const
 {
-    std::ostringstream ss;
-
     int pooling_method =
         (pooling.GetMode() == miopenPoolingMax)
             ? MLO_POOLING_OP_MAX
             : ((pooling.GetMode() == miopenPoolingAverage) ? MLO_POOLING_OP_AVE
                                                            : MLO_POOLING_OP_AVE_INCLUSIVE);
 
-    ss << "m" + std::to_string(pooling_method);
-    ss << "_dt" << xDesc.GetType();
-    if(const auto ct = xDesc.GetCastType())
-        ss << "_dct" << GetDataTypeName(*ct);
-    ss << "_ker" << get_vect_config(pooling.lens);
-    ss << "_str" << get_vect_config(pooling.strides);
-    ss << "_pad" << get_vect_config(pooling.pads);
-    ss << "_it" << pooling.GetIndexType();
-    ss << "_im" << pooling.GetWorkspaceIndexMode();
+    auto key = ProblemKey{"pool"};
+    key.Add(direction);
+    key.Add(pooling_method);
+    key.Add(xDesc.GetType());
+    key.AddOptional(xDesc.GetCastType());
+    key.AddRange(pooling.lens);
+    key.AddRange(pooling.strides);
+    key.AddRange(pooling.pads);
+    key.Add(pooling.GetIndexType());
+    key.Add(pooling.GetWorkspaceIndexMode());
     if(direction == Direction::Forward)
     {
-        ss << "_is" << static_cast<int>(save_index);
+        key.Add(save_index);
     }
-    ss << "_xd" << get_vect_config(xDesc.GetLengths());
-    ss << "_xs" << get_vect_config(xDesc.GetStrides());
-    ss << "_yd" << get_vect_config(yDesc.GetLengths());
-    ss << "_ys" << get_vect_config(yDesc.GetStrides());
+    key.AddRange(xDesc.GetLengths());
+    key.AddRange(xDesc.GetStrides());
+    key.AddRange(yDesc.GetLengths());
+    key.AddRange(yDesc.GetStrides());
     if(direction == Direction::Backward)
     {
-        ss << "_dxd" << get_vect_config(dxDesc.GetLengths());
-        ss << "_dxs" << get_vect_config(dxDesc.GetStrides());
-        ss << "_dyd" << get_vect_config(dyDesc.GetLengths());
-        ss << "_dys" << get_vect_config(dyDesc.GetStrides());
+        key.AddRange(dxDesc.GetLengths());
+        key.AddRange(dxDesc.GetStrides());
+        key.AddRange(dyDesc.GetLengths());
+        key.AddRange(dyDesc.GetStrides());
     }
 
-    return NetworkConfig{ss.str()};
+    return NetworkConfig{key};
 }
 
 } // namespace pooling
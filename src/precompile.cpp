@@ -0,0 +1,309 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/precompile.hpp>
+
+#include <miopen/conv/heuristics/ai_heuristics.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/expanduser.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/thread_pool.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_PRECOMPILE_MANIFEST)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK)
+
+namespace miopen {
+
+namespace {
+
+// Background tasks go through the same code as the foreground calls, and must not wait for
+// themselves.
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+thread_local bool in_background_task = false;
+
+} // namespace
+
+BackgroundPrecompiler::~BackgroundPrecompiler()
+{
+    // The tasks refer to the handle, so they must be done before it goes away
+    WaitAll();
+
+    if(stats.queued > 0)
+    {
+        MIOPEN_LOG_I("Precompiled: " << stats.completed << '/' << stats.queued << ", failed: "
+                                     << stats.failed << ", hits: " << stats.hits
+                                     << ", waits: " << stats.waits << ", misses: " << stats.misses);
+    }
+}
+
+void BackgroundPrecompiler::Submit(const NetworkConfig& problem, std::function<void()> task)
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    if(tasks.find(problem) != tasks.end())
+        return;
+
+    ++stats.queued;
+    ++unfinished;
+
+    tasks.emplace(problem, ThreadPool::Get().Submit([this, problem, task = std::move(task)]() {
+        auto failed        = false;
+        in_background_task = true;
+
+        try
+        {
+            task();
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Background compilation of " << problem.ToString()
+                                                      << " has failed: " << ex.what());
+            failed = true;
+        }
+        catch(...)
+        {
+            MIOPEN_LOG_W("Background compilation of " << problem.ToString() << " has failed");
+            failed = true;
+        }
+
+        in_background_task = false;
+        const std::lock_guard<std::mutex> task_lock{mutex};
+        ++(failed ? stats.failed : stats.completed);
+        --unfinished;
+    }));
+}
+
+bool BackgroundPrecompiler::Wait(const NetworkConfig& problem)
+{
+    if(unfinished == 0 || in_background_task)
+        return false;
+
+    auto task = std::shared_future<void>{};
+
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        const auto it = tasks.find(problem);
+        if(it == tasks.end())
+        {
+            ++stats.misses;
+            return false;
+        }
+
+        task = it->second;
+        if(task.wait_for(std::chrono::seconds{0}) == std::future_status::ready)
+        {
+            ++stats.hits;
+            return true;
+        }
+
+        ++stats.waits;
+    }
+
+    MIOPEN_LOG_I2("Waiting for background compilation of " << problem.ToString());
+    task.wait();
+    return true;
+}
+
+void BackgroundPrecompiler::WaitAll()
+{
+    auto pending = std::vector<std::shared_future<void>>{};
+
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        for(const auto& task : tasks)
+            pending.push_back(task.second);
+    }
+
+    for(const auto& task : pending)
+        task.wait();
+}
+
+Handle& BackgroundPrecompiler::GetOwner() const
+{
+    if(owner == nullptr)
+        MIOPEN_THROW("The precompiler doesn't belong to a handle");
+    return *owner;
+}
+
+BackgroundPrecompiler::Stats BackgroundPrecompiler::GetStats() const
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    return stats;
+}
+
+/// Problems missing from the find-db are served by TunaNet, which is cheaper to evaluate for all
+/// of them at once than one problem at a time.
+static void PredictFallbackSolvers(Handle& handle,
+                                   const std::vector<conv::ProblemDescription>& problems)
+{
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+    if(env::disabled(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK))
+        return;
+    const auto ctx = ExecutionContext{&handle};
+    std::ignore    = ai::immed_mode::PredictSolvers(problems, ctx, handle.GetDeviceName());
+#else
+    std::ignore = handle;
+    std::ignore = problems;
+#endif
+}
+
+void PrecompileAsync(Handle& handle, const std::vector<Problem>& problems)
+{
+    const auto conv_problems = std::make_shared<std::vector<conv::ProblemDescription>>();
+    for(const auto& problem : problems)
+    {
+        if(!std::holds_alternative<ConvolutionDescriptor>(problem.GetOperatorDescriptor()))
+        {
+            MIOPEN_LOG_I("Only convolution problems can be precompiled, skipped.");
+            continue;
+        }
+        conv_problems->push_back(problem.AsConvolution());
+    }
+
+    // The first task to run evaluates the heuristics for all the problems
+    const auto once    = std::make_shared<std::once_flag>();
+    const auto predict = [conv_problems, once](Handle& handle) {
+        std::call_once(*once, [&]() { PredictFallbackSolvers(handle, *conv_problems); });
+    };
+
+    // The tasks get the handle from the precompiler, which stays in place when the handle is moved
+    auto& precompiler = handle.GetPrecompiler();
+
+    for(auto conv_problem : *conv_problems)
+    {
+        const auto config = conv_problem.MakeNetworkConfig();
+
+        precompiler.Submit(config, [&precompiler, conv_problem, predict]() mutable {
+            auto& owner = precompiler.GetOwner();
+            predict(owner);
+
+            auto ctx = ExecutionContext{&owner};
+            conv_problem.SetupFloats(ctx);
+
+            // The same lookup as in miopenConvolution*GetSolution, so the precompiled solution is
+            // the one the application is going to get.
+            const auto& conv     = conv_problem.GetConv();
+            const auto solutions = conv.GetSolutions(ctx, conv_problem, 1, nullptr);
+            if(solutions.empty())
+            {
+                MIOPEN_LOG_I("No solutions to precompile for "
+                             << conv_problem.MakeNetworkConfig().ToString());
+                return;
+            }
+
+            conv.CompileSolution(ctx, conv_problem, solver::Id{solutions.front().solution_id});
+        });
+    }
+}
+
+std::optional<NetworkConfig>
+PrecompileFindAsync(Handle& handle, const Problem& problem, bool attach_binaries)
+{
+    const auto* conv_desc = std::get_if<ConvolutionDescriptor>(&problem.GetOperatorDescriptor());
+    if(conv_desc == nullptr)
+        return std::nullopt;
+
+    // Find solves transposed convolutions as the regular ones
+    auto conv_problem = conv_desc->mode == miopenTranspose
+                            ? problem.MakeTransposed().AsConvolution()
+                            : problem.AsConvolution();
+
+    // Find compiles more than the immediate mode, so its tasks are kept apart from the ones of
+    // PrecompileAsync()
+    const auto key = NetworkConfig{"find:" + conv_problem.MakeNetworkConfig().ToString()};
+
+    auto& precompiler = handle.GetPrecompiler();
+    precompiler.Submit(key, [&precompiler, conv_problem, attach_binaries]() mutable {
+        auto ctx = ExecutionContext{&precompiler.GetOwner()};
+        conv_problem.SetupFloats(ctx);
+        PrecompileConvolution(ctx, conv_problem, attach_binaries);
+    });
+
+    return key;
+}
+
+std::vector<Problem> LoadPrecompileManifest(const fs::path& path)
+{
+    auto file = std::ifstream{path};
+    if(!file)
+        MIOPEN_THROW(miopenStatusBadParm, "Unable to read the precompile manifest " + path);
+
+    try
+    {
+        return nlohmann::json::parse(file).get<std::vector<Problem>>();
+    }
+    catch(const nlohmann::json::exception& ex)
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Ill-formed precompile manifest " + path + ": " + ex.what());
+    }
+}
+
+void PrecompileFromManifest(Handle& handle, const std::string& device)
+{
+    const auto& manifest = env::value(MIOPEN_PRECOMPILE_MANIFEST);
+    if(manifest.empty())
+        return;
+
+    {
+        // The compiled programs are shared by the handles of the device, or stay in the binary
+        // cache, so the other handles, e.g. the ones created for background searches, don't need
+        // to compile them again.
+        static std::mutex mutex;
+        static std::unordered_set<std::string> done;
+        const std::lock_guard<std::mutex> lock{mutex};
+        if(!done.insert(device).second)
+            return;
+    }
+
+    // A broken manifest must not prevent the handle from being created
+    try
+    {
+        const auto problems = LoadPrecompileManifest(ExpandUser(manifest));
+        MIOPEN_LOG_I("Precompiling " << problems.size() << " problems from " << manifest);
+        PrecompileAsync(handle, problems);
+    }
+    catch(const Exception& ex)
+    {
+        MIOPEN_LOG_W(ex.what());
+    }
+}
+
+} // namespace miopen
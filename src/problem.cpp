@@ -44,6 +44,7 @@
 #include <miopen/handle.hpp>
 #include <miopen/mlo_internal.hpp>
 #include <miopen/perf_field.hpp>
+#include <miopen/precompile.hpp>
 #include <miopen/solution.hpp>
 #include <miopen/search_options.hpp>
 #include <miopen/tensor_ops.hpp>
@@ -991,6 +992,84 @@ std::vector<Solution> FusedProblem::FindSolutions(Handle& handle,
     return solutions;
 }
 
+// Tensors are kept in unordered maps, so identical problems may list them in different orders
+static void SortTensors(nlohmann::json& json)
+{
+    if(json.is_object())
+    {
+        const auto tensors = json.find("tensors");
+        if(tensors != json.end() && tensors->is_array())
+            std::sort(tensors->begin(), tensors->end());
+    }
+
+    if(json.is_structured())
+    {
+        for(auto& item : json)
+            SortTensors(item);
+    }
+}
+
+std::vector<std::size_t>
+GetFirstIdenticalProblems(const std::vector<ProblemContainer::Item>& problems)
+{
+    auto first = std::unordered_map<std::string, std::size_t>{};
+    auto ret   = std::vector<std::size_t>{};
+    ret.reserve(problems.size());
+
+    for(std::size_t i = 0; i < problems.size(); ++i)
+    {
+        auto json = std::visit([](auto&& p) { return nlohmann::json(p); }, problems[i]);
+        SortTensors(json);
+        const auto key = std::to_string(problems[i].index()) + ':' + json.dump();
+        ret.push_back(first.emplace(key, i).first->second);
+    }
+
+    return ret;
+}
+
+std::vector<std::vector<Solution>>
+FindSolutionsBatch(Handle& handle,
+                   const std::vector<ProblemContainer::Item>& problems,
+                   const FindOptions& options,
+                   std::size_t max_solutions)
+{
+    const auto first = GetFirstIdenticalProblems(problems);
+
+    // Compilation is queued in the order of the search, so the first problems are ready first
+    // and their search overlaps with the compilation of the following ones.
+    auto compiled = std::vector<std::optional<NetworkConfig>>(problems.size());
+    auto unique   = std::size_t{0};
+    for(std::size_t i = 0; i < problems.size(); ++i)
+    {
+        if(first[i] != i)
+            continue;
+        ++unique;
+        if(const auto* problem = std::get_if<Problem>(&problems[i]))
+            compiled[i] = PrecompileFindAsync(handle, *problem, options.attach_binaries);
+    }
+
+    auto ret = std::vector<std::vector<Solution>>(problems.size());
+    for(std::size_t i = 0; i < problems.size(); ++i)
+    {
+        if(first[i] != i)
+        {
+            ret[i] = ret[first[i]];
+            continue;
+        }
+
+        if(compiled[i])
+            std::ignore = handle.GetPrecompiler().Wait(*compiled[i]);
+
+        ret[i] = std::visit(
+            [&](auto&& problem) { return problem.FindSolutions(handle, options, max_solutions); },
+            problems[i]);
+        ret[i].resize(std::min(ret[i].size(), max_solutions));
+    }
+
+    MIOPEN_LOG_I("Searched " << unique << " unique problems of " << problems.size());
+    return ret;
+}
+
 void FusedProblem::AddProblemToPlan(FusionPlanDescriptor& plan, const Problem& problem)
 {
     std::visit(
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/problem_key.hpp>
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+namespace miopen {
+
+const ProblemKey& ProblemKey::Intern(const ProblemKey& key)
+{
+    struct Hash
+    {
+        std::size_t operator()(const ProblemKey& k) const { return k.Hash(); }
+    };
+
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::shared_mutex mutex;
+    // Nodes of the set don't move, so the references stay valid
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::unordered_set<ProblemKey, Hash> keys;
+
+    {
+        const std::shared_lock<std::shared_mutex> lock{mutex};
+        const auto it = keys.find(key);
+        if(it != keys.end())
+            return *it;
+    }
+
+    const std::unique_lock<std::shared_mutex> lock{mutex};
+    return *keys.insert(key).first;
+}
+
+} // namespace miopen
@@ -26,19 +26,26 @@
 
 #include <miopen/ramdb.hpp>
 
+#include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
 
 #include <miopen/filesystem.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <limits>
 #include <map>
 #include <mutex>
 #include <sstream>
+#include <tuple>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_USER_DB_WRITE_BATCH_SIZE)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_USER_DB_WRITE_BATCH_MS, 10000)
 
 namespace miopen {
 
@@ -86,27 +93,77 @@ static std::chrono::seconds GetLockTimeout() { return std::chrono::seconds{60};
 
 using exclusive_lock = std::unique_lock<LockFile>;
 
+/// Number of instances with pending records. Lets FlushAll return without touching the instances
+/// when nothing is batched, which is always the case unless batching has been enabled.
+static std::atomic<std::size_t>& InstancesWithPendingRecords()
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::atomic<std::size_t> count{0};
+    return count;
+}
+
 RamDb::RamDb(DbKinds db_kind_, const fs::path& path, bool is_system)
     : PlainTextDb(db_kind_, path, is_system)
 {
+    SetWriteBatch(env::value(MIOPEN_USER_DB_WRITE_BATCH_SIZE),
+                  std::chrono::milliseconds{env::value(MIOPEN_USER_DB_WRITE_BATCH_MS)});
 }
 
-RamDb& RamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool is_system)
+RamDb::~RamDb()
+{
+    try
+    {
+        Flush();
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_E("Unable to flush " << GetFileName() << ": " << ex.what());
+    }
+
+    if(!pending.empty())
+    {
+        MIOPEN_LOG_E("Lost " << pending.size() << " pending records of " << GetFileName());
+        --InstancesWithPendingRecords();
+    }
+}
+
+namespace {
+
+struct RamDbInstances
+{
+    std::mutex mutex;
+    std::map<fs::path, std::unique_ptr<RamDb>> map;
+};
+
+RamDbInstances& GetInstances()
 {
     // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static std::mutex mutex;
-    const std::lock_guard<std::mutex> lock{mutex};
+    static RamDbInstances instances;
+    return instances;
+}
+
+} // namespace
+
+RamDb& RamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool is_system)
+{
+    auto& instances = GetInstances();
+    const std::lock_guard<std::mutex> lock{instances.mutex};
 
     // We don't have to store kind to properly index as different dbs would have different paths
-    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static auto instances = std::map<fs::path, std::unique_ptr<RamDb>>{};
-    const auto it         = instances.find(path);
+    const auto it = instances.map.find(path);
 
-    if(it != instances.end())
+    if(it != instances.map.end())
         return *it->second;
 
     auto& instance =
-        *instances.emplace(path, std::make_unique<RamDb>(db_kind_, path, is_system)).first->second;
+        *instances.map.emplace(path, std::make_unique<RamDb>(db_kind_, path, is_system))
+             .first->second;
+
+    // Registered after the first instance (and the lock files it uses) has been constructed, so
+    // the batches are written before any of those is destroyed at exit.
+    static const auto flush_at_exit_registered = std::atexit([]() { RamDb::FlushAll(); }) == 0;
+    std::ignore                                = flush_at_exit_registered;
+
     if constexpr(!DisableUserDbFileIO)
     {
         const auto prefetch_lock = exclusive_lock(instance.GetLockFile(), GetLockTimeout());
@@ -116,6 +173,40 @@ RamDb& RamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool is_system)
     return instance;
 }
 
+void RamDb::FlushAll()
+{
+    if(InstancesWithPendingRecords() == 0)
+        return;
+
+    auto& instances = GetInstances();
+    const std::lock_guard<std::mutex> lock{instances.mutex};
+
+    for(auto& instance : instances.map)
+    {
+        try
+        {
+            instance.second->Flush();
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_E("Unable to flush " << instance.first << ": " << ex.what());
+        }
+    }
+}
+
+void RamDb::SetWriteBatch(std::size_t max_records, std::chrono::milliseconds max_delay)
+{
+    write_batch_size  = max_records;
+    write_batch_delay = max_delay;
+}
+
+bool RamDb::Flush()
+{
+    const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
+    MIOPEN_VALIDATE_LOCK(lock);
+    return pending.empty() || WriteBatchUnsafe();
+}
+
 boost::optional<DbRecord> RamDb::FindRecord(const std::string& problem)
 {
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
@@ -127,6 +218,10 @@ boost::optional<DbRecord> RamDb::FindRecord(const std::string& problem)
         Prefetch();
     }
 
+    // Reads are far more frequent than writes, so they also write a batch that is overdue.
+    if(IsBatchDueUnsafe())
+        WriteBatchUnsafe();
+
     return FindRecordUnsafe(problem);
 }
 
@@ -138,6 +233,13 @@ bool RamDb::StoreRecord(const DbRecord& record)
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
+    if(IsBatchingWrites())
+    {
+        if(!ValidateUnsafe())
+            Prefetch();
+        return AddPendingUnsafe(record, false);
+    }
+
     if constexpr(!DisableUserDbFileIO)
     {
         if(!StoreRecordUnsafe(record))
@@ -161,6 +263,16 @@ bool RamDb::UpdateRecord(DbRecord& record)
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
+    if(IsBatchingWrites())
+    {
+        if(!ValidateUnsafe())
+            Prefetch();
+        const auto old_record = FindRecordUnsafe(key);
+        if(old_record)
+            record.Merge(*old_record);
+        return AddPendingUnsafe(record, true);
+    }
+
     if constexpr(!DisableUserDbFileIO)
     {
         if(!UpdateRecordUnsafe(record))
@@ -183,6 +295,10 @@ bool RamDb::RemoveRecord(const std::string& key)
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
+    // Removal is rare, so it is simpler to write the batch and go the regular way.
+    if(!pending.empty() && !WriteBatchUnsafe())
+        return false;
+
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
     const auto is_valid = ValidateUnsafe();
 #endif
@@ -214,6 +330,9 @@ bool RamDb::Remove(const std::string& key, const std::string& id)
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
+    if(!pending.empty() && !WriteBatchUnsafe())
+        return false;
+
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
     const auto is_valid = ValidateUnsafe();
 #endif
@@ -279,7 +398,7 @@ template <class TFunc>
 static void Measure(const std::string& funcName, TFunc&& func)
 {
     if(!miopen::IsLogging(LoggingLevel::Info))
-        func();
+        return func();
 
     const auto start = std::chrono::high_resolution_clock::now();
     func();
@@ -292,7 +411,7 @@ bool RamDb::ValidateUnsafe()
     if(DisableUserDbFileIO)
         return true;
     if(!fs::exists(GetFileName()))
-        return cache.empty();
+        return cache.size() == pending.size(); // Every pending record has its cache entry.
     const auto file_mod_time     = GetDbModificationTime(GetFileName());
     const auto validation_result = file_mod_time < file_read_time;
     MIOPEN_LOG_I2("DB file is " << (validation_result ? "older" : "newer")
@@ -346,6 +465,113 @@ void RamDb::Prefetch()
 
         file_read_time = ramdb_clock::now();
     });
+
+    // The file has been changed by someone else, the batch has to be laid over the new contents.
+    ApplyPendingUnsafe();
+}
+
+void RamDb::SetCacheEntryUnsafe(const DbRecord& record)
+{
+    auto ss = std::ostringstream{};
+    record.WriteIdsAndValues(ss);
+    auto content = ss.str();
+    if(!content.empty() && content.back() == '\n')
+        content.pop_back();
+
+    const auto it = cache.find(record.GetKey());
+    if(it != cache.end())
+        it->second.content = std::move(content);
+    else
+        cache.emplace(record.GetKey(), CacheItem{-1, std::move(content)});
+}
+
+bool RamDb::IsBatchDueUnsafe() const
+{
+    return !pending.empty() && (pending.size() >= write_batch_size ||
+                                ramdb_clock::now() - first_pending_time >= write_batch_delay);
+}
+
+bool RamDb::AddPendingUnsafe(const DbRecord& record, bool merge)
+{
+    if(pending.empty())
+    {
+        first_pending_time = ramdb_clock::now();
+        ++InstancesWithPendingRecords();
+    }
+
+    const auto it = pending.find(record.GetKey());
+    if(it == pending.end())
+        pending.emplace(record.GetKey(), PendingRecord{record, merge});
+    else
+        // A store followed by an update of the same key is still a store.
+        it->second = PendingRecord{record, merge && it->second.merge};
+
+    SetCacheEntryUnsafe(record);
+
+    return !IsBatchDueUnsafe() || WriteBatchUnsafe();
+}
+
+void RamDb::ApplyPendingUnsafe()
+{
+    for(auto& item : pending)
+    {
+        auto& pending_record = item.second;
+
+        if(pending_record.merge)
+        {
+            const auto old_record = FindRecordUnsafe(item.first);
+            if(old_record)
+                pending_record.record.Merge(*old_record);
+        }
+
+        SetCacheEntryUnsafe(pending_record.record);
+    }
+}
+
+bool RamDb::WriteBatchUnsafe()
+{
+    if(pending.empty())
+        return true;
+
+    MIOPEN_LOG_I2("Writing " << pending.size() << " pending records to " << GetFileName());
+
+    if(!ValidateUnsafe())
+        Prefetch();
+
+    const auto& filename = GetFileName();
+    const auto temp_name = filename + ".temp";
+
+    {
+        auto file = std::ofstream{temp_name, std::ios::binary | std::ios::trunc};
+
+        if(!file)
+        {
+            MIOPEN_LOG_E("Temp file is unwritable: " << temp_name);
+            return false;
+        }
+
+        for(const auto& item : cache)
+        {
+            if(!item.second.content.empty())
+                file << item.first << '=' << item.second.content << '\n';
+        }
+
+        if(!file.flush())
+        {
+            MIOPEN_LOG_E("Error writing temp file: " << temp_name);
+            return false;
+        }
+    }
+
+    // Unlike remove+rename, rename alone replaces the file atomically, so there is no moment
+    // when the db is missing or truncated.
+    fs::rename(temp_name, filename);
+    fs::permissions(filename, FS_ENUM_PERMS_ALL);
+    UpdateDbModificationTime(filename);
+    file_read_time = ramdb_clock::now();
+    pending.clear();
+    --InstancesWithPendingRecords();
+    return true;
 }
 
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
@@ -25,18 +25,25 @@
  *******************************************************************************/
 
 #include <miopen/readonlyramdb.hpp>
+#include <miopen/env.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/expanduser.hpp>
 #include <miopen/filesystem.hpp>
 
 #if MIOPEN_EMBED_DB
 #include <miopen_data.hpp>
 #endif
 
+#include <array>
 #include <fstream>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
-#include <map>
+#include <unordered_map>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_SYSDB_INDEX)
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_SYSDB_SNAPSHOT_DIR)
 
 namespace miopen {
 
@@ -49,25 +56,79 @@ bool& rordb_embed_fs_override()
 }
 } // namespace debug
 
+namespace {
+
+/// Instances are never removed, so the registry is split into shards that are only locked to find
+/// or insert an entry. Loading the db happens outside of the shard lock, under a per-path once
+/// flag, so a slow load of one file does not block lookups or loads of other files.
+class ReadonlyRamDbRegistry
+{
+public:
+    struct Entry
+    {
+        std::once_flag loaded;
+        std::unique_ptr<ReadonlyRamDb> instance;
+    };
+
+    static ReadonlyRamDbRegistry& Instance()
+    {
+        static ReadonlyRamDbRegistry registry;
+        return registry;
+    }
+
+    Entry& GetEntry(const std::string& path)
+    {
+        auto& shard = shards[std::hash<std::string>{}(path) % shards.size()];
+
+        {
+            const std::shared_lock<std::shared_mutex> lock{shard.mutex};
+            const auto it = shard.entries.find(path);
+            if(it != shard.entries.end())
+                return *it->second;
+        }
+
+        const std::unique_lock<std::shared_mutex> lock{shard.mutex};
+        auto& entry = shard.entries[path];
+        if(!entry)
+            entry = std::make_unique<Entry>();
+        return *entry;
+    }
+
+private:
+    struct Shard
+    {
+        std::shared_mutex mutex;
+        std::unordered_map<std::string, std::unique_ptr<Entry>> entries;
+    };
+
+    std::array<Shard, 16> shards;
+};
+
+} // namespace
+
 ReadonlyRamDb&
 ReadonlyRamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable)
 {
-    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static std::mutex mutex;
-    const std::lock_guard<std::mutex> lock{mutex};
-
     // We don't have to store kind to properly index as different dbs would have different paths
-    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
-    static auto instances = std::map<fs::path, std::unique_ptr<ReadonlyRamDb>>{};
-    const auto it         = instances.find(path);
+    const auto key = path.string();
 
-    if(it != instances.end())
+    // Fast path: the instances are immortal, so each thread may keep its own view of the registry
+    // and hit it without any synchronization.
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    thread_local auto local_instances = std::unordered_map<std::string, ReadonlyRamDb*>{};
+    const auto it                     = local_instances.find(key);
+    if(it != local_instances.end())
         return *it->second;
 
-    auto& instance =
-        *instances.emplace(path, std::make_unique<ReadonlyRamDb>(db_kind_, path)).first->second;
-    instance.Prefetch(warn_if_unreadable);
-    return instance;
+    auto& entry = ReadonlyRamDbRegistry::Instance().GetEntry(key);
+    std::call_once(entry.loaded, [&]() {
+        auto instance = std::make_unique<ReadonlyRamDb>(db_kind_, path);
+        instance->Prefetch(warn_if_unreadable);
+        entry.instance = std::move(instance);
+    });
+
+    local_instances.emplace(key, entry.instance.get());
+    return *entry.instance;
 }
 
 template <class TFunc>
@@ -145,9 +206,44 @@ void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
         }
         else
         {
+            if(!env::disabled(MIOPEN_DEBUG_SYSDB_INDEX))
+            {
+                mapped = MappedDb::Open(db_kind, MappedDb::GetPath(db_path), db_path);
+                if(mapped)
+                    return;
+            }
+
+            // Processes that share the snapshot directory parse the text db only once.
+            const auto& snapshot_dir = env::value(MIOPEN_SYSDB_SNAPSHOT_DIR);
+            if(!snapshot_dir.empty())
+            {
+                mapped = MappedDb::OpenSnapshot(db_kind, ExpandUser(snapshot_dir), db_path);
+                if(mapped)
+                    return;
+            }
+
             auto input_stream = std::ifstream{db_path};
             ParseAndLoadDb(input_stream, warn_if_unreadable);
         }
     });
 }
+
+const std::unordered_map<std::string, ReadonlyRamDb::CacheItem>& ReadonlyRamDb::GetCacheMap() const
+{
+    if(mapped)
+    {
+        std::call_once(cache_from_mapped, [this]() {
+            for(auto i = std::size_t{0}; i < mapped->GetSize(); ++i)
+            {
+                auto contents = std::ostringstream{};
+                mapped->GetRecord(i).WriteIdsAndValues(contents);
+                auto str = contents.str();
+                if(!str.empty() && str.back() == '\n')
+                    str.pop_back();
+                cache.emplace(mapped->GetKey(i), CacheItem{mapped->GetLine(i), std::move(str)});
+            }
+        });
+    }
+    return cache;
+}
 } // namespace miopen
@@ -27,9 +27,7 @@
 #include <miopen/datatype.hpp>
 #include <miopen/softmax/problem_description.hpp>
 #include <miopen/names.hpp>
-
-#include <sstream>
-#include <string_view>
+#include <miopen/problem_key.hpp>
 
 namespace miopen {
 
@@ -37,44 +35,44 @@ namespace softmax {
 
 NetworkConfig ProblemDescription::MakeNetworkConfig() const
 {
-    std::ostringstream ss(isForward ? "sfmfwd-" : "sfmbwd-");
+    auto key = ProblemKey{isForward ? "sfmfwd" : "sfmbwd"};
 
     // all the tensors must be the same size and types
     // so we can use only one set of values
     const auto& desc            = isForward ? xdxDesc : yDesc;
     const auto [sn, sc, sh, sw] = tien<4>(desc.GetLengths());
-    ss << "n" << sn << "c" << sc << "h" << sh << "w" << sw;
-    ss << GetDataType(desc.GetType());
-    ss << "a" << alpha;
-    ss << "b" << beta;
-    ss << "algo" << static_cast<int>(algorithm);
-    ss << "mode" << static_cast<int>(mode);
+    key.Add(sn).Add(sc).Add(sh).Add(sw);
+    key.Add(desc.GetType());
+    key.Add(alpha);
+    key.Add(beta);
+    key.Add(algorithm);
+    key.Add(mode);
 
-    auto printStrides = [&ss](std::string_view name, const miopen::TensorDescriptor& d) {
+    auto addStrides = [&key](const miopen::TensorDescriptor& d) {
         if(d.IsPacked())
         {
-            ss << name << "pk1";
+            key.Add(1);
         }
         else
         {
             const auto [n, c, h, w] = tien<4>(d.GetStrides());
-            ss << name << "pk0strides" << n << "x" << c << "x" << h << "x" << w;
+            key.Add(0).Add(n).Add(c).Add(h).Add(w);
         }
     };
 
     if(isForward)
     {
-        printStrides("x", xdxDesc);
-        printStrides("y", yDesc);
+        addStrides(xdxDesc);
+        addStrides(yDesc);
     }
     else
     {
-        printStrides("y", yDesc);
-        printStrides("dy", dyDesc);
-        printStrides("dx", xdxDesc);
+        addStrides(yDesc);
+        addStrides(dyDesc);
+        addStrides(xdxDesc);
     }
 
-    return NetworkConfig{ss.str()};
+    return NetworkConfig{key};
 }
 
 } // namespace softmax
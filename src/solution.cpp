@@ -232,7 +232,7 @@ void Solution::RunImpl(Handle& handle,
         return;
     }
 
-    const auto net_cfg       = conv_problem.BuildConfKey();
+    const auto net_cfg       = conv_problem.MakeNetworkConfig();
     const auto found_invoker = handle.GetInvoker(net_cfg, GetSolver());
 
     if(found_invoker)
@@ -664,14 +664,15 @@ namespace header {
 inline constexpr const char* Validation = "validation";
 inline constexpr const char* Version    = "version";
 } // namespace header
-inline constexpr const char* Header    = "header";
-inline constexpr const char* Time      = "time";
-inline constexpr const char* Workspace = "workspace";
-inline constexpr const char* Solver    = "solver";
-inline constexpr const char* Problem   = "problem";
-inline constexpr const char* PerfCfg   = "perf_cfg";
-inline constexpr const char* Binaries  = "binaries";
-inline constexpr const char* Kernels   = "kernels";
+inline constexpr const char* Header     = "header";
+inline constexpr const char* Time       = "time";
+inline constexpr const char* TimeStdDev = "time_stddev";
+inline constexpr const char* Workspace  = "workspace";
+inline constexpr const char* Solver     = "solver";
+inline constexpr const char* Problem    = "problem";
+inline constexpr const char* PerfCfg    = "perf_cfg";
+inline constexpr const char* Binaries   = "binaries";
+inline constexpr const char* Kernels    = "kernels";
 namespace kernels {
 inline constexpr const char* Name           = "name";
 inline constexpr const char* File           = "file";
@@ -736,6 +737,7 @@ void to_json(nlohmann::json& json, const Solution& solution)
     json = nlohmann::json{
         {fields::Header, Solution::SerializationMetadata::Current()},
         {fields::Time, solution.time},
+        {fields::TimeStdDev, solution.time_stddev},
         {fields::Workspace, solution.workspace_required},
         {fields::Solver, solution.solver.ToString()},
         {fields::Problem, solution.problem},
@@ -850,6 +852,9 @@ void from_json(const nlohmann::json& json, Solution& solution)
     }
 
     json.at(fields::Time).get_to(solution.time);
+    // Solutions serialized before the spread of the time was kept do not have it
+    const auto time_stddev_json = json.find(fields::TimeStdDev);
+    solution.time_stddev = time_stddev_json != json.end() ? time_stddev_json->get<float>() : 0.0f;
     json.at(fields::Workspace).get_to(solution.workspace_required);
     solution.solver = json.at(fields::Solver).get<std::string>();
     json.at(fields::Problem).get_to(solution.problem);
@@ -48,12 +48,13 @@
 #include <miopen/db.hpp>
 #include <miopen/env.hpp>
 #include <miopen/solver_id.hpp>
-#include <miopen/par_for.hpp>
+#include <miopen/kernel_build_service.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/any_solver.hpp>
 #include <miopen/timer.hpp>
 
 #include <boost/range/adaptor/transformed.hpp>
+#include <exception>
 #include <ostream>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_DEPRECATED_SOLVERS)
@@ -86,14 +87,38 @@ PrecompileKernels(const Handle& h, const std::vector<KernelInfo>& kernels, bool
     CompileTimer ct;
     std::vector<Program> programs(kernels.size());
 
-    // clang-format off
-    par_for_strided(kernels.size(),
-                    max_threads{GetTuningThreadsMax()},
-                    [&](auto i) {
-                        const KernelInfo& k = kernels[i];
-                        programs[i]         = h.LoadProgram(k.kernel_file, k.comp_options, "", force_attach_binary);
-                    });
-    // clang-format on
+    // Read and unpack the cached binaries in bulk instead of one by one in LoadProgram()
+    std::vector<std::pair<fs::path, std::string>> cached;
+    cached.reserve(kernels.size());
+    for(const auto& k : kernels)
+        cached.emplace_back(k.kernel_file, k.comp_options);
+    // Binaries that the builds below don't take, e.g. those of programs built by another thread,
+    // are dropped when this goes out of scope.
+    const auto prefetch = h.WarmPrograms(cached);
+
+    // Duplicates and programs being built by other threads share one build. The caller builds
+    // the programs no worker has picked up yet while it waits.
+    std::vector<KernelBuildFuture> builds;
+    builds.reserve(kernels.size());
+    for(const auto& k : kernels)
+        builds.push_back(
+            h.LoadProgramAsync(k.kernel_file, k.comp_options, "", force_attach_binary));
+    // The builds refer to the handle, so all of them have to be done before an error is thrown
+    std::exception_ptr error;
+    for(std::size_t i = 0; i < builds.size(); ++i)
+    {
+        try
+        {
+            programs[i] = builds[i].get();
+        }
+        catch(...)
+        {
+            if(!error)
+                error = std::current_exception();
+        }
+    }
+    if(error)
+        std::rethrow_exception(error);
     ct.Log("PrecompileKernels");
     return programs;
 }
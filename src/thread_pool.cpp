@@ -0,0 +1,279 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/thread_pool.hpp>
+
+#include <miopen/env.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <exception>
+
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_THREAD_POOL_SIZE)
+
+namespace miopen {
+
+namespace {
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+thread_local const ThreadPool* current_pool = nullptr;
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+thread_local std::size_t current_worker = 0;
+
+} // namespace
+
+ThreadPool& ThreadPool::Get()
+{
+    static ThreadPool instance{[]() -> std::size_t {
+        const auto size = env::value(MIOPEN_THREAD_POOL_SIZE);
+        if(size > 0)
+            return size;
+        return std::max(1u, std::thread::hardware_concurrency());
+    }()};
+    return instance;
+}
+
+ThreadPool::ThreadPool(std::size_t threads)
+{
+    threads = std::max<std::size_t>(threads, 1);
+    for(std::size_t i = 0; i < threads; ++i)
+        queues.emplace_back(std::make_unique<Queue>());
+    workers.reserve(threads);
+    for(std::size_t i = 0; i < threads; ++i)
+        workers.emplace_back([this, i]() { Work(i); });
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        stop = true;
+    }
+    wakeup.notify_all();
+    for(auto& worker : workers)
+        worker.join();
+}
+
+void ThreadPool::Post(Task task)
+{
+    const auto idx = current_pool == this ? current_worker : next++ % queues.size();
+
+    {
+        auto& queue = *queues[idx];
+        const std::lock_guard<std::mutex> lock{queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+
+    // Counted only once queued, so a worker that has reserved it is sure to find it
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+        ++pending;
+    }
+
+    wakeup.notify_one();
+}
+
+bool ThreadPool::TryPop(std::size_t idx, Task& task)
+{
+    // Tasks are taken in the order they were queued, so that a long running task doesn't delay
+    // the ones that were queued before it. Own queue first, then steal from the others.
+    for(std::size_t i = 0; i < queues.size(); ++i)
+    {
+        auto& queue = *queues[(idx + i) % queues.size()];
+        const std::lock_guard<std::mutex> lock{queue.mutex};
+        if(!queue.tasks.empty())
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::Work(std::size_t idx)
+{
+    current_pool   = this;
+    current_worker = idx;
+
+    for(;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            wakeup.wait(lock, [&]() { return stop || pending > 0; });
+            if(pending == 0)
+                return;
+            // A task is reserved before it is popped, so it can't be taken twice
+            --pending;
+        }
+
+        auto task        = Task{};
+        const auto found = TryPop(idx, task);
+        assert(found);
+        if(found)
+            task();
+    }
+}
+
+namespace {
+
+struct ParallelForState
+{
+    std::atomic<std::size_t> next{0};
+    std::size_t n           = 0;
+    std::size_t parallelism = 1;
+    std::size_t min_chunk   = 1;
+    bool guided             = false;
+    const std::function<void(std::size_t, std::size_t)>* f = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable done;
+    std::size_t running = 0;
+    bool closed         = false;
+    std::exception_ptr error;
+
+    bool Grab(std::size_t& begin, std::size_t& end)
+    {
+        if(!guided)
+        {
+            begin = next++;
+            end   = begin + 1;
+            return begin < n;
+        }
+
+        // Guided scheduling: every range is a share of what is left
+        begin = next.load();
+        std::size_t chunk;
+        do
+        {
+            if(begin >= n)
+                return false;
+            chunk = std::max(min_chunk, (n - begin) / (2 * parallelism));
+        } while(!next.compare_exchange_weak(begin, begin + chunk));
+        end = std::min(n, begin + chunk);
+        return true;
+    }
+
+    void Run()
+    {
+        std::size_t begin, end;
+        while(Grab(begin, end))
+        {
+            try
+            {
+                (*f)(begin, end);
+            }
+            catch(...)
+            {
+                const std::lock_guard<std::mutex> lock{mutex};
+                if(!error)
+                    error = std::current_exception();
+                // Skip the rest of the work
+                next = n;
+            }
+        }
+    }
+};
+
+} // namespace
+
+void ThreadPool::ParallelFor(std::size_t n,
+                             std::size_t parallelism,
+                             const std::function<void(std::size_t)>& f)
+{
+    ParallelForImpl(n, parallelism, 1, false, [&](std::size_t begin, std::size_t end) {
+        for(auto i = begin; i < end; ++i)
+            f(i);
+    });
+}
+
+void ThreadPool::ParallelForRanges(std::size_t n,
+                                   std::size_t parallelism,
+                                   std::size_t min_chunk,
+                                   const std::function<void(std::size_t, std::size_t)>& f)
+{
+    ParallelForImpl(n, parallelism, std::max<std::size_t>(min_chunk, 1), true, f);
+}
+
+void ThreadPool::ParallelForImpl(std::size_t n,
+                                 std::size_t parallelism,
+                                 std::size_t min_chunk,
+                                 bool guided,
+                                 const std::function<void(std::size_t, std::size_t)>& f)
+{
+    if(n == 0)
+        return;
+
+    parallelism = std::min({parallelism, (n + min_chunk - 1) / min_chunk, Size() + 1});
+    if(parallelism <= 1)
+    {
+        f(0, n);
+        return;
+    }
+
+    auto state         = std::make_shared<ParallelForState>();
+    state->n           = n;
+    state->parallelism = parallelism;
+    state->min_chunk   = min_chunk;
+    state->guided      = guided;
+    state->f           = &f;
+
+    // Helpers that start after the work is done must not touch f, which may be gone by then
+    for(std::size_t i = 1; i < parallelism; ++i)
+    {
+        Post([state]() {
+            {
+                const std::lock_guard<std::mutex> lock{state->mutex};
+                if(state->closed)
+                    return;
+                ++state->running;
+            }
+
+            state->Run();
+
+            {
+                const std::lock_guard<std::mutex> lock{state->mutex};
+                --state->running;
+            }
+            state->done.notify_all();
+        });
+    }
+
+    // The calling thread takes part, so it is never blocked by busy workers, even when called
+    // from a worker of this pool.
+    state->Run();
+
+    std::unique_lock<std::mutex> lock{state->mutex};
+    state->closed = true;
+    state->done.wait(lock, [&]() { return state->running == 0; });
+
+    if(state->error)
+        std::rethrow_exception(state->error);
+}
+
+} // namespace miopen
@@ -125,6 +125,33 @@ struct ford_impl
 
 static constexpr ford_wrapper<ford_impl> ford{};
 
+/// Index of the given position in the row-major order of a space.
+template <std::size_t N>
+std::array<std::size_t, N> ford_decode(const std::array<std::size_t, N>& lens, std::size_t i)
+{
+    std::array<std::size_t, N> indices{};
+    for(std::size_t d = N; d-- > 0;)
+    {
+        indices[d] = i % lens[d];
+        i /= lens[d];
+    }
+    return indices;
+}
+
+/// Moves to the next index in the row-major order of a space.
+template <std::size_t N>
+void ford_increment(const std::array<std::size_t, N>& lens, std::array<std::size_t, N>& indices)
+{
+    for(std::size_t d = N; d-- > 0;)
+    {
+        if(++indices[d] < lens[d])
+            return;
+        indices[d] = 0;
+    }
+}
+
+/// Calls f(i0, i1, ...) for every index of the space on the shared thread pool. Every thread
+/// takes ranges of consecutive indices and steps through them, instead of decoding every index.
 struct par_ford_impl
 {
     template <class F, class... Ts>
@@ -132,24 +159,70 @@ struct par_ford_impl
     {
         using array_type = std::array<std::size_t, sizeof...(Ts)>;
         array_type lens  = {{static_cast<std::size_t>(xs)...}};
-        array_type strides;
-        strides.fill(1);
-        std::partial_sum(
-            lens.rbegin(), lens.rend() - 1, strides.rbegin() + 1, std::multiplies<std::size_t>());
-        auto size = std::accumulate(
+        auto size        = std::accumulate(
             lens.begin(), lens.end(), static_cast<std::size_t>(1), std::multiplies<std::size_t>());
-        par_for(size, [&](std::size_t i) {
-            array_type indices;
-            std::transform(strides.begin(),
-                           strides.end(),
-                           lens.begin(),
-                           indices.begin(),
-                           [&](size_t stride, size_t len) { return (i / stride) % len; });
-            miopen::unpack(f, indices);
+        miopen::par_for_ranges(size, [&](std::size_t begin, std::size_t end) {
+            auto indices = ford_decode(lens, begin);
+            for(auto i = begin; i < end; i++)
+            {
+                miopen::unpack(f, indices);
+                ford_increment(lens, indices);
+            }
         });
     }
 };
 
 static constexpr ford_wrapper<par_ford_impl> par_ford{};
 
+/// Like par_ford, but the last two dimensions are visited in square tiles, each by one thread.
+/// Meant for reference helpers which read rows of one operand and columns of another, like
+/// matrix products, so that the data used for a tile stays in the cache.
+struct par_ford_tiled_impl
+{
+    static constexpr std::size_t tile = 16;
+
+    template <class F, class... Ts>
+    void operator()(F f, Ts... xs) const
+    {
+        constexpr auto dims = sizeof...(Ts);
+        if constexpr(dims < 2)
+        {
+            par_ford_impl{}(f, xs...);
+        }
+        else
+        {
+            using array_type = std::array<std::size_t, dims>;
+            array_type lens  = {{static_cast<std::size_t>(xs)...}};
+
+            // Each tile is an index of the space where the last two lengths are counted in tiles
+            array_type tiles = lens;
+            tiles[dims - 2]  = (lens[dims - 2] + tile - 1) / tile;
+            tiles[dims - 1]  = (lens[dims - 1] + tile - 1) / tile;
+            std::size_t size = 1;
+            for(const auto len : tiles)
+                size *= len;
+
+            miopen::par_for_ranges(size, [&](std::size_t begin, std::size_t end) {
+                auto indices = ford_decode(tiles, begin);
+                for(auto i = begin; i < end; i++)
+                {
+                    auto ids             = indices;
+                    const auto row_first = indices[dims - 2] * tile;
+                    const auto col_first = indices[dims - 1] * tile;
+                    const auto row_last  = std::min(lens[dims - 2], row_first + tile);
+                    const auto col_last  = std::min(lens[dims - 1], col_first + tile);
+                    for(ids[dims - 2] = row_first; ids[dims - 2] < row_last; ids[dims - 2]++)
+                    {
+                        for(ids[dims - 1] = col_first; ids[dims - 1] < col_last; ids[dims - 1]++)
+                            miopen::unpack(f, ids);
+                    }
+                    ford_increment(tiles, indices);
+                }
+            });
+        }
+    }
+};
+
+static constexpr ford_wrapper<par_ford_tiled_impl> par_ford_tiled{};
+
 #endif
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/applicability_index.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/solvers.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/solver_id.hpp>
+
+#include "get_handle.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_APPLICABILITY_INDEX_TEST)
+
+namespace {
+
+using miopen::conv::ApplicabilityConstraints;
+using miopen::conv::ProblemFeature;
+using miopen::conv::ToMask;
+
+miopen::conv::ProblemDescription MakeConvProblem(miopen::conv::Direction direction,
+                                                 miopenDataType_t type     = miopenFloat,
+                                                 miopenTensorLayout_t layout = miopenTensorNCHW,
+                                                 std::size_t group_count   = 1)
+{
+    // Lengths are in the NCHW order whatever the layout is
+    const auto conv = miopen::ConvolutionDescriptor{
+        {1, 1}, {1, 1}, {1, 1}, {0, 0}, static_cast<int>(group_count)};
+    return {miopen::TensorDescriptor{type, layout, {16, 64, 28, 28}},
+            miopen::TensorDescriptor{type, layout, {128, 64 / group_count, 3, 3}},
+            miopen::TensorDescriptor{type, layout, {16, 128, 28, 28}},
+            conv,
+            direction};
+}
+
+std::vector<miopen::conv::ProblemDescription> MakeCorpus()
+{
+    auto corpus = std::vector<miopen::conv::ProblemDescription>{};
+    for(const auto direction : {miopen::conv::Direction::Forward,
+                                miopen::conv::Direction::BackwardData,
+                                miopen::conv::Direction::BackwardWeights})
+        for(const auto type : {miopenFloat, miopenHalf, miopenBFloat16})
+            for(const auto layout : {miopenTensorNCHW, miopenTensorNHWC})
+                for(const auto group_count : {1, 4})
+                    corpus.push_back(MakeConvProblem(direction, type, layout, group_count));
+    return corpus;
+}
+
+} // namespace
+
+TEST(CPU_ApplicabilityIndex_NONE, Constraints)
+{
+    const auto fwd_fp32 = ToMask(ProblemFeature::Forward) | ToMask(ProblemFeature::Fp32) |
+                          ToMask(ProblemFeature::LayoutNHWC);
+    const auto bwd_fp32 = ToMask(ProblemFeature::BackwardData) | ToMask(ProblemFeature::Fp32);
+    const auto fwd_fp16 = ToMask(ProblemFeature::Forward) | ToMask(ProblemFeature::Fp16);
+
+    EXPECT_TRUE(ApplicabilityConstraints{}.Admits(fwd_fp32));
+    EXPECT_TRUE(ApplicabilityConstraints{}.Admits(bwd_fp32));
+
+    constexpr auto constraints = ApplicabilityConstraints{ProblemFeature::Forward,
+                                                          ProblemFeature::Fp32,
+                                                          ProblemFeature::Fp16};
+    EXPECT_TRUE(constraints.Admits(fwd_fp32));
+    EXPECT_TRUE(constraints.Admits(fwd_fp16));
+    EXPECT_FALSE(constraints.Admits(bwd_fp32));
+    EXPECT_FALSE(constraints.Admits(ToMask(ProblemFeature::Bfp16)));
+
+    // Groups with no value listed are not constrained, and problems without a value of a group
+    // pass it.
+    EXPECT_TRUE(constraints.Admits(ToMask(ProblemFeature::Grouped)));
+    EXPECT_TRUE(constraints.Admits(0));
+}
+
+TEST(CPU_ApplicabilityIndex_NONE, Features)
+{
+    const auto ctx = miopen::ExecutionContext{&get_handle()};
+
+    const auto fwd = miopen::conv::GetProblemFeatures(
+        ctx, MakeConvProblem(miopen::conv::Direction::Forward));
+    for(const auto feature : {ProblemFeature::Forward,
+                              ProblemFeature::Spatial2d,
+                              ProblemFeature::Fp32,
+                              ProblemFeature::NotCasted,
+                              ProblemFeature::LayoutDefault,
+                              ProblemFeature::Packed,
+                              ProblemFeature::SingleGroup})
+        EXPECT_NE(fwd & ToMask(feature), 0) << static_cast<int>(feature);
+
+    const auto wrw = miopen::conv::GetProblemFeatures(
+        ctx,
+        MakeConvProblem(
+            miopen::conv::Direction::BackwardWeights, miopenHalf, miopenTensorNHWC, 4));
+    for(const auto feature : {ProblemFeature::BackwardWeights,
+                              ProblemFeature::Fp16,
+                              ProblemFeature::LayoutNHWC,
+                              ProblemFeature::Grouped})
+        EXPECT_NE(wrw & ToMask(feature), 0) << static_cast<int>(feature);
+    for(const auto feature :
+        {ProblemFeature::Forward, ProblemFeature::Fp32, ProblemFeature::SingleGroup})
+        EXPECT_EQ(wrw & ToMask(feature), 0) << static_cast<int>(feature);
+
+    // Exactly one value of each group which is always known
+    for(const auto features : {fwd, wrw})
+        for(const auto group : miopen::conv::detail::feature_groups)
+            EXPECT_LE(std::bitset<32>(features & group).count(), 1);
+}
+
+TEST(CPU_ApplicabilityIndex_NONE, PrunesOnlyNotApplicable)
+{
+    const auto ctx    = miopen::ExecutionContext{&get_handle()};
+    const auto& index = miopen::conv::ApplicabilityIndex::Get();
+    const auto solvers =
+        miopen::solver::GetSolversByPrimitive(miopen::solver::Primitive::Convolution);
+
+    auto pruned = 0;
+    for(const auto& problem : MakeCorpus())
+    {
+        const auto features = miopen::conv::GetProblemFeatures(ctx, problem);
+        for(const auto& id : solvers)
+        {
+            if(index.GetConstraints(id).Admits(features))
+                continue;
+            ++pruned;
+            const auto solver = id.GetSolver();
+            EXPECT_FALSE(solver.IsApplicable(ctx, problem))
+                << id.ToString() << " is pruned for " << problem.MakeNetworkConfig().ToString();
+        }
+    }
+    EXPECT_GT(pruned, 0);
+}
+
+TEST(CPU_ApplicabilityIndex_NONE, Memoization)
+{
+    const auto ctx = miopen::ExecutionContext{&get_handle()};
+    auto index     = miopen::conv::ApplicabilityIndex{2};
+    const auto id  = miopen::solver::Id{"ConvDirectNaiveConvFwd"};
+    ASSERT_TRUE(id.IsValid());
+
+    const auto problem = MakeConvProblem(miopen::conv::Direction::Forward);
+    const auto entry   = index.Find(ctx, problem);
+    EXPECT_EQ(index.Find(ctx, problem), entry);
+    EXPECT_EQ(index.GetStats().lookups, 2u);
+    EXPECT_EQ(index.GetStats().hits, 1u);
+
+    EXPECT_FALSE(index.Lookup(*entry, id).has_value());
+    index.Store(*entry, id, true);
+    EXPECT_EQ(index.Lookup(*entry, id), true);
+    EXPECT_EQ(index.GetStats().memoized, 1u);
+
+    // Invalid ids are never answered
+    EXPECT_FALSE(index.Lookup(*entry, miopen::solver::Id{}).has_value());
+
+    // Problems that differ in the fields left out of the network config get their own entries
+    const auto strided = miopen::conv::ProblemDescription{
+        miopen::TensorDescriptor{miopenFloat, {16, 64, 28, 28}, {64 * 28 * 32, 28 * 32, 32, 1}},
+        problem.GetWeights(),
+        problem.GetOut(),
+        problem.GetConv(),
+        problem.GetDirection()};
+    EXPECT_NE(index.MakeKey(ctx, problem), index.MakeKey(ctx, strided));
+
+    // The least recently used problem is dropped once the index is full
+    const auto strided_entry = index.Find(ctx, strided);
+    EXPECT_EQ(index.Find(ctx, problem), entry);
+    index.Find(ctx, MakeConvProblem(miopen::conv::Direction::BackwardData));
+    EXPECT_EQ(index.Find(ctx, problem), entry);
+    EXPECT_NE(index.Find(ctx, strided), strided_entry);
+
+    // Results are dropped when the environment changes
+    const auto key = index.MakeKey(ctx, problem);
+    miopen::env::update(MIOPEN_DEBUG_APPLICABILITY_INDEX_TEST, true);
+    EXPECT_NE(index.MakeKey(ctx, problem), key);
+    miopen::env::clear(MIOPEN_DEBUG_APPLICABILITY_INDEX_TEST);
+
+    // And when the debug switches are set
+    miopen::debug::IsWarmupOngoing = true;
+    EXPECT_NE(index.MakeKey(ctx, problem), key);
+    miopen::debug::IsWarmupOngoing             = false;
+    miopen::debug::AlwaysEnableConvDirectNaive = true;
+    EXPECT_NE(index.MakeKey(ctx, problem), key);
+    miopen::debug::AlwaysEnableConvDirectNaive = false;
+}
+
+TEST(CPU_ApplicabilityIndex_NONE, Query)
+{
+    const auto ctx     = miopen::ExecutionContext{&get_handle()};
+    const auto problem = MakeConvProblem(miopen::conv::Direction::Forward, miopenHalf);
+    const auto solvers =
+        miopen::solver::GetSolversByPrimitive(miopen::solver::Primitive::Convolution);
+
+    miopen::conv::ApplicabilityIndex::Get().Clear();
+    const auto first  = miopen::conv::ApplicabilityQuery{ctx, problem};
+    const auto second = miopen::conv::ApplicabilityQuery{ctx, problem};
+    for(const auto& id : solvers)
+    {
+        // MLIR solvers may run the compiler to find out
+        if(id.ToString().find("Mlir") != std::string::npos)
+            continue;
+        const auto applicable = id.GetSolver().IsApplicable(ctx, problem);
+        EXPECT_EQ(first.IsApplicable(id), applicable) << id.ToString();
+        EXPECT_EQ(second.IsApplicable(id), applicable) << id.ToString();
+    }
+}
@@ -0,0 +1,278 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/any_solver.hpp>
+#include <miopen/background_find.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/names.hpp>
+#include <miopen/temp_file.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_FIND_IN_BACKGROUND)
+
+namespace {
+
+const auto problem       = miopen::NetworkConfig{"problem"};
+const auto other_problem = miopen::NetworkConfig{"other_problem"};
+
+/// Searches in the background with the find-db in a temporary file while alive.
+struct BackgroundFindScope
+{
+    BackgroundFindScope()
+    {
+        miopen::debug::testing_find_db_path_override() = find_db.Path();
+        miopen::env::update(MIOPEN_FIND_IN_BACKGROUND, true);
+    }
+
+    ~BackgroundFindScope()
+    {
+        miopen::env::clear(MIOPEN_FIND_IN_BACKGROUND);
+        miopen::debug::testing_find_db_path_override() = boost::none;
+    }
+
+    const miopen::TempFile find_db{"miopen.test.background_find"};
+};
+
+} // namespace
+
+TEST(CPU_BackgroundFinder_NONE, RunsInOrderOnce)
+{
+    auto finder = miopen::BackgroundFinder{};
+    auto order  = std::vector<int>{};
+
+    EXPECT_TRUE(finder.Submit(problem, [&]() { order.push_back(0); }));
+    EXPECT_TRUE(finder.Submit(other_problem, [&]() { order.push_back(1); }));
+    // Duplicates are dropped, even once the first search is done
+    EXPECT_FALSE(finder.Submit(problem, [&]() { order.push_back(2); }));
+
+    finder.WaitAll();
+    EXPECT_FALSE(finder.Submit(problem, [&]() { order.push_back(2); }));
+    finder.WaitAll();
+
+    EXPECT_EQ(order, (std::vector<int>{0, 1}));
+
+    const auto stats = finder.GetStats();
+    EXPECT_EQ(stats.queued, 2);
+    EXPECT_EQ(stats.completed, 2);
+    EXPECT_EQ(stats.failed, 0);
+}
+
+TEST(CPU_BackgroundFinder_NONE, CountsFailures)
+{
+    auto finder = miopen::BackgroundFinder{};
+
+    finder.Submit(problem, []() { throw std::runtime_error{"search failed"}; });
+    finder.Submit(other_problem, []() {});
+    finder.WaitAll();
+
+    // The worker keeps running after a failure
+    const auto stats = finder.GetStats();
+    EXPECT_EQ(stats.completed, 1);
+    EXPECT_EQ(stats.failed, 1);
+}
+
+TEST(CPU_BackgroundFinder_NONE, StopCancelsQueuedSearches)
+{
+    auto finder  = miopen::BackgroundFinder{};
+    auto started = std::atomic<bool>{false};
+    auto release = std::atomic<bool>{false};
+    auto ran     = std::atomic<int>{0};
+
+    finder.Submit(problem, [&]() {
+        started = true;
+        while(!release)
+            std::this_thread::yield();
+        ++ran;
+    });
+    finder.Submit(other_problem, [&]() { ++ran; });
+
+    while(!started)
+        std::this_thread::yield();
+
+    auto stopper = std::thread{[&]() { finder.Stop(); }};
+    while(finder.GetStats().cancelled == 0)
+        std::this_thread::yield();
+    release = true;
+    stopper.join();
+
+    // The search in progress is finished, the queued one is dropped
+    EXPECT_EQ(ran.load(), 1);
+    EXPECT_FALSE(finder.Submit(miopen::NetworkConfig{"late_problem"}, [&]() { ++ran; }));
+
+    const auto stats = finder.GetStats();
+    EXPECT_EQ(stats.queued, 2);
+    EXPECT_EQ(stats.completed, 1);
+    EXPECT_EQ(stats.cancelled, 1);
+}
+
+TEST(CPU_BackgroundFinder_NONE, StopCancelsSearchInProgress)
+{
+    auto finder  = miopen::BackgroundFinder{};
+    auto started = std::atomic<bool>{false};
+
+    finder.Submit(problem, [&]() {
+        started = true;
+        // Checks between candidates, as the searches do
+        while(!finder.Stopping())
+            std::this_thread::yield();
+        MIOPEN_THROW("The search has been cancelled");
+    });
+
+    while(!started)
+        std::this_thread::yield();
+    finder.Stop();
+
+    const auto stats = finder.GetStats();
+    EXPECT_EQ(stats.completed, 0);
+    EXPECT_EQ(stats.failed, 0);
+    EXPECT_EQ(stats.cancelled, 1);
+}
+
+TEST(CPU_BackgroundFinder_NONE, AppliesPublishedOnCaller)
+{
+    auto finder  = miopen::BackgroundFinder{};
+    auto applied = std::vector<std::thread::id>{};
+
+    finder.Submit(problem, [&]() {
+        finder.Publish([&]() { applied.push_back(std::this_thread::get_id()); });
+    });
+    finder.WaitAll();
+
+    // Nothing touches the owner until the application asks for it
+    EXPECT_TRUE(applied.empty());
+    finder.ApplyPublished();
+    finder.ApplyPublished();
+    EXPECT_EQ(applied, (std::vector<std::thread::id>{std::this_thread::get_id()}));
+
+    // Results which are not applied yet are dropped with the handle
+    finder.Submit(other_problem, [&]() {
+        finder.Publish([&]() { applied.push_back(std::this_thread::get_id()); });
+    });
+    finder.WaitAll();
+    finder.Stop();
+    finder.ApplyPublished();
+    EXPECT_EQ(applied.size(), 1);
+}
+
+TEST(GPU_BackgroundFinder_FP32, SwitchesFind10Invokers)
+{
+    const BackgroundFindScope scope{};
+    miopen::Handle handle{};
+
+    auto conv = miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+    conv.findMode.Set(miopen::FindMode::Values::Normal);
+    const auto x = miopen::TensorDescriptor{miopenFloat, {4, 16, 14, 14}};
+    const auto w = miopen::TensorDescriptor{miopenFloat, {32, 16, 3, 3}};
+    const auto y = conv.GetForwardOutputTensor(x, w);
+    const auto conv_problem =
+        miopen::conv::ProblemDescription{x, w, y, conv, miopen::conv::Direction::Forward};
+    auto ctx = miopen::ExecutionContext{&handle};
+    conv_problem.SetupFloats(ctx);
+
+    const auto allocate = [&](const miopen::TensorDescriptor& desc) {
+        return handle.Create(desc.GetElementSpace() * sizeof(float));
+    };
+    const auto x_dev          = allocate(x);
+    const auto w_dev          = allocate(w);
+    const auto y_dev          = allocate(y);
+    const auto workspace_size = conv.GetWorkSpaceSize(ctx, conv_problem);
+    const auto workspace      = workspace_size != 0 ? handle.Create(workspace_size) : nullptr;
+
+    const auto find = [&]() {
+        auto count = 0;
+        auto perf  = miopenConvAlgoPerf_t{};
+        conv.FindConvFwdAlgorithm(handle,
+                                  x,
+                                  x_dev.get(),
+                                  w,
+                                  w_dev.get(),
+                                  y,
+                                  y_dev.get(),
+                                  1,
+                                  &count,
+                                  &perf,
+                                  workspace.get(),
+                                  workspace_size,
+                                  false);
+        EXPECT_EQ(count, 1);
+    };
+
+    // The find-db miss is served by the heuristics, the search is queued
+    auto& finder = handle.GetBackgroundFinder();
+    find();
+    EXPECT_EQ(finder.GetStats().queued, 1);
+
+    finder.WaitAll();
+    EXPECT_EQ(finder.GetStats().completed, 1);
+    // Done by the next find or convolution call of the application
+    finder.ApplyPublished();
+
+    const auto record = miopen::UserFindDbRecord{handle, conv_problem};
+    ASSERT_FALSE(record.empty());
+
+    // The fastest solution of each algorithm, as ShrinkToFind10Results() picks them
+    auto best = std::map<std::string, std::pair<std::string, float>>{};
+    for(const auto& entry : record)
+    {
+        const auto found = best.find(entry.second.algorithm);
+        if(found == best.end() || entry.second.time < found->second.second)
+            best[entry.second.algorithm] = {entry.first, entry.second.time};
+    }
+
+    // Each algorithm runs its best solution now, unless that one needs more workspace than the
+    // solution the application has allocated the workspace for
+    const auto config = conv_problem.MakeNetworkConfig();
+    for(const auto& [algo, solution] : best)
+    {
+        const auto current = handle.GetFound1_0SolverId(config, miopen::AlgorithmName{algo});
+        ASSERT_TRUE(current.has_value()) << algo;
+        if(*current == solution.first)
+            continue;
+        const auto workspace_of = [&](const std::string& id) {
+            return miopen::solver::Id{id}.GetSolver().GetWorkspaceSize(ctx, conv_problem);
+        };
+        EXPECT_LT(workspace_of(*current), workspace_of(solution.first)) << algo;
+    }
+
+    // Later calls are served by the find-db record
+    find();
+    EXPECT_EQ(finder.GetStats().queued, 1);
+}
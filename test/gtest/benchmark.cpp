@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/benchmark.hpp>
+#include <miopen/errors.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+/// Returns the given times in a loop and counts the calls.
+struct MockTimer
+{
+    std::vector<float> times;
+    std::shared_ptr<std::size_t> calls = std::make_shared<std::size_t>(0);
+
+    float operator()() const { return times[(*calls)++ % times.size()]; }
+};
+
+miopen::BenchmarkOptions MakeOptions()
+{
+    auto options          = miopen::BenchmarkOptions{};
+    options.warmup        = 1;
+    options.min_samples   = 3;
+    options.max_samples   = 20;
+    options.time_limit_ms = 1000.0f;
+    options.target_ci     = 0.02f;
+    return options;
+}
+
+} // namespace
+
+TEST(CPU_Benchmark_NONE, Stats)
+{
+    auto options       = MakeOptions();
+    options.trim       = 0.2f;
+    const auto samples = std::vector<float>{4.0f, 1.0f, 100.0f, 3.0f, 2.0f};
+
+    const auto median = miopen::ComputeTimingStats(samples, options);
+    EXPECT_EQ(median.samples, 5);
+    EXPECT_FLOAT_EQ(median.estimate, 3.0f);
+    EXPECT_FLOAT_EQ(median.median, 3.0f);
+    EXPECT_FLOAT_EQ(median.mean, 22.0f);
+    EXPECT_FLOAT_EQ(median.min, 1.0f);
+    EXPECT_GT(median.stddev, 0.0f);
+    EXPECT_LE(median.ci_low, median.estimate);
+    EXPECT_GE(median.ci_high, median.estimate);
+
+    options.estimator = miopen::TimingEstimator::TrimmedMean;
+    EXPECT_FLOAT_EQ(miopen::ComputeTimingStats(samples, options).estimate, 3.0f);
+    options.estimator = miopen::TimingEstimator::Mean;
+    EXPECT_FLOAT_EQ(miopen::ComputeTimingStats(samples, options).estimate, 22.0f);
+    options.estimator = miopen::TimingEstimator::Min;
+    EXPECT_FLOAT_EQ(miopen::ComputeTimingStats(samples, options).estimate, 1.0f);
+
+    const auto even = miopen::ComputeTimingStats({1.0f, 2.0f, 3.0f, 4.0f}, MakeOptions());
+    EXPECT_FLOAT_EQ(even.median, 2.5f);
+
+    EXPECT_EQ(miopen::ParseTimingEstimator("trimmed_mean"), miopen::TimingEstimator::TrimmedMean);
+    EXPECT_ANY_THROW(miopen::ParseTimingEstimator("mode"));
+}
+
+TEST(CPU_Benchmark_NONE, AdaptiveSamples)
+{
+    const auto stable = MockTimer{{1.0f}};
+    const auto noisy  = MockTimer{{2.0f, 2.2f, 1.8f, 2.1f, 1.9f}};
+
+    auto options               = MakeOptions();
+    options.successive_halving = false;
+    auto benchmark             = miopen::Benchmark{options};
+    benchmark.Add(stable);
+    benchmark.Add(noisy);
+    const auto stats = benchmark.Run();
+
+    // A stable candidate converges right away, a noisy one is sampled until the estimate is
+    // either stable or clearly slower.
+    EXPECT_EQ(*stable.calls, options.warmup + options.min_samples);
+    EXPECT_EQ(stats[0].samples, options.min_samples);
+    EXPECT_FLOAT_EQ(stats[0].estimate, 1.0f);
+    EXPECT_FALSE(stats[0].eliminated);
+    EXPECT_TRUE(stats[1].eliminated);
+    EXPECT_EQ(miopen::Benchmark::GetBest(stats), 0);
+
+    auto single = miopen::Benchmark{options};
+    single.Add(noisy);
+    const auto alone = single.Run().front();
+    EXPECT_GT(alone.samples, options.min_samples);
+    EXPECT_LE(alone.samples, options.max_samples);
+    EXPECT_NEAR(alone.estimate, 2.0f, 0.1f);
+}
+
+TEST(CPU_Benchmark_NONE, LuckySample)
+{
+    // The slower candidate is sometimes much faster, e.g. while the device is shared. Only the
+    // minimum picks it.
+    const auto fast  = MockTimer{{1.0f, 1.02f, 0.98f}};
+    const auto lucky = MockTimer{{1.5f, 0.5f, 1.5f, 1.52f, 1.48f}};
+
+    for(const auto estimator :
+        {miopen::TimingEstimator::Median, miopen::TimingEstimator::TrimmedMean})
+    {
+        auto options      = MakeOptions();
+        options.estimator = estimator;
+        auto benchmark    = miopen::Benchmark{options};
+        benchmark.Add(fast);
+        benchmark.Add(lucky);
+        EXPECT_EQ(miopen::Benchmark::GetBest(benchmark.Run()), 0);
+    }
+
+    auto options      = MakeOptions();
+    options.estimator = miopen::TimingEstimator::Min;
+    options.warmup    = 0;
+    auto benchmark    = miopen::Benchmark{options};
+    benchmark.Add(MockTimer{fast.times});
+    benchmark.Add(MockTimer{lucky.times});
+    EXPECT_EQ(miopen::Benchmark::GetBest(benchmark.Run()), 1);
+}
+
+TEST(CPU_Benchmark_NONE, SuccessiveHalving)
+{
+    const auto run = [](bool halving) {
+        auto options               = MakeOptions();
+        options.successive_halving = halving;
+        auto benchmark             = miopen::Benchmark{options};
+        auto timers                = std::vector<MockTimer>{};
+        for(auto i = 0; i < 8; ++i)
+        {
+            // Noisy enough to overlap with the neighbours
+            const auto time = 1.0f + 0.05f * static_cast<float>(i);
+            timers.push_back(MockTimer{{time, time * 1.1f, time * 0.9f, time * 1.05f}});
+            benchmark.Add(timers.back());
+        }
+        const auto stats = benchmark.Run();
+        EXPECT_EQ(miopen::Benchmark::GetBest(stats), 0);
+
+        auto calls = std::size_t{0};
+        for(const auto& timer : timers)
+            calls += *timer.calls;
+        return calls;
+    };
+
+    EXPECT_LT(run(true), run(false));
+}
+
+TEST(CPU_Benchmark_NONE, Limits)
+{
+    auto options          = MakeOptions();
+    options.time_limit_ms = 100.0f;
+
+    // Slow candidates stop at the time limit, but get one sample
+    const auto slow = MockTimer{{60.0f, 80.0f}};
+    auto benchmark  = miopen::Benchmark{options};
+    benchmark.Add(slow);
+    const auto stats = benchmark.Run().front();
+    EXPECT_EQ(stats.samples, 1);
+    EXPECT_FLOAT_EQ(stats.estimate, 80.0f);
+
+    // Failing candidates are reported and never selected
+    auto calls   = 0;
+    auto failing = miopen::Benchmark{MakeOptions()};
+    failing.Add([&]() -> float {
+        if(++calls > 2)
+            MIOPEN_THROW("Launch failed");
+        return 0.5f;
+    });
+    failing.Add(MockTimer{{1.0f}});
+    const auto results = failing.Run();
+    EXPECT_TRUE(results[0].failed);
+    EXPECT_FALSE(results[1].failed);
+    EXPECT_EQ(miopen::Benchmark::GetBest(results), 1);
+}
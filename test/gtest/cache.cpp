@@ -26,6 +26,7 @@
 
 #include <miopen/binary_cache.hpp>
 #include <miopen/bz2.hpp>
+#include <miopen/compression.hpp>
 #include <miopen/kern_db.hpp>
 #include <miopen/temp_file.hpp>
 #include <algorithm>
@@ -89,6 +90,88 @@ TEST(CPU_Cache_NONE, check_bz2_decompress)
     ASSERT_TRUE(decompressed == miopen::decompress(compressed, original.size() + 10));
 }
 
+TEST(CPU_Cache_NONE, check_codecs)
+{
+    const auto original = random_bytes(16384);
+    for(const auto codec : {miopen::CompressionCodec::Bzip2, miopen::CompressionCodec::Zstd})
+    {
+        if(!miopen::IsAvailable(codec))
+        {
+            EXPECT_TRUE(throws([&]() { miopen::Compress(codec, original); }));
+            continue;
+        }
+
+        bool success    = false;
+        auto compressed = miopen::Compress(codec, original, &success);
+        ASSERT_TRUE(success) << miopen::ToString(codec);
+        ASSERT_TRUE(compressed.size() < original.size());
+        EXPECT_TRUE(miopen::Decompress(codec, compressed, original.size()) == original);
+        EXPECT_TRUE(throws([&]() { miopen::Decompress(codec, compressed, 10); }));
+        EXPECT_TRUE(throws([&]() { miopen::Decompress(codec, compressed, original.size() + 1); }));
+
+        compressed[compressed.size() / 2] ^= 0x55;
+        EXPECT_TRUE(throws([&]() { miopen::Decompress(codec, compressed, original.size()); }));
+
+        // Incompressible data is reported rather than grown
+        const auto tiny = std::vector<char>{'a'};
+        EXPECT_TRUE(miopen::Compress(codec, tiny, &success) == tiny);
+        EXPECT_FALSE(success);
+    }
+    EXPECT_TRUE(miopen::IsAvailable(miopen::GetDefaultCodec()));
+}
+
+TEST(CPU_Cache_NONE, check_kern_db_codecs)
+{
+    auto legacy = miopen::KernelConfig{"legacy", "-DLEGACY", random_bytes(8192)};
+    auto bz2    = miopen::KernelConfig{"bz2", "-DBZ2", random_bytes(8192)};
+    auto latest = miopen::KernelConfig{"latest", "-DLATEST", random_bytes(8192)};
+
+    miopen::TempFile temp_file("tmp-kerndb");
+    {
+        // A database written before the codec column was added
+        auto sql = miopen::SQLite{temp_file, false};
+        sql.Exec("CREATE TABLE `kern_db` (`id` INTEGER PRIMARY KEY ASC,"
+                 "`kernel_name` TEXT NOT NULL,`kernel_args` TEXT NOT NULL,"
+                 "`kernel_blob` BLOB NOT NULL,`kernel_hash` TEXT NOT NULL,"
+                 "`uncompressed_size` INT NOT NULL);");
+        auto stmt = miopen::SQLite::Statement{
+            sql,
+            "INSERT INTO kern_db(kernel_name, kernel_args, kernel_blob, kernel_hash, "
+            "uncompressed_size) VALUES(?, ?, ?, ?, ?);"};
+        stmt.BindPath(1, legacy.kernel_name);
+        stmt.BindText(2, legacy.kernel_args);
+        stmt.BindBlob(3, miopen::compress(legacy.kernel_blob));
+        stmt.BindText(4, miopen::md5(legacy.kernel_blob));
+        stmt.BindInt64(5, legacy.kernel_blob.size());
+        ASSERT_EQ(stmt.Step(sql), SQLITE_DONE);
+    }
+
+    {
+        // Custom codecs replace bzip2
+        miopen::KernDb db(miopen::DbKinds::KernelDb,
+                          temp_file,
+                          false,
+                          miopen::compress,
+                          miopen::decompress);
+        EXPECT_EQ(db.GetCodec(), miopen::CompressionCodec::Bzip2);
+        EXPECT_TRUE(db.StoreRecordUnsafe(bz2));
+    }
+
+    miopen::KernDb db(miopen::DbKinds::KernelDb, temp_file, false);
+    EXPECT_EQ(db.GetCodec(), miopen::GetDefaultCodec());
+    EXPECT_TRUE(db.StoreRecordUnsafe(latest));
+
+    const auto configs  = std::vector<miopen::KernelConfig>{legacy, bz2, latest};
+    const auto readouts = db.FindRecordsUnsafe(configs);
+    ASSERT_EQ(readouts.size(), configs.size());
+    for(std::size_t i = 0; i < configs.size(); ++i)
+    {
+        ASSERT_TRUE(readouts[i]);
+        EXPECT_TRUE(readouts[i].get() == configs[i].kernel_blob);
+        EXPECT_TRUE(db.FindRecordUnsafe(configs[i]).get() == configs[i].kernel_blob);
+    }
+}
+
 TEST(CPU_Cache_NONE, check_kern_db)
 {
     miopen::KernelConfig cfg0;
@@ -133,6 +216,86 @@ TEST(CPU_Cache_NONE, check_kern_db)
         EXPECT_TRUE(err_db.RemoveRecordUnsafe(cfg0));
     }
 }
+
+TEST(CPU_Cache_NONE, check_kern_db_batch)
+{
+    std::vector<miopen::KernelConfig> cfgs;
+    for(auto i = 0; i < 300; ++i)
+    {
+        miopen::KernelConfig cfg;
+        cfg.kernel_name = "kernel" + std::to_string(i % 3);
+        cfg.kernel_args = "-DINDEX=" + std::to_string(i);
+        cfg.kernel_blob = random_bytes(1024 + i);
+        cfgs.push_back(cfg);
+    }
+
+    miopen::KernDb empty_db(miopen::DbKinds::KernelDb, "", false);
+    for(const auto& readout : empty_db.FindRecordsUnsafe(cfgs))
+        EXPECT_FALSE(readout);
+
+    miopen::TempFile temp_file("tmp-kerndb");
+    miopen::KernDb db(miopen::DbKinds::KernelDb, temp_file, false);
+
+    // Every other record is stored, the last one is requested twice
+    for(std::size_t i = 0; i < cfgs.size(); i += 2)
+        EXPECT_TRUE(db.StoreRecordUnsafe(cfgs[i]));
+    cfgs.push_back(cfgs.front());
+
+    const auto readouts = db.FindRecordsUnsafe(cfgs);
+    ASSERT_EQ(readouts.size(), cfgs.size());
+    for(std::size_t i = 0; i < cfgs.size(); ++i)
+    {
+        if(i % 2 != 0 && i != cfgs.size() - 1)
+        {
+            EXPECT_FALSE(readouts[i]);
+            continue;
+        }
+        ASSERT_TRUE(readouts[i]);
+        EXPECT_TRUE(readouts[i].get() == cfgs[i].kernel_blob);
+        EXPECT_TRUE(readouts[i].get() == db.FindRecordUnsafe(cfgs[i]).get());
+    }
+}
+
+TEST(CPU_Cache_NONE, check_kern_db_bulk_store)
+{
+    std::vector<miopen::KernelConfig> cfgs;
+    std::vector<std::string> hashes;
+    for(auto i = 0; i < 100; ++i)
+    {
+        miopen::KernelConfig cfg;
+        cfg.kernel_name = "kernel" + std::to_string(i % 4);
+        cfg.kernel_args = "-DINDEX=" + std::to_string(i);
+        cfg.kernel_blob = random_bytes(1024 + i);
+        cfgs.push_back(cfg);
+        hashes.push_back(miopen::md5(cfg.kernel_args));
+    }
+
+    miopen::TempFile temp_file("tmp-kerndb");
+    miopen::KernDb db(miopen::DbKinds::KernelDb, temp_file, false);
+    for(const auto& hash : db.FindSourceHashesUnsafe(cfgs))
+        EXPECT_TRUE(hash.empty());
+
+    // The first half is stored without hashes, the second one with
+    const auto half = static_cast<std::ptrdiff_t>(cfgs.size() / 2);
+    db.StoreRecordsUnsafe({cfgs.begin(), cfgs.begin() + half});
+    db.StoreRecordsUnsafe({cfgs.begin() + half, cfgs.end()}, {hashes.begin() + half, hashes.end()});
+    EXPECT_ANY_THROW(db.StoreRecordsUnsafe(cfgs, {hashes.front()}));
+
+    const auto readouts = db.FindRecordsUnsafe(cfgs);
+    auto found_hashes   = db.FindSourceHashesUnsafe(cfgs);
+    for(std::size_t i = 0; i < cfgs.size(); ++i)
+    {
+        ASSERT_TRUE(readouts[i]);
+        EXPECT_TRUE(readouts[i].get() == cfgs[i].kernel_blob);
+        EXPECT_EQ(found_hashes[i], i < cfgs.size() / 2 ? std::string{} : hashes[i]);
+    }
+
+    // Hashes of removed kernels are stale
+    EXPECT_TRUE(db.RemoveRecordUnsafe(cfgs.back()));
+    found_hashes = db.FindSourceHashesUnsafe(cfgs);
+    EXPECT_TRUE(found_hashes.back().empty());
+    EXPECT_EQ(found_hashes[cfgs.size() - 2], hashes[cfgs.size() - 2]);
+}
 #endif
 
 TEST(CPU_Cache_NONE, check_cache_file)
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/generic_search.hpp>
+#include <miopen/thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Candidate = miopen::solver::CompiledCandidate<int>;
+using Pipeline  = miopen::solver::CompilePipeline<int>;
+
+constexpr std::size_t n_configs = 64;
+
+std::optional<Candidate> CompileNext(Pipeline& pipeline)
+{
+    const auto idx = pipeline.next++;
+    if(idx >= n_configs)
+        return std::nullopt;
+    auto candidate   = Candidate{};
+    candidate.config = static_cast<int>(idx);
+    return candidate;
+}
+
+void CompileAgent(Pipeline& pipeline)
+{
+    while(auto candidate = CompileNext(pipeline))
+    {
+        if(!pipeline.queue.push(std::move(*candidate)))
+            return;
+    }
+}
+
+struct Stream
+{
+    bool HasProgram(const miopen::fs::path&, const std::string&) const { return true; }
+    miopen::Program
+    LoadProgram(const miopen::fs::path&, const std::string&, const std::string&) const
+    {
+        return {};
+    }
+};
+
+struct Context
+{
+    Stream stream;
+    const Stream& GetStream() const { return stream; }
+};
+
+struct Problem
+{
+};
+
+/// The predicted time of a config is its value.
+struct PredictingSolver
+{
+    std::vector<int>* compiled;
+
+    miopen::solver::ConvSolution
+    GetSolution(const Context&, const Problem&, const int& config) const
+    {
+        compiled->push_back(config);
+        return {};
+    }
+
+    float PredictTime(const Context&, const Problem&, const int& config) const
+    {
+        return static_cast<float>(config);
+    }
+};
+
+std::vector<int> PopAll(Pipeline& pipeline)
+{
+    auto popped = std::vector<int>(n_configs);
+    while(auto candidate = pipeline.Pop([&]() { return CompileNext(pipeline); }))
+        ++popped.at(candidate->config);
+    return popped;
+}
+
+} // namespace
+
+TEST(CPU_CompilePipeline_NONE, PopsEveryConfigOnce)
+{
+    auto pool     = miopen::ThreadPool{4};
+    auto pipeline = Pipeline{2, pool};
+    pipeline.Start(4, [&](std::size_t) { CompileAgent(pipeline); });
+
+    for(const auto count : PopAll(pipeline))
+        EXPECT_EQ(count, 1);
+    pipeline.Wait();
+}
+
+TEST(CPU_CompilePipeline_NONE, BusyPool)
+{
+    auto pool    = miopen::ThreadPool{1};
+    auto release = std::promise<void>{};
+    pool.Post([blocked = release.get_future().share()]() { blocked.wait(); });
+
+    {
+        // The agents can't start, so the consumer compiles everything itself
+        auto pipeline = Pipeline{2, pool};
+        pipeline.Start(2, [&](std::size_t) { CompileAgent(pipeline); });
+
+        for(const auto count : PopAll(pipeline))
+            EXPECT_EQ(count, 1);
+        pipeline.Wait();
+    }
+
+    // The cancelled agents are taken from the pool after the pipeline is gone
+    release.set_value();
+}
+
+TEST(CPU_CompilePipeline_NONE, RethrowsAgentError)
+{
+    auto pool     = miopen::ThreadPool{1};
+    auto pipeline = Pipeline{2, pool};
+    auto started  = std::promise<void>{};
+    pipeline.Start(1, [&](std::size_t) {
+        started.set_value();
+        throw std::runtime_error{"Compiler has crashed"};
+    });
+    started.get_future().wait();
+
+    // The consumer compiles what the agent has left
+    for(const auto count : PopAll(pipeline))
+        EXPECT_EQ(count, 1);
+    EXPECT_THROW(pipeline.Wait(), std::runtime_error);
+}
+
+TEST(CPU_CompilePipeline_NONE, PrunesPredictedSlower)
+{
+    auto compiled = std::vector<int>{};
+    auto configs  = std::vector<int>(n_configs);
+    std::iota(configs.begin(), configs.end(), 0);
+    std::rotate(configs.begin(), configs.begin() + 10, configs.end());
+
+    const auto solver       = PredictingSolver{&compiled};
+    const auto compile_next = [&](Pipeline& pipeline) {
+        return miopen::solver::CompileNext(pipeline, solver, Context{}, Problem{}, configs);
+    };
+
+    auto pipeline = Pipeline{0};
+    auto popped   = std::vector<int>{};
+    while(auto candidate = pipeline.Pop([&]() { return compile_next(pipeline); }))
+    {
+        popped.push_back(candidate->config);
+        // Measured exactly as predicted
+        pipeline.best_time = std::min<float>(pipeline.best_time, candidate->config);
+    }
+
+    // Once 10 is measured, 12 to 63 are more than 10% slower, and once 0 is, 1 to 9 are. They are
+    // neither compiled nor benchmarked.
+    const auto expected = std::vector<int>{10, 11, 0};
+    EXPECT_EQ(popped, expected);
+    EXPECT_EQ(compiled, expected);
+    EXPECT_EQ(pipeline.n_pruned, n_configs - expected.size());
+
+    // Nothing is pruned until something has been measured
+    EXPECT_FALSE(miopen::solver::IsPredictedSlower(
+        solver, Context{}, Problem{}, 1000, std::numeric_limits<float>::max()));
+    EXPECT_TRUE(miopen::solver::IsPredictedSlower(solver, Context{}, Problem{}, 12, 10.0f));
+    EXPECT_FALSE(miopen::solver::IsPredictedSlower(solver, Context{}, Problem{}, 11, 10.0f));
+}
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <gtest/gtest.h>
+
+#include "../../driver/conv_cpu_blocked.hpp"
+
+#include <ostream>
+#include <vector>
+
+namespace {
+
+struct BlockedConvCase
+{
+    miopenTensorLayout_t layout;
+    std::vector<int> in_lens;  // N, C, spatial
+    std::vector<int> wei_lens; // K, C per group, spatial
+    std::vector<int> pads;
+    std::vector<int> strides;
+    std::vector<int> dilations;
+    int group_count;
+
+    std::vector<int> OutLens() const
+    {
+        std::vector<int> lens = {in_lens[0], wei_lens[0]};
+        for(std::size_t i = 0; i < pads.size(); ++i)
+        {
+            const auto wei_extent = dilations[i] * (wei_lens[i + 2] - 1) + 1;
+            lens.push_back((in_lens[i + 2] + 2 * pads[i] - wei_extent) / strides[i] + 1);
+        }
+        return lens;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const BlockedConvCase& c)
+    {
+        os << "layout " << c.layout << " in";
+        for(auto l : c.in_lens)
+            os << " " << l;
+        os << " wei";
+        for(auto l : c.wei_lens)
+            os << " " << l;
+        return os << " groups " << c.group_count;
+    }
+};
+
+/// Small integers keep all the sums exact, so both implementations must match bit for bit.
+tensor<float> MakeTensor(miopenTensorLayout_t layout, const std::vector<int>& lens, int seed)
+{
+    const auto spatial = lens.size() - 2;
+    if(layout != miopenTensorNCHW)
+        layout = spatial == 3 ? miopenTensorNDHWC : miopenTensorNHWC;
+    else if(spatial == 3)
+        layout = miopenTensorNCDHW;
+
+    auto t = spatial == 1 ? tensor<float>{lens} : tensor<float>{layout, lens};
+    for(std::size_t i = 0; i < t.data.size(); ++i)
+        t.data[i] = static_cast<float>(static_cast<int>((i * 7 + seed * 13) % 11) - 5);
+    return t;
+}
+
+class CPU_ConvCpuBlocked_NONE : public ::testing::TestWithParam<BlockedConvCase>
+{
+};
+
+TEST_P(CPU_ConvCpuBlocked_NONE, MatchesReference)
+{
+    const auto& p      = GetParam();
+    const auto spatial = p.pads.size();
+
+    const auto in  = MakeTensor(p.layout, p.in_lens, 1);
+    const auto wei = MakeTensor(p.layout, p.wei_lens, 2);
+    const auto out = MakeTensor(p.layout, p.OutLens(), 3);
+
+    auto fwd_ref = out;
+    auto fwd     = out;
+    cpu_convolution_forward(
+        spatial, in, wei, fwd_ref, p.pads, p.strides, p.dilations, p.group_count);
+    cpu_convolution_forward_blocked(
+        spatial, in, wei, fwd, p.pads, p.strides, p.dilations, p.group_count);
+    EXPECT_EQ(fwd.data, fwd_ref.data);
+
+    auto bwd_ref = in;
+    auto bwd     = in;
+    cpu_convolution_backward_data(
+        spatial, bwd_ref, wei, out, p.pads, p.strides, p.dilations, p.group_count);
+    cpu_convolution_backward_data_blocked(
+        spatial, bwd, wei, out, p.pads, p.strides, p.dilations, p.group_count);
+    EXPECT_EQ(bwd.data, bwd_ref.data);
+
+    auto wrw_ref = wei;
+    auto wrw     = wei;
+    cpu_convolution_backward_weight(
+        spatial, in, wrw_ref, out, p.pads, p.strides, p.dilations, p.group_count);
+    cpu_convolution_backward_weight_blocked(
+        spatial, in, wrw, out, p.pads, p.strides, p.dilations, p.group_count);
+    EXPECT_EQ(wrw.data, wrw_ref.data);
+}
+
+/// One case of each kind: 2D, grouped NHWC, 3D and 1D.
+std::vector<BlockedConvCase> SmokeBlockedConvCases()
+{
+    // clang-format off
+    return {
+        BlockedConvCase{miopenTensorNCHW, {1, 2, 5, 6}, {3, 2, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 1},
+        BlockedConvCase{miopenTensorNHWC, {1, 4, 5, 5}, {4, 2, 3, 3}, {1, 0}, {2, 1}, {1, 1}, 2},
+        BlockedConvCase{miopenTensorNCHW, {1, 2, 3, 4, 4}, {2, 2, 2, 2, 2}, {0, 1, 0}, {1, 1, 2}, {1, 1, 1}, 1},
+        BlockedConvCase{miopenTensorNCHW, {1, 2, 7}, {3, 2, 3}, {1}, {1}, {2}, 1}
+    };
+    // clang-format on
+}
+
+std::vector<BlockedConvCase> FullBlockedConvCases()
+{
+    // clang-format off
+    return {
+        BlockedConvCase{miopenTensorNCHW, {2, 3, 9, 11}, {5, 3, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 1},
+        BlockedConvCase{miopenTensorNCHW, {2, 6, 10, 9}, {12, 3, 3, 2}, {0, 1}, {2, 3}, {1, 2}, 2},
+        BlockedConvCase{miopenTensorNCHW, {1, 4, 7, 7}, {4, 1, 3, 3}, {2, 2}, {1, 1}, {2, 2}, 4},
+        BlockedConvCase{miopenTensorNCHW, {3, 16, 5, 6}, {9, 16, 1, 1}, {0, 0}, {1, 1}, {1, 1}, 1},
+        BlockedConvCase{miopenTensorNHWC, {2, 4, 8, 9}, {10, 2, 3, 3}, {1, 0}, {2, 1}, {1, 1}, 2},
+        BlockedConvCase{miopenTensorNHWC, {1, 3, 6, 6}, {4, 3, 5, 5}, {3, 3}, {3, 2}, {1, 1}, 1},
+        BlockedConvCase{miopenTensorNCHW, {2, 3, 5, 6, 7}, {4, 3, 3, 2, 3}, {1, 0, 1}, {1, 2, 1}, {1, 1, 2}, 1},
+        BlockedConvCase{miopenTensorNHWC, {1, 4, 4, 5, 5}, {6, 2, 2, 3, 3}, {0, 1, 1}, {2, 1, 1}, {1, 1, 1}, 2},
+        BlockedConvCase{miopenTensorNCHW, {2, 3, 13}, {5, 3, 4}, {2}, {2}, {2}, 1},
+        // Wide enough for the tasks to be split into several ranges
+        BlockedConvCase{miopenTensorNCHW, {1, 8, 64, 33}, {20, 8, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 1},
+        BlockedConvCase{miopenTensorNHWC, {1, 12, 48, 17}, {8, 3, 3, 1}, {1, 0}, {1, 1}, {1, 1}, 4}
+    };
+    // clang-format on
+}
+
+} // namespace
+
+INSTANTIATE_TEST_SUITE_P(Smoke,
+                         CPU_ConvCpuBlocked_NONE,
+                         testing::ValuesIn(SmokeBlockedConvCases()));
+INSTANTIATE_TEST_SUITE_P(Full, CPU_ConvCpuBlocked_NONE, testing::ValuesIn(FullBlockedConvCases()));
@@ -26,9 +26,12 @@
 #pragma once
 
 #include <miopen/miopen.h>
+#include <miopen/problem_description_base.hpp>
 #include <iostream>
+#include <sstream>
 
 #include "tensor_holder.hpp"
+#include "verification_cache.hpp"
 #include "conv_common.hpp"
 #include "conv_tensor_gen.hpp"
 
@@ -153,14 +156,25 @@ protected:
         ref_out = tensor<Tref>{output.desc.GetLayout_t(), output.desc.GetLengths()};
         if(use_cpu_ref)
         {
-            cpu_convolution_forward(conv_desc.GetSpatialDimension(),
-                                    input,
-                                    weights,
-                                    ref_out,
-                                    conv_desc.GetConvPads(),
-                                    conv_desc.GetConvStrides(),
-                                    conv_desc.GetConvDilations(),
-                                    conv_desc.GetGroupCount());
+            // The generator is shared by all the tests of the binary, so the inputs are keyed
+            // by their contents.
+            std::ostringstream problem;
+            problem << input.desc << weights.desc << ref_out.desc << conv_desc;
+            auto key = miopen::VerificationCacheKey{"conv_fwd", problem.str(), 0, ""};
+            key.type = miopen::GetDataTypeName(miopen_type<T>{}) + "_" +
+                       miopen::GetDataTypeName(miopen_type<Tref>{});
+            key.AddInput(input.data).AddInput(weights.data);
+
+            miopen::VerificationCache::FromEnv().LoadOrCompute(key, ref_out.data, [&] {
+                cpu_convolution_forward(conv_desc.GetSpatialDimension(),
+                                        input,
+                                        weights,
+                                        ref_out,
+                                        conv_desc.GetConvPads(),
+                                        conv_desc.GetConvStrides(),
+                                        conv_desc.GetConvDilations(),
+                                        conv_desc.GetGroupCount());
+            });
         }
         else
         {
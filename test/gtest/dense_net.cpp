@@ -0,0 +1,270 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/heuristics/dense_net.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+#include <fdeep/fdeep.hpp>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string EncodeBase64(const std::vector<float>& values)
+{
+    const auto* digits = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    auto bytes         = std::vector<unsigned char>(values.size() * sizeof(float));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+
+    auto text = std::string{};
+    for(std::size_t i = 0; i < bytes.size(); i += 3)
+    {
+        const auto n = std::min<std::size_t>(3, bytes.size() - i);
+        auto bits    = 0u;
+        for(std::size_t k = 0; k < 3; ++k)
+            bits = (bits << 8) | (k < n ? bytes[i + k] : 0u);
+        for(std::size_t k = 0; k < 4; ++k)
+            text += k <= n ? digits[(bits >> (18 - 6 * k)) & 63] : '=';
+    }
+    return text;
+}
+
+std::vector<float> Random(std::size_t size, std::mt19937& gen)
+{
+    auto dist   = std::uniform_real_distribution<float>{-1.0f, 1.0f};
+    auto values = std::vector<float>(size);
+    for(auto& value : values)
+        value = dist(gen);
+    return values;
+}
+
+nlohmann::json Layer(const std::string& class_name,
+                     const std::string& name,
+                     const std::vector<std::string>& inputs,
+                     nlohmann::json config = nlohmann::json::object())
+{
+    auto node = nlohmann::json::array();
+    for(const auto& input : inputs)
+        node.push_back({input, 0, 0, nlohmann::json::object()});
+    auto inbound_nodes = nlohmann::json::array();
+    if(!inputs.empty())
+        inbound_nodes.push_back(node);
+    config["name"] = name;
+    return {{"class_name", class_name},
+            {"name", name},
+            {"config", config},
+            {"inbound_nodes", inbound_nodes}};
+}
+
+/// A small residual network of the same layers as TunaNet, and a reference implementation of it
+struct TestNet
+{
+    static constexpr std::size_t inputs  = 5;
+    static constexpr std::size_t hidden  = 20;
+    static constexpr std::size_t outputs = 3;
+
+    std::vector<float> w0, b0, w1, b1, w2, b2;
+    nlohmann::json model;
+
+    TestNet()
+    {
+        auto gen = std::mt19937{};
+        w0       = Random(inputs * hidden, gen);
+        b0       = Random(hidden, gen);
+        w1       = Random(hidden * hidden, gen);
+        b1       = Random(hidden, gen);
+        w2       = Random(hidden * outputs, gen);
+        b2       = Random(outputs, gen);
+
+        const auto dense = [](std::size_t units, const std::string& activation) {
+            return nlohmann::json{{"units", units}, {"activation", activation}, {"use_bias", true}};
+        };
+        const auto params = [](const std::vector<float>& w, const std::vector<float>& b) {
+            return nlohmann::json{{"weights", {EncodeBase64(w)}}, {"bias", {EncodeBase64(b)}}};
+        };
+
+        // dense_0 -> re_lu_0 is used twice, so it can't be fused
+        model["input_shapes"]  = {{inputs}};
+        model["output_shapes"] = {{outputs}};
+        model["architecture"]["config"]["layers"] = {
+            Layer("InputLayer", "input", {}),
+            Layer("Dense", "dense_0", {"input"}, dense(hidden, "linear")),
+            Layer("ReLU", "re_lu_0", {"dense_0"}),
+            Layer("Dense", "dense_1", {"re_lu_0"}, dense(hidden, "relu")),
+            Layer("Add", "add", {"dense_1", "re_lu_0"}),
+            Layer("ReLU", "re_lu_1", {"add"}),
+            Layer("Dense", "dense_2", {"re_lu_1"}, dense(outputs, "linear"))};
+        model["architecture"]["config"]["output_layers"] = {{"dense_2", 0, 0}};
+        model["trainable_params"] = {{"dense_0", params(w0, b0)},
+                                     {"dense_1", params(w1, b1)},
+                                     {"dense_2", params(w2, b2)}};
+    }
+
+    std::vector<double> Reference(const float* x) const
+    {
+        const auto dense = [](const std::vector<double>& in,
+                              const std::vector<float>& w,
+                              const std::vector<float>& b,
+                              bool relu) {
+            auto out = std::vector<double>(b.begin(), b.end());
+            for(std::size_t i = 0; i < in.size(); ++i)
+                for(std::size_t o = 0; o < out.size(); ++o)
+                    out[o] += in[i] * w[i * out.size() + o];
+            if(relu)
+                for(auto& value : out)
+                    value = std::max(value, 0.0);
+            return out;
+        };
+
+        const auto h0 = dense({x, x + inputs}, w0, b0, true);
+        auto h1       = dense(h0, w1, b1, true);
+        for(std::size_t i = 0; i < hidden; ++i)
+            h1[i] = std::max(h1[i] + h0[i], 0.0);
+        return dense(h1, w2, b2, false);
+    }
+};
+
+} // namespace
+
+TEST(CPU_DenseNet_NONE, MatchesReference)
+{
+    const auto test = TestNet{};
+    const auto net  = miopen::ai::DenseNet{test.model};
+    ASSERT_EQ(net.GetNumInputs(), TestNet::inputs);
+    ASSERT_EQ(net.GetNumOutputs(), TestNet::outputs);
+
+    auto gen       = std::mt19937{1};
+    auto workspace = miopen::ai::DenseNet::Workspace{};
+
+    // Batches smaller and larger than a block, with a partial last block
+    for(const auto batch_size : {1, 7, 16, 41})
+    {
+        const auto inputs = Random(batch_size * TestNet::inputs, gen);
+        auto outputs      = std::vector<float>(batch_size * TestNet::outputs);
+        net.Forward(inputs.data(), batch_size, outputs.data(), workspace);
+
+        for(auto row = 0; row < batch_size; ++row)
+        {
+            const auto expected = test.Reference(inputs.data() + row * TestNet::inputs);
+            for(std::size_t i = 0; i < TestNet::outputs; ++i)
+                EXPECT_NEAR(outputs[row * TestNet::outputs + i], expected[i], 1e-4)
+                    << "batch " << batch_size << ", row " << row << ", output " << i;
+        }
+    }
+}
+
+TEST(CPU_DenseNet_NONE, VerifiesTests)
+{
+    auto test = TestNet{};
+
+    const auto inputs = std::vector<float>{0.5f, -0.25f, 1.0f, 0.0f, -1.0f};
+    const auto result = test.Reference(inputs.data());
+    auto outputs      = std::vector<float>(result.begin(), result.end());
+
+    const auto make_test = [&]() {
+        return nlohmann::json{
+            {{"inputs", {{{"shape", {TestNet::inputs}}, {"values", {EncodeBase64(inputs)}}}}},
+             {"outputs", {{{"shape", {TestNet::outputs}}, {"values", {EncodeBase64(outputs)}}}}}}};
+    };
+
+    test.model["tests"] = make_test();
+    EXPECT_NO_THROW(miopen::ai::DenseNet{test.model});
+
+    outputs[1] += 1.0f;
+    test.model["tests"] = make_test();
+    EXPECT_ANY_THROW(miopen::ai::DenseNet{test.model});
+    EXPECT_NO_THROW(miopen::ai::DenseNet(test.model, false));
+}
+
+TEST(CPU_DenseNet_NONE, RejectsUnsupportedModels)
+{
+    auto unsupported_layer = TestNet{}.model;
+    unsupported_layer["architecture"]["config"]["layers"][2] =
+        Layer("Softmax", "re_lu_0", {"dense_0"});
+    EXPECT_ANY_THROW(miopen::ai::DenseNet{unsupported_layer});
+
+    auto unsupported_activation = TestNet{}.model;
+    unsupported_activation["architecture"]["config"]["layers"][1]["config"]["activation"] = "tanh";
+    EXPECT_ANY_THROW(miopen::ai::DenseNet{unsupported_activation});
+
+    auto wrong_size                   = TestNet{}.model;
+    wrong_size["output_shapes"][0][0] = TestNet::outputs + 1;
+    EXPECT_ANY_THROW(miopen::ai::DenseNet{wrong_size});
+}
+
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
+TEST(CPU_DenseNet_NONE, MatchesFrugallyDeep)
+{
+    for(const auto* arch : {"gfx908", "gfx90a", "gfx942"})
+    {
+        const auto path = miopen::GetSystemDbPath() / (std::string{arch} + ".tn.model");
+        if(!miopen::fs::exists(path))
+            continue;
+
+        const auto reference = fdeep::load_model(path.string(), true, fdeep::dev_null_logger);
+        const auto net       = miopen::ai::DenseNet{nlohmann::json::parse(std::ifstream{path})};
+
+        // Normalized features are roughly standard normal
+        auto gen              = std::mt19937{};
+        auto dist             = std::normal_distribution<float>{};
+        const auto batch      = std::size_t{64};
+        const auto num_inputs = net.GetNumInputs();
+        auto inputs           = std::vector<float>(batch * num_inputs);
+        for(auto& value : inputs)
+            value = dist(gen);
+
+        auto outputs   = std::vector<float>(batch * net.GetNumOutputs());
+        auto workspace = miopen::ai::DenseNet::Workspace{};
+        net.Forward(inputs.data(), batch, outputs.data(), workspace);
+
+        for(std::size_t row = 0; row < batch; ++row)
+        {
+            const auto* features = inputs.data() + row * num_inputs;
+            const auto input     = fdeep::tensor(fdeep::tensor_shape(num_inputs),
+                                             std::vector<float>(features, features + num_inputs));
+            const auto expected  = reference.predict({input}).front().to_vector();
+            for(std::size_t i = 0; i < net.GetNumOutputs(); ++i)
+            {
+                const auto actual = outputs[row * net.GetNumOutputs() + i];
+                EXPECT_NEAR(actual, expected[i], 1e-4 * std::max(1.0f, std::abs(expected[i])))
+                    << arch << ", row " << row << ", output " << i;
+            }
+        }
+    }
+}
+#endif
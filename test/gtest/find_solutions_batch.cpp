@@ -0,0 +1,112 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "get_handle.hpp"
+
+#include <miopen/convolution.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/search_options.hpp>
+#include <miopen/solution.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+
+miopen::Problem MakeConvProblem(int n, int c, int k, miopenProblemDirection_t direction)
+{
+    auto problem = miopen::Problem{};
+    problem.SetOperatorDescriptor(miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}});
+    problem.SetDirection(direction);
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionX,
+                                     miopen::TensorDescriptor{miopenFloat, {n, c, 14, 14}});
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionW,
+                                     miopen::TensorDescriptor{miopenFloat, {k, c, 3, 3}});
+    problem.RegisterTensorDescriptor(miopenTensorConvolutionY,
+                                     miopen::TensorDescriptor{miopenFloat, {n, k, 14, 14}});
+    return problem;
+}
+
+std::vector<uint64_t> GetSolverIds(const std::vector<miopen::Solution>& solutions)
+{
+    auto ids = std::vector<uint64_t>{};
+    for(const auto& solution : solutions)
+        ids.push_back(solution.GetSolver().Value());
+    return ids;
+}
+
+} // namespace
+
+TEST(CPU_FindSolutionsBatch_NONE, FirstIdenticalProblems)
+{
+    const auto fwd      = MakeConvProblem(16, 8, 32, miopenProblemDirectionForward);
+    const auto bwd      = MakeConvProblem(16, 8, 32, miopenProblemDirectionBackward);
+    const auto batch_32 = MakeConvProblem(32, 8, 32, miopenProblemDirectionForward);
+
+    auto fused = miopen::FusedProblem{};
+    fused.problems.push_back(fwd);
+
+    // The same problem with the tensors registered in another order
+    auto reordered = miopen::Problem{};
+    reordered.SetOperatorDescriptor(fwd.GetOperatorDescriptor());
+    reordered.SetDirection(fwd.GetDirection());
+    for(const auto id :
+        {miopenTensorConvolutionY, miopenTensorConvolutionW, miopenTensorConvolutionX})
+        reordered.RegisterTensorDescriptor(id, fwd.GetTensorDescriptor(id));
+
+    const auto problems = std::vector<miopen::ProblemContainer::Item>{
+        fwd, bwd, fwd, batch_32, fused, bwd, miopen::FusedProblem{fused}, reordered};
+
+    EXPECT_EQ(miopen::GetFirstIdenticalProblems(problems),
+              (std::vector<std::size_t>{0, 1, 0, 3, 4, 1, 4, 0}));
+    EXPECT_TRUE(miopen::GetFirstIdenticalProblems({}).empty());
+}
+
+TEST(GPU_FindSolutionsBatch_FP32, MatchesSingleFind)
+{
+    auto& handle       = get_handle();
+    const auto fwd     = MakeConvProblem(16, 8, 32, miopenProblemDirectionForward);
+    const auto bwd     = MakeConvProblem(16, 8, 32, miopenProblemDirectionBackward);
+    const auto options = miopen::FindOptions{};
+
+    const auto batch = miopen::FindSolutionsBatch(handle, {fwd, bwd, fwd}, options, 3);
+    ASSERT_EQ(batch.size(), 3);
+
+    for(const auto& solutions : batch)
+    {
+        ASSERT_FALSE(solutions.empty());
+        EXPECT_LE(solutions.size(), 3);
+    }
+
+    // Duplicates are searched once
+    EXPECT_EQ(GetSolverIds(batch[0]), GetSolverIds(batch[2]));
+
+    // The problems are solved as by a separate search, which now hits the find-db or the
+    // kernels compiled by the batch.
+    const auto single = fwd.FindSolutions(handle, options, 3);
+    EXPECT_EQ(single.size(), batch[0].size());
+}
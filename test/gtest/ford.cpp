@@ -0,0 +1,77 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "../ford.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+template <class Loop>
+void CheckVisitsAll(Loop loop, std::size_t a, std::size_t b, std::size_t c)
+{
+    auto visits = std::vector<std::atomic<int>>(a * b * c);
+
+    loop(a, b, c)([&](std::size_t i, std::size_t j, std::size_t k) {
+        ASSERT_LT(i, a);
+        ASSERT_LT(j, b);
+        ASSERT_LT(k, c);
+        ++visits[(i * b + j) * c + k];
+    });
+
+    for(const auto& visit : visits)
+        EXPECT_EQ(visit.load(), 1);
+}
+
+} // namespace
+
+TEST(CPU_Ford_NONE, ParFordVisitsAll)
+{
+    CheckVisitsAll(par_ford, 3, 5, 7);
+    CheckVisitsAll(par_ford, 1, 1, 1);
+    CheckVisitsAll(par_ford, 2, 0, 3);
+    CheckVisitsAll(par_ford, 64, 33, 17);
+}
+
+TEST(CPU_Ford_NONE, ParFordTiledVisitsAll)
+{
+    // Tiles are 16x16, lengths around multiples of it are the interesting cases
+    CheckVisitsAll(par_ford_tiled, 3, 5, 7);
+    CheckVisitsAll(par_ford_tiled, 2, 16, 32);
+    CheckVisitsAll(par_ford_tiled, 2, 17, 31);
+    CheckVisitsAll(par_ford_tiled, 1, 0, 31);
+    CheckVisitsAll(par_ford_tiled, 4, 100, 3);
+}
+
+TEST(CPU_Ford_NONE, ParFordTiled1D)
+{
+    auto sum = std::atomic<std::size_t>{0};
+    par_ford_tiled(100)([&](std::size_t i) { sum += i; });
+    EXPECT_EQ(sum.load(), 4950);
+}
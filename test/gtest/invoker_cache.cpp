@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/invoker_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+
+namespace {
+
+struct TestInvoker
+{
+    int id;
+
+    void operator()(const miopen::Handle&, const miopen::AnyInvokeParams&) const {}
+};
+
+int GetId(const std::optional<miopen::Invoker>& invoker)
+{
+    if(!invoker)
+        return -1;
+    const auto target = invoker->target<TestInvoker>();
+    return target != nullptr ? target->id : -1;
+}
+
+miopen::NetworkConfig Config(int idx)
+{
+    return miopen::NetworkConfig{"cfg" + std::to_string(idx)};
+}
+
+} // namespace
+
+TEST(CPU_InvokerCache_NONE, Lookup)
+{
+    auto cache = miopen::InvokerCache{};
+
+    EXPECT_FALSE(cache.Find(Config(0), "solver"));
+    EXPECT_FALSE(cache.GetFound1_0(Config(0), "algo"));
+
+    // Enough configs to make the table grow a few times
+    constexpr auto configs = 1000;
+    for(auto i = 0; i < configs; ++i)
+    {
+        cache.Register(Config(i), "solver_a", TestInvoker{2 * i});
+        cache.Register(Config(i), "solver_b", TestInvoker{2 * i + 1});
+    }
+
+    for(auto i = 0; i < configs; ++i)
+    {
+        EXPECT_EQ(GetId(cache.Find(Config(i), "solver_a")), 2 * i);
+        EXPECT_EQ(GetId(cache.Find(Config(i), "solver_b")), 2 * i + 1);
+        EXPECT_FALSE(cache.Find(Config(i), "solver_c"));
+    }
+    EXPECT_FALSE(cache.Find(Config(configs), "solver_a"));
+
+    // The first registered invoker is kept
+    cache.Register(Config(0), "solver_a", TestInvoker{-2});
+    EXPECT_EQ(GetId(cache.Find(Config(0), "solver_a")), 0);
+}
+
+TEST(CPU_InvokerCache_NONE, Found1_0)
+{
+    auto cache = miopen::InvokerCache{};
+
+    cache.Register(Config(0), "solver_a", TestInvoker{1});
+    cache.Register(Config(0), "solver_b", TestInvoker{2});
+
+    EXPECT_FALSE(cache.GetFound1_0(Config(0), "algo"));
+    EXPECT_THROW(cache.SetAsFound1_0(Config(1), "algo", "solver_a"), miopen::Exception);
+    EXPECT_THROW(cache.SetAsFound1_0(Config(0), "algo", "solver_c"), miopen::Exception);
+
+    cache.SetAsFound1_0(Config(0), "algo", "solver_a");
+    EXPECT_EQ(GetId(cache.GetFound1_0(Config(0), "algo")), 1);
+    EXPECT_EQ(cache.GetFound1_0SolverId(Config(0), "algo"), "solver_a");
+    EXPECT_FALSE(cache.GetFound1_0(Config(0), "other_algo"));
+
+    cache.SetAsFound1_0(Config(0), "algo", "solver_b");
+    EXPECT_EQ(GetId(cache.GetFound1_0(Config(0), "algo")), 2);
+}
+
+TEST(CPU_InvokerCache_NONE, LookupBySolverId)
+{
+    auto cache         = miopen::InvokerCache{};
+    const auto naive   = miopen::solver::Id{"ConvDirectNaiveConvFwd"};
+    const auto gemm    = miopen::solver::Id{"GemmFwd1x1_0_1"};
+    const auto invalid = miopen::solver::Id{};
+    ASSERT_TRUE(naive.IsValid());
+    ASSERT_TRUE(gemm.IsValid());
+
+    cache.Register(Config(0), naive.ToString(), TestInvoker{1});
+    cache.Register(Config(0), "not_a_solver", TestInvoker{2});
+
+    EXPECT_EQ(GetId(cache.FindById(Config(0), naive)), 1);
+    EXPECT_FALSE(cache.FindById(Config(0), gemm));
+    EXPECT_FALSE(cache.FindById(Config(0), invalid));
+    EXPECT_FALSE(cache.FindById(Config(1), naive));
+}
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/kernel_build_service.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const auto key =
+    miopen::KernelBuildService::MakeKey("0:gfx90a", "kernel.cl", "-DVALUE=1", "", false);
+const auto other_key =
+    miopen::KernelBuildService::MakeKey("1:gfx90a", "kernel.cl", "-DVALUE=1", "", false);
+
+} // namespace
+
+TEST(CPU_KernelBuildService_NONE, Key)
+{
+    using miopen::KernelBuildService;
+    EXPECT_EQ(key, KernelBuildService::MakeKey("0:gfx90a", "kernel.cl", "-DVALUE=1", "", false));
+    EXPECT_NE(key, other_key);
+    EXPECT_NE(key, KernelBuildService::MakeKey("0:gfx90a", "kernel.cl", "-DVALUE=2", "", false));
+    EXPECT_NE(key, KernelBuildService::MakeKey("0:gfx90a", "kernel.cl", "-DVALUE=1", "src", false));
+    EXPECT_NE(key, KernelBuildService::MakeKey("0:gfx90a", "kernel.cl", "-DVALUE=1", "", true));
+}
+
+TEST(CPU_KernelBuildService_NONE, SingleFlight)
+{
+    auto service = miopen::KernelBuildService{2};
+    auto builds  = std::atomic<int>{0};
+
+    const auto build = [&]() {
+        ++builds;
+        // Keeps the build in flight while the other requests arrive
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        return miopen::Program{};
+    };
+
+    auto threads = std::vector<std::thread>{};
+    for(auto i = 0; i < 4; ++i)
+        threads.emplace_back([&]() { service.Build(key, build); });
+    auto futures = std::vector<miopen::KernelBuildFuture>{};
+    for(auto i = 0; i < 4; ++i)
+        futures.push_back(service.Submit(key, build));
+    for(auto& thread : threads)
+        thread.join();
+    for(const auto& future : futures)
+        future.get();
+
+    EXPECT_EQ(builds, 1);
+
+    // Finished builds are not kept
+    service.Build(key, build);
+    service.Submit(other_key, build).get();
+    EXPECT_EQ(builds, 3);
+
+    const auto stats = service.GetStats();
+    EXPECT_EQ(stats.requests, 10);
+    EXPECT_EQ(stats.deduplicated, 7);
+    EXPECT_EQ(stats.builds, 3);
+    EXPECT_EQ(stats.failed, 0);
+    EXPECT_GE(stats.max_ms, 100.0);
+    EXPECT_GE(stats.total_ms, stats.max_ms);
+}
+
+TEST(CPU_KernelBuildService_NONE, FailedBuild)
+{
+    auto service = miopen::KernelBuildService{1};
+
+    const auto future = service.Submit(key, []() -> miopen::Program {
+        throw std::runtime_error("Build has failed");
+    });
+    EXPECT_THROW(future.get(), std::runtime_error);
+    EXPECT_THROW(future.get(), std::runtime_error);
+
+    // Failed builds are not kept either
+    auto builds = 0;
+    service.Build(key, [&]() {
+        ++builds;
+        return miopen::Program{};
+    });
+    EXPECT_EQ(builds, 1);
+    EXPECT_EQ(service.GetStats().failed, 1);
+}
+
+TEST(CPU_KernelBuildService_NONE, Bounded)
+{
+    auto service = miopen::KernelBuildService{2};
+    auto running = std::atomic<int>{0};
+    auto peak    = std::atomic<int>{0};
+
+    auto futures = std::vector<miopen::KernelBuildFuture>{};
+    for(auto i = 0; i < 16; ++i)
+    {
+        const auto options = "-DVALUE=" + std::to_string(i);
+        const auto k =
+            miopen::KernelBuildService::MakeKey("0:gfx90a", "kernel.cl", options, "", false);
+        futures.push_back(service.Submit(k, [&]() {
+            const auto now = ++running;
+            auto prev      = peak.load();
+            while(prev < now && !peak.compare_exchange_weak(prev, now)) {}
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            --running;
+            return miopen::Program{};
+        }));
+    }
+
+    service.WaitAll();
+    for(const auto& future : futures)
+        EXPECT_TRUE(future.is_ready());
+    EXPECT_LE(peak, 2);
+    EXPECT_EQ(service.GetStats().builds, 16);
+}
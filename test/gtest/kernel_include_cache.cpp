@@ -0,0 +1,71 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/kernel.hpp>
+#include <miopen/kernel_include_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+TEST(CPU_KernelIncludeCache_NONE, Table)
+{
+    const auto& table    = miopen::GetKernelIncludeTable();
+    const auto& inc_list = miopen::GetKernelIncList();
+
+    ASSERT_EQ(table.names.size(), inc_list.size());
+    ASSERT_EQ(table.contents.size(), inc_list.size());
+    ASSERT_EQ(table.name_ptrs.size(), inc_list.size());
+    ASSERT_EQ(table.texts.size(), inc_list.size());
+
+    for(std::size_t i = 0; i < inc_list.size(); ++i)
+    {
+        EXPECT_EQ(table.names[i], inc_list[i].get().string());
+        EXPECT_EQ(std::string{table.name_ptrs[i]}, table.names[i]);
+        EXPECT_EQ(table.contents[i], miopen::GetKernelInc(inc_list[i]));
+        EXPECT_EQ(std::string_view{table.texts[i]}, table.contents[i]);
+    }
+
+    EXPECT_EQ(&miopen::GetKernelIncludeTable(), &table);
+}
+
+TEST(CPU_KernelIncludeCache_NONE, Dir)
+{
+    const auto& dir = miopen::GetKernelIncludeDir();
+    ASSERT_TRUE(miopen::fs::is_directory(dir));
+    EXPECT_EQ(&miopen::GetKernelIncludeDir(), &dir);
+
+    const auto& table = miopen::GetKernelIncludeTable();
+    for(std::size_t i = 0; i < table.names.size(); ++i)
+    {
+        auto file = std::ifstream{dir / table.names[i], std::ios::binary};
+        ASSERT_TRUE(file) << table.names[i];
+        const auto text =
+            std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+        EXPECT_EQ(text, table.contents[i]) << table.names[i];
+    }
+}
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/mapped_db.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+
+namespace {
+
+struct TestValues
+{
+    std::string str;
+
+    void Serialize(std::ostream& stream) const { stream << str; }
+
+    bool Deserialize(const std::string& s)
+    {
+        str = s;
+        return true;
+    }
+};
+
+void WriteTextDb(const miopen::fs::path& path)
+{
+    auto out = std::ofstream{path};
+    out << "key_b=solver_1:1,2,3;solver_2:4,5" << std::endl;
+    out << std::endl;
+    out << "key_a=solver_3:6" << std::endl;
+    out << "=no_key" << std::endl;
+    out << "key_a=solver_4:duplicate_ignored" << std::endl;
+    out << "key_c=solver_1:" << std::endl;
+}
+
+} // namespace
+
+TEST(CPU_MappedDb_NONE, FindRecord)
+{
+    // The index is built next to the text db, so both are removed with the directory.
+    const miopen::TmpDir dir{"mapped_db"};
+    const auto text_db = dir.path / "test.db.txt";
+    WriteTextDb(text_db);
+
+    const auto index_path = miopen::MappedDb::GetPath(text_db);
+    ASSERT_TRUE(miopen::MappedDb::Build(miopen::DbKinds::PerfDb, text_db, index_path));
+
+    const auto db = miopen::MappedDb::Open(miopen::DbKinds::PerfDb, index_path, text_db);
+    ASSERT_NE(db, nullptr);
+    ASSERT_EQ(db->GetSize(), 3);
+
+    // Records are sorted by key.
+    EXPECT_EQ(db->GetKey(0), "key_a");
+    EXPECT_EQ(db->GetKey(1), "key_b");
+    EXPECT_EQ(db->GetKey(2), "key_c");
+    EXPECT_EQ(db->GetLine(1), 1);
+
+    auto value = TestValues{};
+
+    const auto a = db->FindRecord("key_a");
+    ASSERT_TRUE(a);
+    EXPECT_EQ(a->GetSize(), 1);
+    EXPECT_TRUE(a->GetValues("solver_3", value));
+    EXPECT_EQ(value.str, "6");
+
+    const auto b = db->FindRecord("key_b");
+    ASSERT_TRUE(b);
+    EXPECT_EQ(b->GetSize(), 2);
+    EXPECT_TRUE(b->GetValues("solver_1", value));
+    EXPECT_EQ(value.str, "1,2,3");
+    EXPECT_TRUE(b->GetValues("solver_2", value));
+    EXPECT_EQ(value.str, "4,5");
+
+    const auto c = db->FindRecord("key_c");
+    ASSERT_TRUE(c);
+    EXPECT_TRUE(c->GetValues("solver_1", value));
+    EXPECT_EQ(value.str, "");
+
+    EXPECT_FALSE(db->FindRecord("key"));
+    EXPECT_FALSE(db->FindRecord("key_d"));
+    EXPECT_FALSE(db->FindRecord(""));
+}
+
+TEST(CPU_MappedDb_NONE, RejectMismatch)
+{
+    const miopen::TmpDir dir{"mapped_db"};
+    const auto text_db = dir.path / "test.db.txt";
+    WriteTextDb(text_db);
+
+    const auto index_path = miopen::MappedDb::GetPath(text_db);
+    ASSERT_TRUE(miopen::MappedDb::Build(miopen::DbKinds::FindDb, text_db, index_path));
+    const auto built_mtime = miopen::fs::last_write_time(text_db);
+
+    // Wrong kind of db.
+    EXPECT_EQ(miopen::MappedDb::Open(miopen::DbKinds::PerfDb, index_path, text_db), nullptr);
+    EXPECT_NE(miopen::MappedDb::Open(miopen::DbKinds::FindDb, index_path, text_db), nullptr);
+
+    // Text db has been edited in place after the index was built, keeping its size.
+    {
+        auto out = std::fstream{text_db, std::ios::in | std::ios::out};
+        out.seekp(std::string{"key_b=solver_1:"}.size());
+        out << "9";
+    }
+    EXPECT_EQ(miopen::MappedDb::Open(miopen::DbKinds::FindDb, index_path, text_db), nullptr);
+
+    // The contents are not read, a text db of the same size with another mtime is stale...
+    WriteTextDb(text_db);
+    miopen::fs::last_write_time(text_db, built_mtime + std::chrono::hours(1));
+    EXPECT_EQ(miopen::MappedDb::Open(miopen::DbKinds::FindDb, index_path, text_db), nullptr);
+
+    // ...and one with the same mtime, as installation leaves it, is up to date.
+    miopen::fs::last_write_time(text_db, built_mtime);
+    EXPECT_NE(miopen::MappedDb::Open(miopen::DbKinds::FindDb, index_path, text_db), nullptr);
+
+    // Text db has been appended to after the index was built.
+    {
+        auto out = std::ofstream{text_db, std::ios::app};
+        out << "key_d=solver_1:7" << std::endl;
+    }
+    EXPECT_EQ(miopen::MappedDb::Open(miopen::DbKinds::FindDb, index_path, text_db), nullptr);
+
+    // Not an index at all.
+    {
+        auto out = std::ofstream{index_path, std::ios::trunc};
+        out << "key_a=solver_3:6" << std::endl;
+    }
+    EXPECT_EQ(miopen::MappedDb::Open(miopen::DbKinds::FindDb, index_path, text_db), nullptr);
+
+    EXPECT_EQ(miopen::MappedDb::Open(miopen::DbKinds::FindDb, "", text_db), nullptr);
+}
+
+TEST(CPU_MappedDb_NONE, Snapshot)
+{
+    const miopen::TmpDir dir{"mapped_db"};
+    const miopen::TmpDir snapshot_dir{"mapped_db_snapshot"};
+    const auto text_db = dir.path / "test.db.txt";
+    WriteTextDb(text_db);
+
+    const auto snapshot_path = miopen::MappedDb::GetSnapshotPath(snapshot_dir.path, text_db);
+    EXPECT_FALSE(miopen::fs::exists(snapshot_path));
+
+    // The first open publishes the snapshot, the next one only maps it.
+    const auto published =
+        miopen::MappedDb::OpenSnapshot(miopen::DbKinds::PerfDb, snapshot_dir.path, text_db);
+    ASSERT_NE(published, nullptr);
+    EXPECT_EQ(published->GetSize(), 3);
+    ASSERT_TRUE(miopen::fs::exists(snapshot_path));
+
+    const auto mtime = miopen::fs::last_write_time(snapshot_path);
+    const auto attached =
+        miopen::MappedDb::OpenSnapshot(miopen::DbKinds::PerfDb, snapshot_dir.path, text_db);
+    ASSERT_NE(attached, nullptr);
+    EXPECT_EQ(attached->GetSize(), 3);
+    EXPECT_EQ(miopen::fs::last_write_time(snapshot_path), mtime);
+
+    // Same size, different contents and mtime.
+    const auto text_mtime = miopen::fs::last_write_time(text_db);
+    {
+        auto out = std::ofstream{text_db, std::ios::trunc};
+        out << "key_b=solver_1:1,2,3;solver_2:4,6" << std::endl;
+        out << std::endl;
+        out << "key_a=solver_3:6" << std::endl;
+        out << "=no_key" << std::endl;
+        out << "key_a=solver_4:duplicate_ignored" << std::endl;
+        out << "key_c=solver_1:" << std::endl;
+    }
+    miopen::fs::last_write_time(text_db, text_mtime + std::chrono::hours(1));
+
+    EXPECT_EQ(miopen::MappedDb::Open(miopen::DbKinds::PerfDb, snapshot_path, text_db, true),
+              nullptr);
+
+    const auto rebuilt =
+        miopen::MappedDb::OpenSnapshot(miopen::DbKinds::PerfDb, snapshot_dir.path, text_db);
+    ASSERT_NE(rebuilt, nullptr);
+
+    auto value = TestValues{};
+    const auto b = rebuilt->FindRecord("key_b");
+    ASSERT_TRUE(b);
+    EXPECT_TRUE(b->GetValues("solver_2", value));
+    EXPECT_EQ(value.str, "4,6");
+
+    // The mapping made before the rebuild still sees the old contents.
+    const auto old_b = published->FindRecord("key_b");
+    ASSERT_TRUE(old_b);
+    EXPECT_TRUE(old_b->GetValues("solver_2", value));
+    EXPECT_EQ(value.str, "4,5");
+}
@@ -80,7 +80,7 @@ void Dot_3D_3D(const tensor<T>& A_mat, const tensor<T>& B_mat, tensor<T>& C_mat)
 {
     size_t k_val = A_mat.desc.GetLengths()[2];
     assert(k_val == B_mat.desc.GetLengths()[1]);
-    C_mat.par_for_each([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
+    C_mat.par_for_each_tiled([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
         double sum(0);
         for(size_t k_id = 0; k_id < k_val; ++k_id)
         {
@@ -95,7 +95,7 @@ void Dot_3D_3D_T(const tensor<T>& A_mat, const tensor<T>& B_mat, tensor<T>& C_ma
 {
     size_t k_val = A_mat.desc.GetLengths()[2];
     assert(k_val == B_mat.desc.GetLengths()[2]);
-    C_mat.par_for_each([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
+    C_mat.par_for_each_tiled([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
         double sum(0);
         for(size_t k_id = 0; k_id < k_val; ++k_id)
         {
@@ -111,7 +111,7 @@ void Dot_4D_4D_T(const tensor<T1>& A_mat, const tensor<T3>& B_mat, tensor<T2>& C
     size_t k_val = A_mat.desc.GetLengths()[3];
     assert(k_val == B_mat.desc.GetLengths()[3]); // since transpose
 
-    C_mat.par_for_each([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
+    C_mat.par_for_each_tiled([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
         double sum(0);
         for(size_t k_id = 0; k_id < k_val; ++k_id)
         {
@@ -128,7 +128,7 @@ void Dot_4D_T_4D(const tensor<T1>& A_mat, const tensor<T3>& B_mat, tensor<T2>& C
     size_t k_val = A_mat.desc.GetLengths()[3];
     assert(k_val == B_mat.desc.GetLengths()[2]); // since transpose
 
-    C_mat.par_for_each([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
+    C_mat.par_for_each_tiled([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
         double sum(0);
         for(size_t k_id = 0; k_id < k_val; ++k_id)
         {
@@ -144,7 +144,7 @@ void Dot_4D_4D(const tensor<T1>& A_mat, const tensor<T2>& B_mat, tensor<T3>& C_m
 {
     size_t k_val = A_mat.desc.GetLengths()[3];
     assert(k_val == B_mat.desc.GetLengths()[2]);
-    C_mat.par_for_each([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
+    C_mat.par_for_each_tiled([&](size_t b_id, size_t h_id, size_t sl_id, size_t dk_id) {
         double sum(0);
         for(size_t k_id = 0; k_id < k_val; ++k_id)
         {
@@ -160,7 +160,7 @@ void Dot_3D_2D_T(const tensor<T1>& A_mat, const tensor<T1>& B_mat, tensor<T2>& C
 {
     size_t k_val = A_mat.desc.GetLengths()[2];
     assert(k_val == B_mat.desc.GetLengths()[1]);
-    C_mat.par_for_each([&](size_t b_id, size_t s_id, size_t pd_id) {
+    C_mat.par_for_each_tiled([&](size_t b_id, size_t s_id, size_t pd_id) {
         double sum(0);
         for(size_t k_id = 0; k_id < k_val; ++k_id)
         {
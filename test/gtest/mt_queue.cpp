@@ -27,6 +27,8 @@
 #include <miopen/mt_queue.hpp>
 #include <thread>
 #include <chrono>
+#include <future>
+#include <memory>
 
 #include "random.hpp"
 
@@ -79,3 +81,62 @@ TEST(CPU_UtilMultiThreadQueue_NONE, Basic)
         std::cout << tmp << std::endl;
     EXPECT_EQ(num_prod, num_cons);
 }
+
+TEST(CPU_UtilMultiThreadQueue_NONE, Bounded)
+{
+    ThreadSafeQueue<std::unique_ptr<int>> comp_queue{2};
+    std::atomic<int> pushed{0};
+    std::promise<void> filled;
+
+    std::thread producer_thread([&]() {
+        for(auto idx = 0; idx < 10; ++idx)
+        {
+            comp_queue.push(std::make_unique<int>(idx));
+            if(++pushed == 2)
+                filled.set_value();
+        }
+    });
+
+    filled.get_future().wait();
+
+    // The producer can't get more than two items ahead of the consumer
+    for(auto idx = 0; idx < 10; ++idx)
+    {
+        EXPECT_LE(pushed, idx + 2);
+        EXPECT_EQ(*comp_queue.pop(), idx);
+    }
+
+    producer_thread.join();
+    EXPECT_EQ(pushed, 10);
+}
+
+TEST(CPU_UtilMultiThreadQueue_NONE, Close)
+{
+    ThreadSafeQueue<int> comp_queue{1};
+    EXPECT_TRUE(comp_queue.push(1));
+
+    std::thread producer_thread([&]() { EXPECT_FALSE(comp_queue.push(2)); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    comp_queue.close();
+    producer_thread.join();
+
+    EXPECT_EQ(comp_queue.pop(), 1);
+    EXPECT_FALSE(comp_queue.push(3));
+}
+
+TEST(CPU_UtilMultiThreadQueue_NONE, TryPop)
+{
+    ThreadSafeQueue<int> comp_queue{1};
+    auto item = 0;
+    EXPECT_FALSE(comp_queue.try_pop(item));
+
+    EXPECT_TRUE(comp_queue.push(1));
+    EXPECT_TRUE(comp_queue.try_pop(item));
+    EXPECT_EQ(item, 1);
+    EXPECT_FALSE(comp_queue.try_pop(item));
+
+    // The slot taken by try_pop is free again
+    EXPECT_TRUE(comp_queue.push(2));
+    EXPECT_EQ(comp_queue.pop(), 2);
+}
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/precompile.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/temp_file.hpp>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const auto problem       = miopen::NetworkConfig{"problem"};
+const auto other_problem = miopen::NetworkConfig{"other_problem"};
+
+} // namespace
+
+TEST(CPU_BackgroundPrecompiler_NONE, Inactive)
+{
+    auto precompiler = miopen::BackgroundPrecompiler{};
+
+    // Nothing has been submitted, so lookups are not counted
+    EXPECT_FALSE(precompiler.Wait(problem));
+    EXPECT_EQ(precompiler.GetStats().misses, 0);
+}
+
+TEST(CPU_BackgroundPrecompiler_NONE, WaitsForNeededProblemOnly)
+{
+    auto precompiler = miopen::BackgroundPrecompiler{};
+    auto release     = std::atomic<bool>{false};
+    auto compiled    = std::atomic<int>{0};
+
+    precompiler.Submit(problem, [&]() { ++compiled; });
+    precompiler.Submit(other_problem, [&]() {
+        while(!release)
+            std::this_thread::yield();
+        ++compiled;
+    });
+    // Duplicates are dropped
+    precompiler.Submit(problem, [&]() { ++compiled; });
+
+    // Doesn't wait for the other problem, which is blocked
+    EXPECT_TRUE(precompiler.Wait(problem));
+    EXPECT_GE(compiled.load(), 1);
+    EXPECT_FALSE(precompiler.Wait(miopen::NetworkConfig{"unknown"}));
+
+    release = true;
+    EXPECT_TRUE(precompiler.Wait(other_problem));
+    EXPECT_EQ(compiled.load(), 2);
+    // Nothing is being compiled anymore, so this is neither looked up nor counted
+    EXPECT_FALSE(precompiler.Wait(other_problem));
+
+    const auto stats = precompiler.GetStats();
+    EXPECT_EQ(stats.queued, 2);
+    EXPECT_EQ(stats.completed, 2);
+    EXPECT_EQ(stats.failed, 0);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.hits + stats.waits, 2);
+}
+
+TEST(CPU_BackgroundPrecompiler_NONE, Failure)
+{
+    auto precompiler = miopen::BackgroundPrecompiler{};
+
+    precompiler.Submit(problem, []() { throw std::runtime_error{"failed"}; });
+
+    EXPECT_TRUE(precompiler.Wait(problem));
+    EXPECT_EQ(precompiler.GetStats().failed, 1);
+    EXPECT_EQ(precompiler.GetStats().completed, 0);
+}
+
+TEST(CPU_BackgroundPrecompiler_NONE, NoSelfWait)
+{
+    auto precompiler = miopen::BackgroundPrecompiler{};
+    auto waited      = std::atomic<bool>{true};
+
+    // Background tasks go through the same code as the foreground calls
+    precompiler.Submit(problem, [&]() { waited = precompiler.Wait(problem); });
+    precompiler.WaitAll();
+
+    EXPECT_FALSE(waited.load());
+}
+
+TEST(CPU_BackgroundPrecompiler_NONE, Manifest)
+{
+    auto conv = miopen::Problem{};
+    conv.SetOperatorDescriptor(miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}});
+    conv.SetDirection(miopenProblemDirectionForward);
+    conv.RegisterTensorDescriptor(miopenTensorConvolutionX,
+                                  miopen::TensorDescriptor{miopenFloat, {16, 8, 14, 14}});
+    conv.RegisterTensorDescriptor(miopenTensorConvolutionW,
+                                  miopen::TensorDescriptor{miopenFloat, {32, 8, 3, 3}});
+    conv.RegisterTensorDescriptor(miopenTensorConvolutionY,
+                                  miopen::TensorDescriptor{miopenFloat, {16, 32, 14, 14}});
+
+    const miopen::TempFile manifest{"miopen.test.precompile"};
+    {
+        auto out = std::ofstream{manifest.Path()};
+        out << nlohmann::json(std::vector<miopen::Problem>{conv, conv});
+    }
+
+    const auto problems = miopen::LoadPrecompileManifest(manifest);
+    ASSERT_EQ(problems.size(), 2);
+    EXPECT_EQ(problems[1].AsConvolution().MakeNetworkConfig(),
+              conv.AsConvolution().MakeNetworkConfig());
+
+    {
+        auto out = std::ofstream{manifest.Path()};
+        out << "[{";
+    }
+    EXPECT_ANY_THROW(miopen::LoadPrecompileManifest(manifest));
+}
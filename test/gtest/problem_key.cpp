@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/names.hpp>
+#include <miopen/problem_key.hpp>
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <type_traits>
+
+namespace {
+
+miopen::conv::ProblemDescription MakeConvProblem(std::size_t n,
+                                                 miopen::conv::Direction direction,
+                                                 miopenTensorLayout_t layout = miopenTensorNCHW)
+{
+    // Lengths are in the NCHW order whatever the layout is
+    return {miopen::TensorDescriptor{miopenFloat, layout, {n, 8, 14, 14}},
+            miopen::TensorDescriptor{miopenFloat, layout, {16, 8, 3, 3}},
+            miopen::TensorDescriptor{miopenFloat, layout, {n, 16, 14, 14}},
+            miopen::ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}},
+            direction};
+}
+
+} // namespace
+
+TEST(CPU_ProblemKey_NONE, Fields)
+{
+    static_assert(std::is_trivially_copyable<miopen::ProblemKey>{});
+
+    auto key = miopen::ProblemKey{"test"};
+    key.Add(3).Add(-1).Add(0.5f).AddString("NCHW").AddOptional(std::optional<int>{});
+    key.AddRange(std::vector<std::size_t>{7, 8});
+    EXPECT_EQ(key.ToString(), "test:3x-1x0.500000xNCHWx0x2x7x8");
+
+    auto same = key;
+    EXPECT_EQ(key, same);
+    EXPECT_EQ(key.Hash(), same.Hash());
+
+    // Values and strings with the same bits differ
+    auto as_int = miopen::ProblemKey{"test"};
+    auto as_str = miopen::ProblemKey{"test"};
+    as_int.Add(4).Add(0x74736574);
+    as_str.AddString("test");
+    EXPECT_NE(as_int, as_str);
+
+    auto other = miopen::ProblemKey{"test"};
+    other.Add(3).Add(-2);
+    EXPECT_NE(key, other);
+    EXPECT_NE(key.Hash(), other.Hash());
+
+    auto full = miopen::ProblemKey{""};
+    for(std::size_t i = 1; i < miopen::ProblemKey::capacity; ++i)
+        full.Add(i);
+    EXPECT_ANY_THROW(full.Add(0));
+}
+
+TEST(CPU_ProblemKey_NONE, NetworkConfig)
+{
+    auto key = miopen::ProblemKey{"test"};
+    key.Add(1);
+    const auto config = miopen::NetworkConfig{key};
+    EXPECT_EQ(config, miopen::NetworkConfig{key});
+    EXPECT_EQ(config.Hash(), key.Hash());
+    EXPECT_EQ(config.ToString(), "test:1");
+
+    // Configs refer to a single copy of the key
+    EXPECT_EQ(&miopen::ProblemKey::Intern(key), &miopen::ProblemKey::Intern(key));
+    auto copy = key;
+    EXPECT_EQ(&miopen::ProblemKey::Intern(copy), &miopen::ProblemKey::Intern(key));
+    copy.Add(2);
+    EXPECT_NE(&miopen::ProblemKey::Intern(copy), &miopen::ProblemKey::Intern(key));
+    EXPECT_NE(config, miopen::NetworkConfig{copy});
+
+    // The string form does not make a key
+    EXPECT_NE(config, miopen::NetworkConfig{"test:1"});
+    EXPECT_EQ(miopen::NetworkConfig{"test:1"}, miopen::NetworkConfig{"test:1"});
+}
+
+TEST(CPU_ProblemKey_NONE, Convolution)
+{
+    using miopen::conv::Direction;
+
+    const auto problem = MakeConvProblem(4, Direction::Forward);
+    EXPECT_EQ(problem.MakeNetworkConfig(),
+              MakeConvProblem(4, Direction::Forward).MakeNetworkConfig());
+    EXPECT_EQ(problem.MakeNetworkConfig().Hash(),
+              MakeConvProblem(4, Direction::Forward).MakeNetworkConfig().Hash());
+
+    // Everything that the string form tells apart
+    for(const auto& other : {MakeConvProblem(8, Direction::Forward),
+                             MakeConvProblem(4, Direction::BackwardData),
+                             MakeConvProblem(4, Direction::Forward, miopenTensorNHWC)})
+    {
+        std::string str;
+        std::string other_str;
+        problem.MakeNetworkConfig(str);
+        other.MakeNetworkConfig(other_str);
+        ASSERT_NE(str, other_str);
+        EXPECT_NE(problem.MakeNetworkConfig(), other.MakeNetworkConfig());
+        EXPECT_NE(problem.MakeNetworkConfig().Hash(), other.MakeNetworkConfig().Hash());
+    }
+}
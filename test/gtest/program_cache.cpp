@@ -0,0 +1,124 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/kernel_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const auto key       = miopen::ProgramCache::Key{"kernel.cl", "-DVALUE=1"};
+const auto other_key = miopen::ProgramCache::Key{"kernel.cl", "-DVALUE=2"};
+
+} // namespace
+
+TEST(CPU_ProgramCache_NONE, SingleFlight)
+{
+    auto cache  = miopen::ProgramCache{};
+    auto builds = std::atomic<int>{0};
+
+    const auto build = [&]() {
+        ++builds;
+        // Keeps the build in flight while the other threads arrive
+        std::this_thread::sleep_for(std::chrono::milliseconds{100});
+        return miopen::Program{};
+    };
+
+    auto threads = std::vector<std::thread>{};
+    for(auto i = 0; i < 8; ++i)
+        threads.emplace_back([&]() { cache.GetOrBuild(key, build); });
+    for(auto& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(builds, 1);
+    EXPECT_TRUE(cache.Contains(key));
+    EXPECT_TRUE(cache.Find(key));
+    EXPECT_FALSE(cache.Contains(other_key));
+    EXPECT_FALSE(cache.Find(other_key));
+
+    cache.GetOrBuild(other_key, build);
+    EXPECT_EQ(builds, 2);
+
+    cache.Remove(key);
+    EXPECT_FALSE(cache.Contains(key));
+    EXPECT_TRUE(cache.Contains(other_key));
+}
+
+TEST(CPU_ProgramCache_NONE, FailedBuild)
+{
+    auto cache = miopen::ProgramCache{};
+
+    EXPECT_THROW(cache.GetOrBuild(key,
+                                  []() -> miopen::Program {
+                                      throw std::runtime_error("Build has failed");
+                                  }),
+                 std::runtime_error);
+
+    // Failed programs are not cached, so the next request builds it again
+    EXPECT_FALSE(cache.Contains(key));
+    auto builds = 0;
+    cache.GetOrBuild(key, [&]() {
+        ++builds;
+        return miopen::Program{};
+    });
+    EXPECT_EQ(builds, 1);
+}
+
+TEST(CPU_ProgramCache_NONE, FailedBuildKeepsAdded)
+{
+    auto cache = miopen::ProgramCache{};
+
+    // Another user adds the program while the build is in flight
+    EXPECT_THROW(cache.GetOrBuild(key,
+                                  [&]() -> miopen::Program {
+                                      cache.Add(key, miopen::Program{});
+                                      throw std::runtime_error("Build has failed");
+                                  }),
+                 std::runtime_error);
+
+    EXPECT_TRUE(cache.Contains(key));
+    EXPECT_TRUE(cache.Find(key));
+}
+
+TEST(CPU_ProgramCache_NONE, Shared)
+{
+    auto cache = miopen::ProgramCache::GetShared("device0");
+    EXPECT_EQ(cache, miopen::ProgramCache::GetShared("device0"));
+    EXPECT_NE(cache, miopen::ProgramCache::GetShared("device1"));
+
+    cache->Add(key, miopen::Program{});
+    EXPECT_TRUE(miopen::ProgramCache::GetShared("device0")->Contains(key));
+
+    // Released together with the last user
+    cache.reset();
+    EXPECT_FALSE(miopen::ProgramCache::GetShared("device0")->Contains(key));
+}
@@ -0,0 +1,210 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/ramdb.hpp>
+#include <miopen/temp_file.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+struct TestValues
+{
+    std::string str;
+
+    void Serialize(std::ostream& stream) const { stream << str; }
+
+    bool Deserialize(const std::string& s)
+    {
+        str = s;
+        return true;
+    }
+};
+
+std::size_t CountLines(const miopen::fs::path& path)
+{
+    auto file  = std::ifstream{path};
+    auto line  = std::string{};
+    auto count = std::size_t{0};
+    while(std::getline(file, line))
+        if(!line.empty())
+            ++count;
+    return count;
+}
+
+miopen::DbRecord MakeRecord(const std::string& key, const std::string& id, const std::string& value)
+{
+    auto record = miopen::DbRecord{miopen::DbKinds::PerfDb, key};
+    record.SetValues(id, TestValues{value});
+    return record;
+}
+
+std::string LoadValue(miopen::RamDb& db, const std::string& key, const std::string& id)
+{
+    const auto record = db.FindRecord(key);
+    auto value        = TestValues{};
+    if(!record || !record->GetValues(id, value))
+        return "<none>";
+    return value.str;
+}
+
+} // namespace
+
+TEST(CPU_RamDbWriteBatch_NONE, FlushOnThreshold)
+{
+    if(miopen::DisableUserDbFileIO)
+        GTEST_SKIP();
+
+    const miopen::TempFile file{"miopen.test.ramdb_batch"};
+    auto db = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    db.SetWriteBatch(3, std::chrono::hours{1});
+
+    EXPECT_TRUE(db.StoreRecord(MakeRecord("key0", "solver", "0")));
+    auto record1 = MakeRecord("key1", "solver", "1");
+    EXPECT_TRUE(db.UpdateRecord(record1));
+
+    // Buffered records are visible through the same instance, but not written yet.
+    EXPECT_EQ(LoadValue(db, "key0", "solver"), "0");
+    EXPECT_EQ(LoadValue(db, "key1", "solver"), "1");
+    EXPECT_EQ(CountLines(file), 0);
+
+    EXPECT_TRUE(db.StoreRecord(MakeRecord("key2", "solver", "2")));
+    EXPECT_EQ(CountLines(file), 3);
+
+    auto other = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    EXPECT_EQ(LoadValue(other, "key0", "solver"), "0");
+    EXPECT_EQ(LoadValue(other, "key2", "solver"), "2");
+}
+
+TEST(CPU_RamDbWriteBatch_NONE, FlushOnDestruction)
+{
+    if(miopen::DisableUserDbFileIO)
+        GTEST_SKIP();
+
+    const miopen::TempFile file{"miopen.test.ramdb_batch"};
+
+    {
+        auto db = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+        db.SetWriteBatch(100, std::chrono::hours{1});
+        EXPECT_TRUE(db.StoreRecord(MakeRecord("key0", "solver", "0")));
+        EXPECT_EQ(CountLines(file), 0);
+    }
+
+    auto other = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    EXPECT_EQ(LoadValue(other, "key0", "solver"), "0");
+}
+
+TEST(CPU_RamDbWriteBatch_NONE, MergeWithConcurrentWriter)
+{
+    if(miopen::DisableUserDbFileIO)
+        GTEST_SKIP();
+
+    const miopen::TempFile file{"miopen.test.ramdb_batch"};
+
+    auto batched = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    batched.SetWriteBatch(100, std::chrono::hours{1});
+    auto record = MakeRecord("key0", "solver_a", "a");
+    EXPECT_TRUE(batched.UpdateRecord(record));
+
+    // Another writer changes the file while the batch is pending.
+    auto direct = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    auto other  = MakeRecord("key0", "solver_b", "b");
+    EXPECT_TRUE(direct.UpdateRecord(other));
+    EXPECT_TRUE(direct.StoreRecord(MakeRecord("key1", "solver", "1")));
+
+    EXPECT_TRUE(batched.Flush());
+
+    auto reader = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    EXPECT_EQ(LoadValue(reader, "key0", "solver_a"), "a");
+    EXPECT_EQ(LoadValue(reader, "key0", "solver_b"), "b");
+    EXPECT_EQ(LoadValue(reader, "key1", "solver"), "1");
+}
+
+TEST(CPU_RamDbWriteBatch_NONE, RemoveWritesBatch)
+{
+    if(miopen::DisableUserDbFileIO)
+        GTEST_SKIP();
+
+    const miopen::TempFile file{"miopen.test.ramdb_batch"};
+    auto db = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    db.SetWriteBatch(100, std::chrono::hours{1});
+
+    EXPECT_TRUE(db.StoreRecord(MakeRecord("key0", "solver", "0")));
+    EXPECT_TRUE(db.StoreRecord(MakeRecord("key1", "solver", "1")));
+    EXPECT_TRUE(db.RemoveRecord(std::string{"key0"}));
+
+    EXPECT_EQ(CountLines(file), 1);
+    EXPECT_EQ(LoadValue(db, "key0", "solver"), "<none>");
+    EXPECT_EQ(LoadValue(db, "key1", "solver"), "1");
+}
+
+TEST(CPU_RamDbWriteBatch_NONE, FlushOverdueOnRead)
+{
+    if(miopen::DisableUserDbFileIO)
+        GTEST_SKIP();
+
+    const miopen::TempFile file{"miopen.test.ramdb_batch"};
+    auto db = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    db.SetWriteBatch(100, std::chrono::hours{1});
+
+    EXPECT_TRUE(db.StoreRecord(MakeRecord("key0", "solver", "0")));
+    EXPECT_EQ(LoadValue(db, "key0", "solver"), "0");
+    EXPECT_EQ(CountLines(file), 0);
+
+    // The batch is overdue now, so the next access writes it.
+    db.SetWriteBatch(100, std::chrono::milliseconds{0});
+    EXPECT_EQ(LoadValue(db, "key0", "solver"), "0");
+    EXPECT_EQ(CountLines(file), 1);
+}
+
+TEST(CPU_RamDbWriteBatch_NONE, ReportWriteFailure)
+{
+    if(miopen::DisableUserDbFileIO)
+        GTEST_SKIP();
+
+    const miopen::TempFile file{"miopen.test.ramdb_batch"};
+    auto db = miopen::RamDb{miopen::DbKinds::PerfDb, file};
+    db.SetWriteBatch(2, std::chrono::hours{1});
+
+    // The batch is written through a temp file, which can't be created over a directory.
+    const auto temp_path = miopen::fs::path{file.Path().string() + ".temp"};
+    miopen::fs::create_directory(temp_path);
+
+    EXPECT_TRUE(db.StoreRecord(MakeRecord("key0", "solver", "0")));
+    EXPECT_FALSE(db.StoreRecord(MakeRecord("key1", "solver", "1")));
+    EXPECT_FALSE(db.Flush());
+    EXPECT_EQ(LoadValue(db, "key1", "solver"), "1");
+
+    // Failed records stay pending and are written once the file is writable.
+    miopen::fs::remove(temp_path);
+    EXPECT_TRUE(db.Flush());
+    EXPECT_EQ(CountLines(file), 2);
+}
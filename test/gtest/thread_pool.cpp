@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/par_for.hpp>
+#include <miopen/thread_pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(CPU_ThreadPool_NONE, ParallelForVisitsAll)
+{
+    auto pool   = miopen::ThreadPool{4};
+    auto visits = std::vector<std::atomic<int>>(1000);
+
+    pool.ParallelFor(visits.size(), 8, [&](auto i) { ++visits[i]; });
+
+    for(const auto& visit : visits)
+        EXPECT_EQ(visit.load(), 1);
+}
+
+TEST(CPU_ThreadPool_NONE, ParallelForBalances)
+{
+    auto pool = miopen::ThreadPool{2};
+    auto done = std::atomic<int>{0};
+
+    // The first item blocks until all the others are done. With a static split this would never
+    // finish, as the thread running it would own half of the items.
+    pool.ParallelFor(16, 2, [&](auto i) {
+        if(i == 0)
+        {
+            while(done < 15)
+                std::this_thread::yield();
+        }
+        else
+        {
+            ++done;
+        }
+    });
+
+    EXPECT_EQ(done.load(), 15);
+}
+
+TEST(CPU_ThreadPool_NONE, ParallelForRethrows)
+{
+    auto pool = miopen::ThreadPool{4};
+
+    EXPECT_THROW(pool.ParallelFor(100,
+                                  4,
+                                  [](auto i) {
+                                      if(i == 42)
+                                          throw std::runtime_error{"42"};
+                                  }),
+                 std::runtime_error);
+}
+
+TEST(CPU_ThreadPool_NONE, ParallelForRangesVisitsAll)
+{
+    auto pool   = miopen::ThreadPool{4};
+    auto visits = std::vector<std::atomic<int>>(10007);
+    auto ranges = std::atomic<int>{0};
+
+    pool.ParallelForRanges(visits.size(), 5, 16, [&](auto begin, auto end) {
+        EXPECT_LT(begin, end);
+        ++ranges;
+        for(auto i = begin; i < end; ++i)
+            ++visits[i];
+    });
+
+    for(const auto& visit : visits)
+        EXPECT_EQ(visit.load(), 1);
+    // Guided ranges: much fewer ranges than items, but more than threads
+    EXPECT_GT(ranges.load(), 5);
+    EXPECT_LT(ranges.load(), 10007 / 16);
+}
+
+TEST(CPU_ThreadPool_NONE, ParallelForRangesRethrows)
+{
+    auto pool = miopen::ThreadPool{4};
+
+    EXPECT_THROW(pool.ParallelForRanges(1000,
+                                        4,
+                                        1,
+                                        [](auto begin, auto end) {
+                                            if(begin <= 500 && 500 < end)
+                                                throw std::runtime_error{"500"};
+                                        }),
+                 std::runtime_error);
+}
+
+TEST(CPU_ThreadPool_NONE, NestedParallelFor)
+{
+    auto pool  = miopen::ThreadPool{2};
+    auto count = std::atomic<int>{0};
+
+    pool.ParallelFor(8, 3, [&](auto) { pool.ParallelFor(8, 3, [&](auto) { ++count; }); });
+
+    EXPECT_EQ(count.load(), 64);
+}
+
+TEST(CPU_ThreadPool_NONE, Submit)
+{
+    auto pool    = miopen::ThreadPool{3};
+    auto futures = std::vector<std::future<int>>{};
+
+    for(auto i = 0; i < 100; ++i)
+        futures.push_back(pool.Submit([i]() { return i * i; }));
+
+    for(auto i = 0; i < 100; ++i)
+        EXPECT_EQ(futures[i].get(), i * i);
+}
+
+TEST(CPU_ThreadPool_NONE, ParFor)
+{
+    auto sum = std::atomic<int>{0};
+
+    miopen::par_for(100, miopen::max_threads{4}, [&](auto i) { sum += static_cast<int>(i); });
+    miopen::par_for_strided(
+        100, miopen::max_threads{4}, [&](auto i) { sum += static_cast<int>(i); });
+
+    EXPECT_EQ(sum.load(), 2 * 4950);
+}
+
+TEST(CPU_ThreadPool_NONE, ParForRanges)
+{
+    auto sum = std::atomic<std::size_t>{0};
+
+    miopen::par_for_ranges(0, [&](auto, auto) { ADD_FAILURE(); });
+    miopen::par_for_ranges(1000, [&](auto begin, auto end) {
+        for(auto i = begin; i < end; ++i)
+            sum += i;
+    });
+
+    EXPECT_EQ(sum.load(), 499500);
+}
+
+TEST(CPU_ThreadPool_NONE, ParForStrided)
+{
+    constexpr std::size_t n = 103;
+    auto owners             = std::vector<std::thread::id>(n);
+    auto order              = std::vector<int>(n);
+    auto counter            = std::atomic<int>{0};
+
+    miopen::par_for_strided(n, miopen::max_threads{4}, [&](auto i) {
+        owners[i] = std::this_thread::get_id();
+        order[i]  = counter++;
+    });
+
+    EXPECT_EQ(counter.load(), static_cast<int>(n));
+    const auto stride = std::min<std::size_t>(std::thread::hardware_concurrency(), 4);
+    for(std::size_t i = stride; i < n; ++i)
+    {
+        EXPECT_EQ(owners[i], owners[i - stride]);
+        EXPECT_LT(order[i - stride], order[i]);
+    }
+}
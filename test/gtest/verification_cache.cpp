@@ -0,0 +1,151 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "../verification_cache.hpp"
+
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+miopen::VerificationCacheKey MakeKey(const std::string& problem)
+{
+    return {"conv_fwd", problem, 12345678, "FP32_FP64"};
+}
+
+std::vector<double> MakeData(std::size_t n)
+{
+    auto data = std::vector<double>(n);
+    for(std::size_t i = 0; i < n; ++i)
+        data[i] = static_cast<double>(i % 17) * 0.25;
+    return data;
+}
+
+} // namespace
+
+TEST(CPU_VerificationCache_NONE, RoundTrip)
+{
+    const miopen::TmpDir dir{"verification_cache"};
+    const auto data = MakeData(10000);
+
+    for(const auto compress : {false, true})
+    {
+        const auto cache = miopen::VerificationCache{dir.path, 1024 * 1024, compress};
+        const auto key   = MakeKey(compress ? "compressed" : "raw");
+        auto loaded      = std::vector<double>(data.size());
+
+        EXPECT_FALSE(cache.Load(key, loaded));
+        cache.Store(key, data);
+        ASSERT_TRUE(cache.Load(key, loaded));
+        EXPECT_EQ(loaded, data);
+
+        // Repetitive data shrinks when compressed.
+        const auto file_size = miopen::fs::file_size(cache.GetPath(key));
+        if(compress)
+            EXPECT_LT(file_size, data.size() * sizeof(double));
+        else
+            EXPECT_GT(file_size, data.size() * sizeof(double));
+    }
+}
+
+TEST(CPU_VerificationCache_NONE, Mismatch)
+{
+    const miopen::TmpDir dir{"verification_cache"};
+    const auto cache = miopen::VerificationCache{dir.path};
+    const auto data  = MakeData(100);
+    cache.Store(MakeKey("problem"), data);
+
+    auto other_seed = MakeKey("problem");
+    other_seed.seed = 1;
+    auto loaded     = std::vector<double>(data.size());
+    EXPECT_FALSE(cache.Load(other_seed, loaded));
+    EXPECT_FALSE(cache.Load(MakeKey("problem").AddInput(data), loaded));
+
+    // Sizes and element types must match.
+    auto shorter = std::vector<double>(data.size() - 1);
+    EXPECT_FALSE(cache.Load(MakeKey("problem"), shorter));
+    auto floats = std::vector<float>(data.size() * 2);
+    EXPECT_FALSE(cache.Load(MakeKey("problem"), floats));
+
+    // A disabled cache neither stores nor loads.
+    const auto disabled = miopen::VerificationCache{};
+    disabled.Store(MakeKey("disabled"), data);
+    EXPECT_FALSE(disabled.Load(MakeKey("disabled"), loaded));
+    EXPECT_FALSE(miopen::fs::exists(cache.GetPath(MakeKey("disabled"))));
+}
+
+TEST(CPU_VerificationCache_NONE, Corrupted)
+{
+    const miopen::TmpDir dir{"verification_cache"};
+    const auto cache = miopen::VerificationCache{dir.path};
+    const auto key   = MakeKey("problem");
+    const auto data  = MakeData(1000);
+    cache.Store(key, data);
+
+    const auto size = miopen::fs::file_size(cache.GetPath(key));
+    miopen::fs::resize_file(cache.GetPath(key), size / 2);
+    auto loaded = std::vector<double>(data.size());
+    EXPECT_FALSE(cache.Load(key, loaded));
+
+    {
+        auto file = std::ofstream{cache.GetPath(key), std::ios::binary | std::ios::trunc};
+        file << "not a verification cache entry";
+    }
+    EXPECT_FALSE(cache.Load(key, loaded));
+
+    EXPECT_FALSE(cache.LoadOrCompute(key, loaded, [&] { loaded = data; }));
+    EXPECT_TRUE(cache.LoadOrCompute(key, loaded, [] { FAIL() << "Must be loaded"; }));
+    EXPECT_EQ(loaded, data);
+}
+
+TEST(CPU_VerificationCache_NONE, EvictsLeastRecentlyUsed)
+{
+    const miopen::TmpDir dir{"verification_cache"};
+    const auto data = MakeData(1000);
+
+    // Room for two uncompressed results.
+    const auto entry_size = data.size() * sizeof(double) + 64;
+    const auto cache      = miopen::VerificationCache{dir.path, 2 * entry_size, false};
+
+    cache.Store(MakeKey("a"), data);
+    cache.Store(MakeKey("b"), data);
+
+    // Make "a" the most recently used one.
+    const auto past = miopen::fs::file_time_type::clock::now() - std::chrono::hours(1);
+    miopen::fs::last_write_time(cache.GetPath(MakeKey("a")), past);
+    miopen::fs::last_write_time(cache.GetPath(MakeKey("b")), past - std::chrono::hours(1));
+    auto loaded = std::vector<double>(data.size());
+    ASSERT_TRUE(cache.Load(MakeKey("a"), loaded));
+
+    cache.Store(MakeKey("c"), data);
+    EXPECT_TRUE(miopen::fs::exists(cache.GetPath(MakeKey("a"))));
+    EXPECT_FALSE(miopen::fs::exists(cache.GetPath(MakeKey("b"))));
+    EXPECT_TRUE(miopen::fs::exists(cache.GetPath(MakeKey("c"))));
+}
@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "../tensor_holder.hpp"
+#include "../verify.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <vector>
+
+namespace {
+
+// The formulas the metrics were computed with before they were fused into one pass
+template <class R1, class R2>
+double reference_rms(const R1& r1, const R2& r2)
+{
+    double sum  = 0.0;
+    double mag1 = 0.0;
+    double mag2 = 0.0;
+    for(std::size_t i = 0; i < r1.size(); ++i)
+    {
+        const auto a = static_cast<double>(r1[i]);
+        const auto b = static_cast<double>(r2[i]);
+        sum += (a - b) * (a - b);
+        mag1 = std::max(mag1, std::fabs(a));
+        mag2 = std::max(mag2, std::fabs(b));
+    }
+    const auto mag = std::max({mag1, mag2, std::numeric_limits<double>::min()});
+    return std::sqrt(sum) / (std::sqrt(r1.size()) * mag);
+}
+
+std::vector<float> MakeData(std::size_t n, float scale)
+{
+    auto data = std::vector<float>(n);
+    for(std::size_t i = 0; i < n; ++i)
+        data[i] = scale * static_cast<float>(static_cast<int>(i * 7919 % 2003) - 1001) / 1001.0f;
+    return data;
+}
+
+} // namespace
+
+TEST(CPU_Verify_NONE, MatchesReference)
+{
+    // Sizes below, at and above a block, which spans several threads
+    for(std::size_t n : {1, 7, 1000, 64 * 1024, 200003})
+    {
+        const auto a = MakeData(n, 3.0f);
+        auto b       = a;
+        for(std::size_t i = 0; i < n; i += 13)
+            b[i] += 0.001f * static_cast<float>(i % 5);
+
+        const auto stats = miopen::compare_ranges(a, b);
+        EXPECT_NEAR(stats.rms, reference_rms(a, b), 1e-12) << n;
+        EXPECT_DOUBLE_EQ(miopen::rms_range(a, b), stats.rms);
+
+        std::size_t max_idx = 0;
+        double max_abs      = 0.0;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const auto d = std::fabs(static_cast<double>(a[i]) - b[i]);
+            if(d > max_abs)
+            {
+                max_abs = d;
+                max_idx = i;
+            }
+        }
+        EXPECT_EQ(stats.max_abs, max_abs);
+        EXPECT_EQ(miopen::max_diff(a, b), max_abs);
+        EXPECT_EQ(stats.max_abs_idx, max_idx);
+    }
+}
+
+TEST(CPU_Verify_NONE, FirstMismatch)
+{
+    const auto a = MakeData(300000, 1.0f);
+    auto b       = a;
+    EXPECT_EQ(miopen::compare_ranges(a, b).first_mismatch, miopen::error_stats::npos);
+    EXPECT_EQ(miopen::compare_ranges(a, b).mismatches, 0);
+
+    b[250000] += 0.5f;
+    b[70000] += 0.25f;
+    b[5] += 1e-6f;
+
+    const auto stats = miopen::compare_ranges(a, b, 1e-3);
+    EXPECT_EQ(stats.mismatches, 2);
+    EXPECT_EQ(stats.first_mismatch, 70000);
+    EXPECT_EQ(stats.max_abs_idx, 250000);
+    EXPECT_EQ(miopen::compare_ranges(a, b).first_mismatch, 5);
+}
+
+TEST(CPU_Verify_NONE, NotFinite)
+{
+    auto a = std::vector<float>(1000, 1.0f);
+    auto b = a;
+    b[10]  = std::numeric_limits<float>::quiet_NaN();
+    b[20]  = std::numeric_limits<float>::infinity();
+
+    const auto stats = miopen::compare_ranges(a, b, 0.1);
+    EXPECT_TRUE(std::isnan(stats.max_abs));
+    EXPECT_TRUE(std::isnan(stats.rms));
+    EXPECT_EQ(stats.not_finite, 1);
+    EXPECT_EQ(stats.mismatches, 2);
+    EXPECT_EQ(stats.first_mismatch, 10);
+}
+
+TEST(CPU_Verify_NONE, SizeMismatch)
+{
+    const auto a = std::vector<float>(10, 1.0f);
+    const auto b = std::vector<float>(11, 1.0f);
+    EXPECT_GT(miopen::rms_range(a, b), 1.0);
+    EXPECT_EQ(miopen::compare_ranges(a, b).first_mismatch, 0);
+}
+
+TEST(CPU_Verify_NONE, ForwardIterators)
+{
+    const auto v = MakeData(1000, 2.0f);
+    const auto a = std::list<float>(v.begin(), v.end());
+    auto b       = v;
+    b[500] += 1.0f;
+
+    const auto stats = miopen::compare_ranges(a, b, 0.5);
+    EXPECT_NEAR(stats.rms, reference_rms(v, b), 1e-12);
+    EXPECT_EQ(stats.first_mismatch, 500);
+}
+
+TEST(CPU_Verify_NONE, HalfConversion)
+{
+    for(std::uint32_t bits = 0; bits <= 0xffff; ++bits)
+    {
+        const auto h = static_cast<std::uint16_t>(bits);
+        half_float::half x;
+        std::memcpy(static_cast<void*>(&x), &h, sizeof(h));
+        const auto expected = static_cast<float>(x);
+        const auto actual   = miopen::verify_detail::to_double<half_float::half>{}(x);
+        if(std::isnan(expected))
+            EXPECT_TRUE(std::isnan(actual)) << bits;
+        else
+            EXPECT_EQ(actual, expected) << bits;
+    }
+}
+
+TEST(CPU_Verify_NONE, Bfloat16Conversion)
+{
+    for(float f : {0.0f, -0.0f, 1.0f, -2.5f, 3.140625f, 1e-38f, 65504.0f, -1e30f})
+    {
+        const auto x = bfloat16(f);
+        EXPECT_EQ(miopen::verify_detail::to_double<bfloat16>{}(x), static_cast<float>(x)) << f;
+    }
+}
+
+TEST(CPU_Verify_NONE, Fp8Conversion)
+{
+    using f8  = miopen_f8::hip_f8<miopen_f8::hip_f8_type::fp8>;
+    using bf8 = miopen_f8::hip_f8<miopen_f8::hip_f8_type::bf8>;
+    for(std::uint32_t bits = 0; bits < 256; ++bits)
+    {
+        const auto x = f8{static_cast<std::uint8_t>(bits)};
+        const auto y = bf8{static_cast<std::uint8_t>(bits)};
+        const auto fx = static_cast<float>(x);
+        const auto fy = static_cast<float>(y);
+        const auto dx = miopen::verify_detail::to_double<f8>{}(x);
+        const auto dy = miopen::verify_detail::to_double<bf8>{}(y);
+        EXPECT_TRUE(dx == fx || (std::isnan(dx) && std::isnan(fx))) << bits;
+        EXPECT_TRUE(dy == fy || (std::isnan(dy) && std::isnan(fy))) << bits;
+    }
+}
@@ -348,6 +348,19 @@ struct tensor
             std::bind(for_each_handler{}, this, par_ford, std::move(f), std::placeholders::_1));
     }
 
+    /// Like par_for_each, but visits the last two dimensions in tiles. Faster for functions
+    /// reading rows and columns of other tensors, like matrix products.
+    template <class F>
+    void par_for_each_tiled(F f) const
+    {
+        visit_tensor_size(desc.GetLengths().size(),
+                          std::bind(for_each_handler{},
+                                    this,
+                                    par_ford_tiled,
+                                    std::move(f),
+                                    std::placeholders::_1));
+    }
+
     template <class... Ts>
     T& operator()(Ts... xs)
     {
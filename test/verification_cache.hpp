@@ -0,0 +1,326 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_VERIFICATION_CACHE_HPP
+#define GUARD_VERIFICATION_CACHE_HPP
+
+#include <miopen/bz2.hpp>
+#include <miopen/env.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/md5.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_VERIFICATION_CACHE_DIR)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_VERIFICATION_CACHE_SIZE_MB, 4096)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_VERIFICATION_CACHE_COMPRESS, true)
+
+namespace miopen {
+
+/// Identifies a reference result. The operator and problem strings are chosen by the caller,
+/// the seed is the one the inputs were generated from and the type names the data types of
+/// the inputs and of the result.
+struct VerificationCacheKey
+{
+    std::string op;
+    std::string problem;
+    std::uint64_t seed = 0;
+    std::string type;
+
+    std::string Hash() const
+    {
+        return md5(op + '\n' + problem + '\n' + std::to_string(seed) + '\n' + type);
+    }
+
+    /// Adds the contents of an input to the problem. Use it when the inputs can not be told
+    /// apart by the seed alone, e.g. when several tests draw from the same generator.
+    template <class T>
+    VerificationCacheKey& AddInput(const std::vector<T>& data)
+    {
+        static_assert(std::is_trivially_copyable<T>{}, "T must be trivially copyable");
+        problem += '_' + md5(data.data(), data.size() * sizeof(T));
+        return *this;
+    }
+};
+
+/// On-disk cache of host reference results shared by MIOpenDriver and the tests.
+///
+/// Each result is stored in its own file named after the hash of its key. The file starts with
+/// a fixed 64 byte header followed by the data, which is either bz2 compressed or stored as is,
+/// in which case it can be read (or mapped) directly into the destination buffer. Files are
+/// written to a temporary name and renamed, so several processes may share a directory.
+/// Hits refresh the modification time of the file and the least recently used files are
+/// removed once the directory grows over the size limit. The directory is scanned on the first
+/// store of the process and then each time another sixteenth of the limit has been written.
+class VerificationCache
+{
+public:
+    static constexpr const char* extension = ".vref";
+
+    VerificationCache() = default;
+    explicit VerificationCache(fs::path dir_,
+                               std::uint64_t max_size_ = DefaultMaxSize(),
+                               bool use_compression_   = DefaultCompression())
+        : dir(std::move(dir_)), max_size(max_size_), use_compression(use_compression_)
+    {
+    }
+
+    static std::uint64_t DefaultMaxSize()
+    {
+        return env::value(MIOPEN_VERIFICATION_CACHE_SIZE_MB) * 1024 * 1024;
+    }
+
+    static bool DefaultCompression() { return !env::disabled(MIOPEN_VERIFICATION_CACHE_COMPRESS); }
+
+    /// The cache in MIOPEN_VERIFICATION_CACHE_DIR, disabled when the variable is not set.
+    static VerificationCache FromEnv()
+    {
+        const auto path = env::value(MIOPEN_VERIFICATION_CACHE_DIR);
+        return path.empty() ? VerificationCache{} : VerificationCache{path};
+    }
+
+    bool Enabled() const { return !dir.empty(); }
+    const fs::path& GetDirectory() const { return dir; }
+
+    template <class T>
+    bool Load(const VerificationCacheKey& key, T* data, std::size_t count) const
+    {
+        static_assert(std::is_trivially_copyable<T>{}, "T must be trivially copyable");
+        return Enabled() &&
+               LoadBytes(key, reinterpret_cast<char*>(data), sizeof(T), count * sizeof(T));
+    }
+
+    template <class T>
+    bool Load(const VerificationCacheKey& key, std::vector<T>& data) const
+    {
+        return Load(key, data.data(), data.size());
+    }
+
+    template <class T>
+    void Store(const VerificationCacheKey& key, const T* data, std::size_t count) const
+    {
+        static_assert(std::is_trivially_copyable<T>{}, "T must be trivially copyable");
+        if(Enabled())
+            StoreBytes(key, reinterpret_cast<const char*>(data), sizeof(T), count * sizeof(T));
+    }
+
+    template <class T>
+    void Store(const VerificationCacheKey& key, const std::vector<T>& data) const
+    {
+        Store(key, data.data(), data.size());
+    }
+
+    /// Fills data from the cache or calls compute() to fill it and stores the result.
+    /// Returns true on a cache hit.
+    template <class T, class F>
+    bool LoadOrCompute(const VerificationCacheKey& key, std::vector<T>& data, F compute) const
+    {
+        if(Load(key, data))
+            return true;
+        compute();
+        Store(key, data);
+        return false;
+    }
+
+    fs::path GetPath(const VerificationCacheKey& key) const
+    {
+        return dir / (key.Hash() + extension);
+    }
+
+    /// Removes the least recently used results until the cache fits into its size limit.
+    void Prune() const
+    {
+        if(!Enabled())
+            return;
+
+        std::error_code ec;
+        auto entries = std::vector<std::tuple<fs::file_time_type, std::uint64_t, fs::path>>{};
+        auto total   = std::uint64_t{0};
+        for(const auto& entry : fs::directory_iterator(dir, ec))
+        {
+            if(entry.path().extension() != extension)
+                continue;
+            const auto size  = fs::file_size(entry.path(), ec);
+            const auto mtime = fs::last_write_time(entry.path(), ec);
+            if(ec)
+                continue;
+            entries.emplace_back(mtime, size, entry.path());
+            total += size;
+        }
+
+        if(total <= max_size)
+            return;
+
+        std::sort(entries.begin(), entries.end());
+        for(const auto& entry : entries)
+        {
+            if(total <= max_size)
+                break;
+            if(fs::remove(std::get<2>(entry), ec))
+                total -= std::get<1>(entry);
+        }
+    }
+
+private:
+    struct Header
+    {
+        char magic[8];
+        std::uint32_t compressed;
+        std::uint32_t element_size;
+        std::uint64_t size;
+        std::uint64_t stored_size;
+        char reserved[32];
+    };
+    static_assert(sizeof(Header) == 64, "Header must be 64 bytes");
+
+    static constexpr char magic[8] = {'M', 'I', 'O', 'V', 'R', 'E', 'F', '1'};
+
+    bool LoadBytes(const VerificationCacheKey& key,
+                   char* data,
+                   std::size_t element_size,
+                   std::size_t size) const
+    {
+        const auto path = GetPath(key);
+        auto file       = std::ifstream{path, std::ios::binary};
+        if(!file)
+            return false;
+
+        auto header = Header{};
+        if(!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+           std::memcmp(header.magic, magic, sizeof(magic)) != 0 ||
+           header.element_size != element_size || header.size != size)
+            return false;
+
+        if(header.compressed == 0)
+        {
+            if(header.stored_size != size || !file.read(data, size))
+                return false;
+        }
+        else
+        {
+            auto stored = std::vector<char>(header.stored_size);
+            if(!file.read(stored.data(), stored.size()))
+                return false;
+            try
+            {
+                const auto unpacked = decompress(stored, static_cast<unsigned int>(size));
+                if(unpacked.size() != size)
+                    return false;
+                std::copy(unpacked.begin(), unpacked.end(), data);
+            }
+            catch(const std::runtime_error&)
+            {
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+        return true;
+    }
+
+    void StoreBytes(const VerificationCacheKey& key,
+                    const char* data,
+                    std::size_t element_size,
+                    std::size_t size) const
+    {
+        std::error_code ec;
+        fs::create_directories(dir, ec);
+
+        auto header = Header{};
+        std::copy(std::begin(magic), std::end(magic), header.magic);
+        header.element_size = static_cast<std::uint32_t>(element_size);
+        header.size         = size;
+
+        // bz2 sizes are 32 bit. Results that do not shrink are stored as is.
+        auto packed = std::vector<char>{};
+        if(use_compression && size > 0 && size <= std::numeric_limits<unsigned int>::max())
+        {
+            auto compressed = false;
+            packed = miopen::compress(std::vector<char>(data, data + size), &compressed);
+            if(!compressed)
+                packed.clear();
+        }
+        header.compressed  = packed.empty() ? 0 : 1;
+        header.stored_size = packed.empty() ? size : packed.size();
+
+        const auto path = GetPath(key);
+        auto tmp        = path;
+        tmp += "." + std::to_string(std::random_device{}()) + ".tmp";
+        {
+            auto file = std::ofstream{tmp, std::ios::binary | std::ios::trunc};
+            file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            if(packed.empty())
+                file.write(data, size);
+            else
+                file.write(packed.data(), packed.size());
+            if(!file)
+            {
+                file.close();
+                fs::remove(tmp, ec);
+                return;
+            }
+        }
+
+        fs::rename(tmp, path, ec);
+        if(ec)
+        {
+            fs::remove(tmp, ec);
+            return;
+        }
+
+        PruneAfterStore(header.stored_size);
+    }
+
+    void PruneAfterStore(std::uint64_t written) const
+    {
+        static auto first_store = std::atomic<bool>{true};
+        static auto unpruned    = std::atomic<std::uint64_t>{0};
+        if(!first_store.exchange(false) && (unpruned += written) < max_size / 16)
+            return;
+        unpruned = 0;
+        Prune();
+    }
+
+    fs::path dir;
+    std::uint64_t max_size = 0;
+    bool use_compression   = true;
+};
+
+} // namespace miopen
+
+#endif // GUARD_VERIFICATION_CACHE_HPP
@@ -27,10 +27,16 @@
 #define GUARD_VERIFY_HPP
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <miopen/float_equal.hpp>
+#include <miopen/par_for.hpp>
 #include <miopen/returns.hpp>
 #include <numeric>
 #include <miopen/bfloat16.hpp>
@@ -182,12 +188,6 @@ int64_t find_idx(R1&& r1, Predicate p)
         return std::distance(r1.begin(), it);
 }
 
-template <class R1, class R2>
-double max_diff(R1&& r1, R2&& r2)
-{
-    return range_product(r1, r2, 0.0, max, abs_diff);
-}
-
 template <class R1, class R2>
 auto max_diff_v2(R1&& r1, R2&& r2)
 {
@@ -210,23 +210,305 @@ std::size_t mismatch_diff(R1&& r1, R2&& r2, T diff)
             float_equal, diff, std::bind(abs_diff, std::placeholders::_1, std::placeholders::_2)));
 }
 
+namespace verify_detail {
+
+// Conversions to double which the compiler can vectorize, unlike the generic ones of the
+// half, bfloat16 and fp8 types.
+inline float half_bits_to_float(std::uint16_t h)
+{
+    // Scaling by 2^112 moves the exponent from the half to the float bias and handles
+    // subnormals. Only infinities and NaNs need their exponent fixed afterwards.
+    constexpr std::uint32_t magic      = (254 - 15) << 23;
+    constexpr std::uint32_t was_infnan = (127 + 16) << 23;
+    std::uint32_t bits                 = (h & 0x7fffu) << 13;
+    float f, scale, limit;
+    std::memcpy(&f, &bits, sizeof(f));
+    std::memcpy(&scale, &magic, sizeof(scale));
+    std::memcpy(&limit, &was_infnan, sizeof(limit));
+    f *= scale;
+    std::memcpy(&bits, &f, sizeof(bits));
+    if(f >= limit)
+        bits |= 255u << 23;
+    bits |= static_cast<std::uint32_t>(h & 0x8000u) << 16;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+template <class T>
+struct to_double
+{
+    double operator()(T x) const { return static_cast<double>(x); }
+};
+
+template <>
+struct to_double<half_float::half>
+{
+    double operator()(half_float::half x) const
+    {
+        static_assert(sizeof(x) == sizeof(std::uint16_t));
+        std::uint16_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        return half_bits_to_float(bits);
+    }
+};
+
+template <>
+struct to_double<bfloat16>
+{
+    double operator()(bfloat16 x) const
+    {
+        static_assert(sizeof(x) == sizeof(std::uint16_t));
+        std::uint16_t bits;
+        std::memcpy(&bits, &x, sizeof(bits));
+        const auto wide = static_cast<std::uint32_t>(bits) << 16;
+        float f;
+        std::memcpy(&f, &wide, sizeof(f));
+        return f;
+    }
+};
+
+// fp8 values are looked up in a table of all 256 encodings.
+template <miopen_f8::hip_f8_type FT>
+struct to_double<miopen_f8::hip_f8<FT>>
+{
+    double operator()(miopen_f8::hip_f8<FT> x) const
+    {
+        static const auto table = []() {
+            std::array<float, 256> values{};
+            for(std::size_t i = 0; i < values.size(); ++i)
+                values[i] = static_cast<float>(miopen_f8::hip_f8<FT>{static_cast<std::uint8_t>(i)});
+            return values;
+        }();
+        return table[x.data];
+    }
+};
+
+/// Partial results for a block of elements.
+struct error_accumulator
+{
+    double sum_square          = 0.0;
+    double max_abs             = 0.0;
+    double max_rel             = 0.0;
+    double max_mag1            = 0.0;
+    double max_mag2            = 0.0;
+    std::size_t max_abs_idx    = 0;
+    std::size_t mismatches     = 0;
+    std::size_t not_finite     = 0;
+    std::size_t first_mismatch = std::numeric_limits<std::size_t>::max();
+
+    void merge(const error_accumulator& other)
+    {
+        sum_square += other.sum_square;
+        if(other.max_abs > max_abs)
+        {
+            max_abs     = other.max_abs;
+            max_abs_idx = other.max_abs_idx;
+        }
+        max_rel  = std::max(max_rel, other.max_rel);
+        max_mag1 = std::max(max_mag1, other.max_mag1);
+        max_mag2 = std::max(max_mag2, other.max_mag2);
+        mismatches += other.mismatches;
+        not_finite += other.not_finite;
+        first_mismatch = std::min(first_mismatch, other.first_mismatch);
+    }
+};
+
+/// Elements are converted to double in chunks, then reduced by branch free loops with separate
+/// accumulators per lane, so that both loops vectorize. Indices are only looked for in the rare
+/// chunks where they change.
+template <class It1, class It2>
+error_accumulator
+accumulate_errors(It1 it1, It2 it2, std::size_t first, std::size_t count, double tol)
+{
+    constexpr std::size_t chunk = 256;
+    constexpr std::size_t lanes = 8;
+    using T1                    = typename std::iterator_traits<It1>::value_type;
+    using T2                    = typename std::iterator_traits<It2>::value_type;
+
+    error_accumulator acc;
+    std::array<double, chunk> x{}, y{};
+    for(std::size_t start = 0; start < count; start += chunk)
+    {
+        const auto n = std::min(chunk, count - start);
+        for(std::size_t i = 0; i < n; ++i, ++it1, ++it2)
+        {
+            x[i] = to_double<T1>{}(*it1);
+            y[i] = to_double<T2>{}(*it2);
+        }
+        // Padding, which doesn't change any of the results
+        std::fill(x.begin() + n, x.end(), 0.0);
+        std::fill(y.begin() + n, y.end(), 0.0);
+
+        std::array<double, lanes> sum{}, diff{}, rel{}, mag1{}, mag2{};
+        std::array<std::size_t, lanes> bad{}, nan{};
+        for(std::size_t i = 0; i < chunk; i += lanes)
+        {
+            for(std::size_t l = 0; l < lanes; ++l)
+            {
+                const auto a = x[i + l];
+                const auto b = y[i + l];
+                const auto d = std::fabs(a - b);
+                const auto m = std::max(std::fabs(a), std::fabs(b));
+                const auto r = d / std::max(m, std::numeric_limits<double>::min());
+                sum[l]       = sum[l] + (a - b) * (a - b);
+                diff[l]      = d > diff[l] ? d : diff[l];
+                rel[l]       = r > rel[l] ? r : rel[l];
+                mag1[l]      = std::fabs(a) > mag1[l] ? std::fabs(a) : mag1[l];
+                mag2[l]      = std::fabs(b) > mag2[l] ? std::fabs(b) : mag2[l];
+                bad[l]       = bad[l] + (d <= tol ? 0 : 1);
+                nan[l]       = nan[l] + (d == d ? 0 : 1);
+            }
+        }
+
+        const auto chunk_max = *std::max_element(diff.begin(), diff.end());
+        const auto chunk_bad = std::accumulate(bad.begin(), bad.end(), std::size_t{0});
+        acc.sum_square += std::accumulate(sum.begin(), sum.end(), 0.0);
+        acc.max_rel  = std::max(acc.max_rel, *std::max_element(rel.begin(), rel.end()));
+        acc.max_mag1 = std::max(acc.max_mag1, *std::max_element(mag1.begin(), mag1.end()));
+        acc.max_mag2 = std::max(acc.max_mag2, *std::max_element(mag2.begin(), mag2.end()));
+        acc.mismatches += chunk_bad;
+        acc.not_finite += std::accumulate(nan.begin(), nan.end(), std::size_t{0});
+
+        if(chunk_max > acc.max_abs)
+        {
+            acc.max_abs = chunk_max;
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                if(std::fabs(x[i] - y[i]) == chunk_max)
+                {
+                    acc.max_abs_idx = first + start + i;
+                    break;
+                }
+            }
+        }
+        if(chunk_bad != 0 && acc.first_mismatch == std::numeric_limits<std::size_t>::max())
+        {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+                if(!(std::fabs(x[i] - y[i]) <= tol))
+                {
+                    acc.first_mismatch = first + start + i;
+                    break;
+                }
+            }
+        }
+    }
+    return acc;
+}
+
+} // namespace verify_detail
+
+/// Comparison of a result with its reference.
+struct error_stats
+{
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    /// Root mean square of the differences relative to the largest magnitude, as rms_range.
+    double rms = 0.0;
+    /// Largest absolute difference, NaN if any difference is not a number.
+    double max_abs = 0.0;
+    /// Largest difference relative to the larger magnitude of its two elements.
+    double max_rel = 0.0;
+    /// Largest magnitude in either range, which rms is relative to.
+    double magnitude = 0.0;
+    std::size_t max_abs_idx = 0;
+    /// Number of elements which differ by more than the tolerance or are NaN.
+    std::size_t mismatches     = 0;
+    std::size_t first_mismatch = npos;
+    std::size_t not_finite     = 0;
+
+    friend std::ostream& operator<<(std::ostream& os, const error_stats& stats)
+    {
+        os << "rms " << stats.rms << ", max abs diff " << stats.max_abs << " at "
+           << stats.max_abs_idx << ", max rel diff " << stats.max_rel << ", "
+           << stats.mismatches << " mismatches";
+        if(stats.first_mismatch != npos)
+            os << " (first at " << stats.first_mismatch << ")";
+        if(stats.not_finite != 0)
+            os << ", " << stats.not_finite << " NaN differences";
+        return os;
+    }
+};
+
+/// Computes all the error metrics in one pass over the ranges, using all the cores for large
+/// ranges. Elements whose absolute difference exceeds tolerance count as mismatches. Results
+/// don't depend on the number of threads.
 template <class R1, class R2>
-double rms_range(R1&& r1, R2&& r2)
+error_stats compare_ranges(R1&& r1, R2&& r2, double tolerance = 0.0)
 {
-    std::size_t n = range_distance(r1);
-    if(n == range_distance(r2))
+    constexpr std::size_t block = 64 * 1024;
+
+    error_stats stats;
+    const auto n = static_cast<std::size_t>(range_distance(r1));
+    if(n != static_cast<std::size_t>(range_distance(r2)))
     {
-        if(n == 0)
-            return 0;
-        double square_difference = range_product(r1, r2, 0.0, sum_fn{}, square_diff);
-        double mag1 = static_cast<double>(*std::max_element(r1.begin(), r1.end(), compare_mag));
-        double mag2 = static_cast<double>(*std::max_element(r2.begin(), r2.end(), compare_mag));
-        double mag =
-            std::max({std::fabs(mag1), std::fabs(mag2), std::numeric_limits<double>::min()});
-        return std::sqrt(square_difference) / (std::sqrt(n) * mag);
+        stats.rms = stats.max_abs = stats.max_rel = std::numeric_limits<double>::max();
+        stats.mismatches = std::max<std::size_t>(n, range_distance(r2));
+        stats.first_mismatch = 0;
+        return stats;
+    }
+    if(n == 0)
+        return stats;
+
+    using It1 = decltype(r1.begin());
+    using It2 = decltype(r2.begin());
+    using Cat = typename std::iterator_traits<It1>::iterator_category;
+    constexpr bool random_access =
+        std::is_base_of_v<std::random_access_iterator_tag, Cat> &&
+        std::is_base_of_v<std::random_access_iterator_tag,
+                          typename std::iterator_traits<It2>::iterator_category>;
+
+    verify_detail::error_accumulator total;
+    if constexpr(random_access)
+    {
+        const auto blocks = (n + block - 1) / block;
+        std::vector<verify_detail::error_accumulator> partial(blocks);
+        par_for_ranges(blocks, [&](std::size_t begin, std::size_t end) {
+            for(auto i = begin; i < end; ++i)
+            {
+                const auto first = i * block;
+                const auto count = std::min(block, n - first);
+                partial[i]       = verify_detail::accumulate_errors(
+                    r1.begin() + first, r2.begin() + first, first, count, tolerance);
+            }
+        });
+        // In order, so that the sum doesn't depend on the scheduling
+        for(const auto& p : partial)
+            total.merge(p);
     }
     else
+    {
+        total = verify_detail::accumulate_errors(r1.begin(), r2.begin(), 0, n, tolerance);
+    }
+
+    const auto mag =
+        std::max({total.max_mag1, total.max_mag2, std::numeric_limits<double>::min()});
+    stats.rms            = std::sqrt(total.sum_square) / (std::sqrt(n) * mag);
+    stats.max_abs        = total.not_finite != 0 ? std::numeric_limits<double>::quiet_NaN()
+                                                 : total.max_abs;
+    stats.max_rel        = total.max_rel;
+    stats.magnitude      = mag;
+    stats.max_abs_idx    = total.max_abs_idx;
+    stats.mismatches     = total.mismatches;
+    stats.first_mismatch = total.first_mismatch;
+    stats.not_finite     = total.not_finite;
+    return stats;
+}
+
+/// Largest absolute difference between the ranges. Returns NaN if any difference is NaN, so
+/// compare it as `!(max_diff(a, b) <= tolerance)` rather than `> tolerance`.
+template <class R1, class R2>
+double max_diff(R1&& r1, R2&& r2)
+{
+    return compare_ranges(r1, r2).max_abs;
+}
+
+template <class R1, class R2>
+double rms_range(R1&& r1, R2&& r2)
+{
+    if(range_distance(r1) != range_distance(r2))
         return double(std::numeric_limits<range_value<R1>>::max());
+    return compare_ranges(r1, r2).rms;
 }
 } // namespace miopen
 #endif
@@ -0,0 +1,33 @@
+#include <miopen/mapped_db.hpp>
+
+#include <iostream>
+#include <string>
+
+int main(int argn, char** args)
+{
+    if(argn < 3 || argn > 4)
+    {
+        std::cerr << "Usage:" << std::endl;
+        std::cerr << args[0] << " find|perf input_path [output_path]" << std::endl;
+        std::cerr << "find|perf - kind of the input db." << std::endl;
+        std::cerr << "input_path - path to the input file, expected to be a text db." << std::endl;
+        std::cerr << "output_path - optional path to the output file. Existing file would be "
+                     "replaced. Defaults to the input_path with .idx appended to the end"
+                  << std::endl;
+        return 1;
+    }
+
+    const std::string kind = args[1];
+    if(kind != "find" && kind != "perf")
+    {
+        std::cerr << "Unknown db kind: " << kind << std::endl;
+        return 1;
+    }
+
+    const auto db_kind     = kind == "find" ? miopen::DbKinds::FindDb : miopen::DbKinds::PerfDb;
+    const auto in_filename = miopen::fs::path{args[2]};
+    const auto out_filename =
+        argn > 3 ? miopen::fs::path{args[3]} : miopen::MappedDb::GetPath(in_filename);
+
+    return miopen::MappedDb::Build(db_kind, in_filename, out_filename) ? 0 : 1;
+}
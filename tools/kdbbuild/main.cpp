@@ -0,0 +1,94 @@
+#include <miopen/handle.hpp>
+#include <miopen/kern_db_builder.hpp>
+#include <miopen/precompile.hpp>
+#include <miopen/problem.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void Usage(const char* name)
+{
+    std::cerr << "Usage:" << std::endl;
+    std::cerr << name << " manifest_path [output_path] [--jobs N] [--batch N] [--force]"
+              << std::endl;
+    std::cerr << "manifest_path - JSON array of problems, the same format as the precompile "
+                 "manifest."
+              << std::endl;
+    std::cerr << "output_path - kernel database to update. Defaults to the system kernel "
+                 "database name of the target, which is shared by all CU counts, in the current "
+                 "directory."
+              << std::endl;
+    std::cerr << "--jobs - number of parallel compilations. Defaults to the number of hardware "
+                 "threads."
+              << std::endl;
+    std::cerr << "--batch - number of kernels written per transaction. Defaults to 256."
+              << std::endl;
+    std::cerr << "--force - rebuild the kernels which are present already." << std::endl;
+    std::cerr << "The target is the one of the handle. With the HIPNOGPU backend it is set by "
+                 "MIOPEN_DEVICE_ARCH."
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argn, char** args)
+{
+    auto positional = std::vector<std::string>{};
+    auto jobs       = std::size_t{std::max(std::thread::hardware_concurrency(), 1U)};
+    auto batch      = std::size_t{256};
+    auto force      = false;
+
+    for(int i = 1; i < argn; ++i)
+    {
+        const std::string arg = args[i];
+        if((arg == "--jobs" || arg == "--batch") && i + 1 < argn)
+            (arg == "--jobs" ? jobs : batch) = std::strtoull(args[++i], nullptr, 10);
+        else if(arg == "--force")
+            force = true;
+        else if(arg.rfind("--", 0) != 0)
+            positional.push_back(arg);
+        else
+        {
+            Usage(args[0]);
+            return 1;
+        }
+    }
+
+    if(positional.empty() || positional.size() > 2 || jobs == 0 || batch == 0)
+    {
+        Usage(args[0]);
+        return 1;
+    }
+
+    try
+    {
+        auto handle       = miopen::Handle{};
+        const auto output = positional.size() > 1
+                                ? miopen::fs::path{positional[1]}
+                                : miopen::fs::path{handle.GetTargetProperties().DbId() + ".kdb"};
+
+        auto builder = miopen::KernDbBuilder{handle, output};
+        builder.AddProblems(miopen::LoadPrecompileManifest(positional[0]));
+        std::cout << "Kernels: " << builder.GetKernels().size() << std::endl;
+
+        const auto stats = builder.Build(jobs, batch, force);
+        std::cout << "Built: " << stats.built << ", skipped: " << stats.skipped
+                  << ", failed: " << stats.failed << std::endl;
+        std::cout << "Build time: " << stats.build_s << " s, store time: " << stats.store_s
+                  << " s" << std::endl;
+        std::cout << "Output: " << output << std::endl;
+        return stats.failed == 0 ? 0 : 1;
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+}